@@ -20,6 +20,11 @@ static adc_oneshot_unit_handle_t adc_handle;
 static adc_cali_handle_t adc_cali_handle;
 // AW9364 handle (brightness controller)
 static aw9364_dev_handle_t aw9364_dev_hdl;
+// LCD handles kept so the LVGL display can be re-created
+static esp_lcd_panel_io_handle_t lcd_io_handle;
+static esp_lcd_panel_handle_t lcd_panel_handle;
+// Orientation applied to the panel (kept across re-initialization)
+static lcd_rotation_t lcd_rotation = LCD_ROTATION_0;
 
 // initialize the LCD I80 bus
 static void init_lcd_i80_bus(esp_lcd_panel_io_handle_t *io_handle) {
@@ -40,8 +45,9 @@ static void init_lcd_i80_bus(esp_lcd_panel_io_handle_t *io_handle) {
                     LCD_PIN_NUM_DATA7
             },
             .bus_width = LCD_I80_BUS_WIDTH,
-            // transfer 100 lines of pixels (assume pixel is RGB565) at most in one transaction
-            .max_transfer_bytes = LCD_H_RES * 100 * sizeof(uint16_t),
+            // up to a full frame (assume pixel is RGB565) in one transaction, so any
+            // render buffer size can be flushed at once
+            .max_transfer_bytes = LCD_H_RES * LCD_V_RES * sizeof(uint16_t),
             .dma_burst_size = LCD_PSRAM_TRANS_ALIGN,
     };
     ESP_ERROR_CHECK(esp_lcd_new_i80_bus(&bus_config, &i80_bus));
@@ -56,16 +62,28 @@ static void init_lcd_i80_bus(esp_lcd_panel_io_handle_t *io_handle) {
                     .dc_dummy_level = LCD_I80_DC_DUMMY_LEVEL,
                     .dc_data_level = LCD_I80_DC_DATA_LEVEL,
             },
-//            .flags = {
-//                    .swap_color_bytes = !LV_COLOR_16_SWAP, // Swap can be done in LvGL (default) or DMA
-//            },
-//            .user_ctx = user_ctx,
+            .flags = {
+                    .swap_color_bytes = LCD_SWAP_BYTES_IN_HW, // swap done by the peripheral, not in LVGL
+            },
             .lcd_cmd_bits = LCD_CMD_BITS,
             .lcd_param_bits = LCD_PARAM_BITS,
     };
     ESP_ERROR_CHECK(esp_lcd_new_panel_io_i80(i80_bus, &io_config, io_handle));
 }
 
+// landscape with swap_xy; 180 degrees mirrors both axes and moves the gap to the other side
+static void apply_lcd_rotation(esp_lcd_panel_handle_t panel_handle, lcd_rotation_t rotation) {
+    bool flipped = rotation == LCD_ROTATION_180;
+
+    esp_lcd_panel_swap_xy(panel_handle, true);
+    esp_lcd_panel_mirror(panel_handle, flipped, !flipped);
+    if (flipped) {
+        esp_lcd_panel_set_gap(panel_handle, LCD_GAP_X, LCD_RAM_V_RES - LCD_V_RES - LCD_GAP_Y);
+    } else {
+        esp_lcd_panel_set_gap(panel_handle, LCD_GAP_X, LCD_GAP_Y);
+    }
+}
+
 static void init_lcd_panel(esp_lcd_panel_io_handle_t io_handle, esp_lcd_panel_handle_t *panel) {
     esp_lcd_panel_handle_t panel_handle = NULL;
 
@@ -82,10 +100,7 @@ static void init_lcd_panel(esp_lcd_panel_io_handle_t io_handle, esp_lcd_panel_ha
 
     esp_lcd_panel_invert_color(panel_handle, true);
 
-    // landscape, buttons on left, screen on right
-    esp_lcd_panel_swap_xy(panel_handle, true);
-    esp_lcd_panel_mirror(panel_handle, false, true);
-    esp_lcd_panel_set_gap(panel_handle, 0, 35);
+    apply_lcd_rotation(panel_handle, lcd_rotation);
 
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true));
 
@@ -226,33 +241,66 @@ uint8_t lcd_get_brightness_pct() {
     return aw9364_get_brightness_pct(aw9364_dev_hdl);
 }
 
-static lv_disp_t *lcd_lvgl_add_disp(esp_lcd_panel_io_handle_t io_handle, esp_lcd_panel_handle_t panel_handle) {
-    ESP_LOGI(TAG, "Adding display driver to lvgl port...");
+static lv_disp_t *lcd_lvgl_add_disp(esp_lcd_panel_io_handle_t io_handle, esp_lcd_panel_handle_t panel_handle,
+                                    const lcd_buffer_config_t *buffers) {
+    ESP_LOGI(TAG, "Adding display driver to lvgl port (%lu px x%d, %s)...",
+             (unsigned long)buffers->buffer_pixels, buffers->double_buffer ? 2 : 1,
+             buffers->spiram ? "PSRAM" : "internal SRAM");
     /* Add LCD screen */
     const lvgl_port_display_cfg_t disp_cfg = {
             .io_handle = io_handle,
             .panel_handle = panel_handle,
-            .buffer_size = LVGL_BUFFER_SIZE,
-            .double_buffer = true,
+            .buffer_size = buffers->buffer_pixels,
+            .double_buffer = buffers->double_buffer,
             .hres = LCD_H_RES,
             .vres = LCD_V_RES,
             .monochrome = false,
             .color_format = LV_COLOR_FORMAT_RGB565,
-            /* Rotation values must be same as used in esp_lcd for initial settings of the screen */
+            /* Same orientation as apply_lcd_rotation(): esp_lvgl_port re-programs the
+               panel from these values when LVGL's resolution or rotation changes */
             .rotation = {
                     .swap_xy = true,
-                    .mirror_x = false,
-                    .mirror_y = true,
+                    .mirror_x = lcd_rotation == LCD_ROTATION_180,
+                    .mirror_y = lcd_rotation != LCD_ROTATION_180,
             },
             .flags = {
-                    .buff_spiram = true,
-                    .swap_bytes = true,
+                    .buff_dma = !buffers->spiram,
+                    .buff_spiram = buffers->spiram,
+                    .swap_bytes = !LCD_SWAP_BYTES_IN_HW,
             }
     };
     return lvgl_port_add_disp(&disp_cfg);
 }
 
-void lcd_init(lv_disp_t **disp_handle, bool backlight_on) {
+void lcd_set_rotation(lcd_rotation_t rotation) {
+    lcd_rotation = rotation;
+    if (lcd_panel_handle) {
+        ESP_LOGI(TAG, "Panel rotation: %d", (int)rotation);
+        apply_lcd_rotation(lcd_panel_handle, rotation);
+    }
+}
+
+lcd_rotation_t lcd_get_rotation() {
+    return lcd_rotation;
+}
+
+lv_disp_t *lcd_add_display(const lcd_buffer_config_t *buffers) {
+    const lcd_buffer_config_t default_buffers = LCD_BUFFER_CONFIG_DEFAULT();
+    lv_disp_t *disp = lcd_lvgl_add_disp(lcd_io_handle, lcd_panel_handle, buffers ? buffers : &default_buffers);
+    // LVGL renders unrotated, the panel keeps the selected orientation
+    if (lcd_panel_handle) {
+        apply_lcd_rotation(lcd_panel_handle, lcd_rotation);
+    }
+    return disp;
+}
+
+void lcd_remove_display(lv_disp_t *disp_handle) {
+    if (disp_handle) {
+        ESP_ERROR_CHECK(lvgl_port_remove_disp(disp_handle));
+    }
+}
+
+void lcd_init(lv_disp_t **disp_handle, bool backlight_on, const lcd_buffer_config_t *buffers) {
     /* lvgl_port initialization */
     const lvgl_port_cfg_t lvgl_cfg = {
             .task_priority = LVGL_TASK_PRIORITY,
@@ -273,14 +321,12 @@ void lcd_init(lv_disp_t **disp_handle, bool backlight_on) {
     init_battery_monitor();
 
     /* LCD IO */
-    esp_lcd_panel_io_handle_t io_handle = NULL;
-    init_lcd_i80_bus(&io_handle);
+    init_lcd_i80_bus(&lcd_io_handle);
 
     /* LCD driver initialization */
-    esp_lcd_panel_handle_t panel_handle = NULL;
-    init_lcd_panel(io_handle, &panel_handle);
+    init_lcd_panel(lcd_io_handle, &lcd_panel_handle);
 
-    lv_disp_t *disp_hdl = lcd_lvgl_add_disp(io_handle, panel_handle);
+    lv_disp_t *disp_hdl = lcd_add_display(buffers);
 
     *disp_handle = disp_hdl;
 
@@ -7,6 +7,7 @@
 extern "C" {
 #endif
 
+#include "sdkconfig.h"
 #include "esp_lvgl_port.h"
 
 // Refer to https://github.com/Xinyuan-LilyGO/T-Display-S3/tree/main for more information
@@ -49,6 +50,11 @@ extern "C" {
 #define LCD_H_RES              320
 #define LCD_V_RES              170
 
+// ST7789 frame memory is 240x320; the 170 visible lines sit in the middle of it
+#define LCD_RAM_V_RES          240
+#define LCD_GAP_X              0
+#define LCD_GAP_Y              35
+
 #define LCD_PWR_ON_LEVEL  1
 #define LCD_PWR_OFF_LEVEL !LCD_PWR_ON_LEVEL
 
@@ -70,6 +76,14 @@ extern "C" {
 #define LCD_I80_DC_DUMMY_LEVEL   0
 #define LCD_I80_DC_DATA_LEVEL    1
 
+// The panel wants RGB565 high byte first: swap in the i80 peripheral (1)
+// or in software over every flushed pixel (0)
+#ifdef CONFIG_TDISPLAY_S3_SWAP_COLOR_BYTES_IN_HW
+#define LCD_SWAP_BYTES_IN_HW     1
+#else
+#define LCD_SWAP_BYTES_IN_HW     0
+#endif
+
 
 // Supported alignment: 16, 32, 64.
 // A higher alignment can enable higher burst transfer size, thus a higher i80 bus throughput.
@@ -79,6 +93,23 @@ extern "C" {
 // best to keep this as is (1/10th of the display pixels)
 #define LVGL_BUFFER_SIZE        (((LCD_H_RES * LCD_V_RES) / 10) + LCD_H_RES)
 
+// Render buffer holding 1/fraction of the screen, rounded up to whole lines
+#define LVGL_BUFFER_LINES(fraction)  ((LCD_V_RES + (fraction) - 1) / (fraction))
+#define LVGL_BUFFER_PIXELS(fraction) (LCD_H_RES * LVGL_BUFFER_LINES(fraction))
+
+// LVGL render buffer placement and size
+typedef struct {
+    uint32_t buffer_pixels; // size of each buffer in pixels
+    bool double_buffer;     // render into one buffer while the other is transferred
+    bool spiram;            // PSRAM instead of internal DMA-capable SRAM
+} lcd_buffer_config_t;
+
+#define LCD_BUFFER_CONFIG_DEFAULT() { \
+        .buffer_pixels = LVGL_BUFFER_SIZE, \
+        .double_buffer = true, \
+        .spiram = true, \
+    }
+
 // LVGL Timer options
 #define LVGL_TICK_PERIOD_MS    5
 #define LVGL_MAX_SLEEP_MS      (LVGL_TICK_PERIOD_MS * 2) // this affects how fast the screen is refreshed
@@ -86,7 +117,24 @@ extern "C" {
 #define LVGL_TASK_PRIORITY     2
 
 
-void lcd_init(lv_disp_t **disp_handle, bool backlight_on);
+// Panel orientation, applied by the ST7789 itself (MADCTL) so LVGL renders unrotated
+typedef enum {
+    LCD_ROTATION_0 = 0,     // landscape, buttons on the left
+    LCD_ROTATION_180 = 180, // landscape, buttons on the right
+} lcd_rotation_t;
+
+// buffers may be NULL to use LCD_BUFFER_CONFIG_DEFAULT()
+void lcd_init(lv_disp_t **disp_handle, bool backlight_on, const lcd_buffer_config_t *buffers);
+
+// Re-create the LVGL display with another buffer configuration (panel stays initialized)
+lv_disp_t *lcd_add_display(const lcd_buffer_config_t *buffers);
+
+void lcd_remove_display(lv_disp_t *disp_handle);
+
+// May be called before lcd_init(); the screen content must be redrawn afterwards
+void lcd_set_rotation(lcd_rotation_t rotation);
+
+lcd_rotation_t lcd_get_rotation(void);
 
 void lcd_set_brightness_step(uint8_t brightness_step);
 
@@ -8,6 +8,7 @@
     weatherCity: string;
     ntpServer: string;
     timeZone: string;
+    displayRotation: number;
   }
 
   // Interface for the Scan Result
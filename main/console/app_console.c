@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_console.h"
+#include "esp_log.h"
+#include "app_console.h"
+#include "frame_profiler.h"
+#include "nvs_storage.h"
+#include "web_asset_cache.h"
+#include "ui.h"
+
+static const char *TAG = "APP_CONSOLE";
+
+// frames [reset|samples] -> LVGL frame profiling aggregates
+static int cmd_frames(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "reset") == 0)
+    {
+        frame_profiler_reset();
+        printf("Frame profiler reset\n");
+        return 0;
+    }
+
+    frame_stats_t stats;
+    frame_profiler_get_stats(&stats);
+
+    printf("Frames: %lu (window: %lu)\n", (unsigned long)stats.frames, (unsigned long)stats.samples);
+    printf("  render: avg %6lu us  max %6lu us\n", (unsigned long)stats.render_avg_us, (unsigned long)stats.render_max_us);
+    printf("  flush:  avg %6lu us  max %6lu us\n", (unsigned long)stats.flush_avg_us, (unsigned long)stats.flush_max_us);
+    printf("  pixels: avg %6lu     max %6lu\n", (unsigned long)stats.pixels_avg, (unsigned long)stats.pixels_max);
+    printf("  areas:  avg %6lu     max %6lu\n", (unsigned long)stats.areas_avg, (unsigned long)stats.areas_max);
+
+    if (argc > 1 && strcmp(argv[1], "samples") == 0)
+    {
+        frame_sample_t samples[FRAME_PROFILER_WINDOW];
+        size_t n = frame_profiler_get_samples(samples, FRAME_PROFILER_WINDOW);
+        printf("  %8s %8s %8s %5s\n", "render", "flush", "pixels", "areas");
+        for (size_t i = 0; i < n; i++)
+        {
+            printf("  %8lu %8lu %8lu %5u\n",
+                   (unsigned long)samples[i].render_us,
+                   (unsigned long)samples[i].flush_us,
+                   (unsigned long)samples[i].pixels,
+                   (unsigned)samples[i].areas);
+        }
+    }
+    return 0;
+}
+
+// rotate [0|180] -> show or change the panel orientation (saved to NVS)
+static int cmd_rotate(int argc, char **argv)
+{
+    uint16_t rotation = DEFAULT_DISPLAY_ROTATION;
+    nvs_get_display_rotation(&rotation);
+
+    if (argc < 2)
+    {
+        printf("Rotation: %u\n", rotation);
+        return 0;
+    }
+
+    int requested = atoi(argv[1]);
+    if (requested != 0 && requested != 180)
+    {
+        printf("Rotation must be 0 or 180\n");
+        return 1;
+    }
+
+    nvs_set_display_rotation((uint16_t)requested);
+    ui_set_rotation((uint16_t)requested);
+    printf("Rotation: %d\n", requested);
+    return 0;
+}
+
+// webcache [clear] -> web asset cache counters
+static int cmd_webcache(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "clear") == 0)
+    {
+        web_asset_cache_clear();
+        printf("Web cache cleared\n");
+        return 0;
+    }
+
+    web_asset_cache_stats_t stats;
+    web_asset_cache_get_stats(&stats);
+
+    uint32_t lookups = stats.hits + stats.misses;
+    printf("Web cache: %lu entries, %u of %u bytes\n", (unsigned long)stats.entries, (unsigned)stats.bytes,
+           (unsigned)stats.budget);
+    printf("  hits: %lu  misses: %lu  evictions: %lu  hit rate: %lu%%\n", (unsigned long)stats.hits,
+           (unsigned long)stats.misses, (unsigned long)stats.evictions,
+           lookups ? (unsigned long)(stats.hits * 100ULL / lookups) : 0UL);
+    return 0;
+}
+
+static void register_commands(void)
+{
+    const esp_console_cmd_t frames_cmd = {
+        .command = "frames",
+        .help = "Show LVGL frame render/flush statistics. Arguments: [reset|samples]",
+        .hint = NULL,
+        .func = &cmd_frames,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&frames_cmd));
+
+    const esp_console_cmd_t rotate_cmd = {
+        .command = "rotate",
+        .help = "Show or set the display rotation. Arguments: [0|180]",
+        .hint = NULL,
+        .func = &cmd_rotate,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&rotate_cmd));
+
+    const esp_console_cmd_t webcache_cmd = {
+        .command = "webcache",
+        .help = "Show web asset cache statistics. Arguments: [clear]",
+        .hint = NULL,
+        .func = &cmd_webcache,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&webcache_cmd));
+}
+
+void app_console_init(void)
+{
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "ticker>";
+    // Room for the frame sample copies made by the commands
+    repl_config.task_stack_size = 6144;
+
+    esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    esp_err_t err = esp_console_new_repl_uart(&uart_config, &repl_config, &repl);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to create console REPL: %s", esp_err_to_name(err));
+        return;
+    }
+
+    esp_console_register_help_command();
+    register_commands();
+
+    err = esp_console_start_repl(repl);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to start console REPL: %s", esp_err_to_name(err));
+    }
+}
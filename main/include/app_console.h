@@ -0,0 +1,6 @@
+#pragma once
+
+/**
+ * @brief Start the serial console (UART REPL) and register the diagnostic commands.
+ */
+void app_console_init(void);
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "json_writer.h"
+
+// Declared as in LVGL's lv_types.h, so the web server can include this header
+// without LVGL (tools/web_bench/server builds it for the linux target)
+typedef struct _lv_display_t lv_display_t;
+
+// Number of frames kept for the rolling aggregates
+#define FRAME_PROFILER_WINDOW 64
+
+typedef struct {
+    uint32_t render_us; // Time spent rendering (refresh time minus flush time)
+    uint32_t flush_us;  // Time spent in the flush callback and waiting for the transfer
+    uint32_t pixels;    // Invalidated pixels redrawn in this frame
+    uint16_t areas;     // Number of (joined) invalidated areas
+} frame_sample_t;
+
+typedef struct {
+    uint32_t frames;  // Frames rendered since boot (or the last reset)
+    uint32_t samples; // Frames in the rolling window
+    uint32_t render_avg_us;
+    uint32_t render_max_us;
+    uint32_t flush_avg_us;
+    uint32_t flush_max_us;
+    uint32_t pixels_avg;
+    uint32_t pixels_max;
+    uint32_t areas_avg;
+    uint32_t areas_max;
+} frame_stats_t;
+
+/**
+ * @brief Hook the profiler into the display refresh events.
+ *        Must be called with the LVGL lock held.
+ */
+void frame_profiler_attach(lv_display_t *disp);
+
+/**
+ * @brief Compute the aggregates over the current window.
+ */
+void frame_profiler_get_stats(frame_stats_t *stats);
+
+/**
+ * @brief Copy the samples in the window, oldest first.
+ * @return Number of samples copied
+ */
+size_t frame_profiler_get_samples(frame_sample_t *out, size_t max_samples);
+
+/**
+ * @brief Clear the window and the frame counter.
+ */
+void frame_profiler_reset(void);
+
+/**
+ * @brief Write the aggregates and the window samples as a JSON object.
+ */
+void frame_profiler_write_json(json_writer_t *w);
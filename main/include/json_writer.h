@@ -0,0 +1,64 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+// Small streaming JSON writer: values are escaped into a fixed internal buffer
+// that is handed to a sink whenever it fills up, so output of any length is
+// produced in constant memory without allocating.
+
+#define JSON_WRITER_BUFFER_SIZE 256
+#define JSON_WRITER_MAX_DEPTH 16
+
+/**
+ * @brief Receives the output in pieces, in order. Returning an error stops the writer.
+ */
+typedef esp_err_t (*json_sink_t)(void *ctx, const char *data, size_t len);
+
+typedef struct {
+    json_sink_t sink;
+    void *ctx;
+    esp_err_t err;      // First sink error; everything after it is dropped
+    uint8_t depth;      // Open objects/arrays
+    uint32_t has_items; // Bit n: the container at depth n already has a member (needs a comma)
+    size_t len;
+    char buf[JSON_WRITER_BUFFER_SIZE];
+} json_writer_t;
+
+void json_writer_init(json_writer_t *w, json_sink_t sink, void *ctx);
+
+/**
+ * @brief Pass the buffered output to the sink.
+ * @return The first error the sink returned, if any
+ */
+esp_err_t json_writer_finish(json_writer_t *w);
+
+// key is the member name inside an object, NULL inside an array or at the top level
+void json_writer_begin_object(json_writer_t *w, const char *key);
+void json_writer_end_object(json_writer_t *w);
+void json_writer_begin_array(json_writer_t *w, const char *key);
+void json_writer_end_array(json_writer_t *w);
+
+void json_writer_string(json_writer_t *w, const char *key, const char *value); // NULL writes null
+void json_writer_int(json_writer_t *w, const char *key, int64_t value);
+void json_writer_bool(json_writer_t *w, const char *key, bool value);
+void json_writer_null(json_writer_t *w, const char *key);
+
+/**
+ * @brief Write a number with a fixed number of decimals; NaN and infinities are written as null.
+ */
+void json_writer_float(json_writer_t *w, const char *key, float value, int decimals);
+
+// Growable output buffer, for responses that are serialized once and sent many times
+typedef struct {
+    char *data;
+    size_t len;
+    size_t capacity;
+} json_buffer_t;
+
+/**
+ * @brief json_sink_t appending to a json_buffer_t (ctx), allocated in PSRAM when available.
+ *        Free the result with heap_caps_free(buffer.data).
+ */
+esp_err_t json_buffer_sink(void *ctx, const char *data, size_t len);
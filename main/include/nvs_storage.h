@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include "cJSON.h"
+#include "json_writer.h"
 
 #define NVS_NAMESPACE "wifi_config"
 #define NVS_KEY_SOFTAP_SSID "softap_ssid"
@@ -15,10 +16,12 @@
 #define NVS_KEY_TIME_ZONE "time_zone"
 #define NVS_KEY_NTP_SERVER "ntp_server"
 #define NVS_KEY_OPENWEATHER_API_KEY "ow_api_key"
+#define NVS_KEY_DISPLAY_ROTATION "display_rot"
 
 
 #define DEFAULT_SOFTAP_SSID "Weather"
 #define SOFTAP_PSK_LENGTH 12
+#define DEFAULT_DISPLAY_ROTATION 180
 
 /**
  * @brief Initialize NVS storage
@@ -163,6 +166,22 @@ bool nvs_get_openweather_api_key(char *api_key, size_t max_len);
  */
 bool nvs_set_openweather_api_key(const char *api_key);
 
+/**
+ * @brief Get display rotation from NVS
+ * 
+ * @param degrees Where to store the rotation (0 or 180)
+ * @return true if rotation was read, false if not found or error
+ */
+bool nvs_get_display_rotation(uint16_t *degrees);
+
+/**
+ * @brief Set display rotation in NVS
+ * 
+ * @param degrees Rotation to store (0 or 180)
+ * @return true on success, false on failure
+ */
+bool nvs_set_display_rotation(uint16_t degrees);
+
 /**
  * @brief Retrieve SoftAP WPA information from NVS
  * 
@@ -171,12 +190,11 @@ bool nvs_set_openweather_api_key(const char *api_key);
 void get_AP_wpa_info_from_nvs(wpa_info_t *wpa_info);
 
 /**
- * @brief Get full configuration from NVS as JSON string
+ * @brief Write the full configuration from NVS as a JSON object
  * 
- * @param output Buffer to store the JSON string
- * @param max_len Maximum length of the buffer
+ * @param w Writer the object is written to (escaped, any length)
  */
-void get_config_from_nvs(char *output, size_t max_len);
+void write_config_from_nvs(json_writer_t *w);
 
 
 /**
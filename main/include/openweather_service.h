@@ -9,4 +9,20 @@ void openweather_service_init();
 bool openweather_lock(int timeout);
 void openweather_unlock();
 CurrentWeather* openweather_get_current_data();
-void openweather_get_scaled_minutely_precipitation_data(int32_t *data_out);
\ No newline at end of file
+
+/**
+ * @brief Everything from the last refresh. Call with the weather lock held.
+ */
+const OpenWeatherData *openweather_get_data();
+
+/**
+ * @brief Number of successful weather refreshes so far (0 = no data yet).
+ *        Consumers compare it with the last value they saw to skip unchanged data.
+ */
+uint32_t openweather_get_generation();
+
+/**
+ * @brief Minutely precipitation already scaled and classified for display.
+ *        Call with the weather lock held.
+ */
+const MinutelyPrecipitationDisplay *openweather_get_minutely_display();
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 #define MAX_SSID_LEN 32
 #define MAX_PSK_LEN 64
 #define NUM_MINUTELY 60
@@ -13,11 +15,32 @@ typedef struct {
     int timezoneOffset;
 } Coordinates;
 
+// Weather icon resolved from the OpenWeather icon code ("01d", "10n", ...)
+// at parse time. Codes that share artwork for day and night map to one entry.
+typedef enum {
+    WEATHER_ICON_NA = 0,
+    WEATHER_ICON_CLEAR_DAY,         // 01d
+    WEATHER_ICON_CLEAR_NIGHT,       // 01n
+    WEATHER_ICON_FEW_CLOUDS_DAY,    // 02d
+    WEATHER_ICON_FEW_CLOUDS_NIGHT,  // 02n
+    WEATHER_ICON_SCATTERED_CLOUDS,  // 03d, 03n
+    WEATHER_ICON_BROKEN_CLOUDS,     // 04d, 04n
+    WEATHER_ICON_SHOWER_RAIN,       // 09d, 09n
+    WEATHER_ICON_RAIN_DAY,          // 10d
+    WEATHER_ICON_RAIN_NIGHT,        // 10n
+    WEATHER_ICON_THUNDERSTORM_DAY,  // 11d
+    WEATHER_ICON_THUNDERSTORM_NIGHT,// 11n
+    WEATHER_ICON_SNOW,              // 13d, 13n
+    WEATHER_ICON_MIST,              // 50d, 50n
+    WEATHER_ICON_COUNT
+} WeatherIcon;
+
 typedef struct {
     int id;
     char main[32];
     char description[64];
     char icon[8];
+    WeatherIcon iconId;
 } WeatherCondition;
 
 typedef struct {
@@ -51,6 +74,23 @@ typedef struct {
     float precipitation;
 } MinutelyForecast;
 
+// Fixed-point full scale of MinutelyPrecipitationDisplay.level
+#define PRECIP_LEVEL_MAX 1000
+
+typedef enum {
+    PRECIP_LIGHT = 0,
+    PRECIP_MEDIUM,
+    PRECIP_HEAVY,
+    PRECIP_EXTREME,
+    PRECIP_INTENSITY_COUNT
+} PrecipitationIntensity;
+
+// Minutely precipitation prepared for display once per weather refresh
+typedef struct {
+    int32_t level[NUM_MINUTELY];     // 0..PRECIP_LEVEL_MAX, perceptually scaled
+    uint8_t intensity[NUM_MINUTELY]; // PrecipitationIntensity threshold class
+} MinutelyPrecipitationDisplay;
+
 typedef struct {
     int timestamp;
     float temperature;
@@ -86,6 +126,7 @@ typedef struct {
     Coordinates coord;
     CurrentWeather current;
     MinutelyForecast minutely[NUM_MINUTELY]; // OpenWeather always provides up to 60 minutes of minutely data
+    MinutelyPrecipitationDisplay minutelyDisplay; // Derived from minutely[] after each refresh
     HourlyForecast hourly[NUM_HOURLY];     // OpenWeather provides up to 48 hours of hourly data
     DailyForecast daily[NUM_DAILY];        // OpenWeather provides up to 7 days of daily
 } OpenWeatherData;
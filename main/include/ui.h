@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 
 void update_ui(void);
 void ui_init(void);
@@ -8,4 +10,6 @@ void ui_init_queue(void);
 void ui_show_AP_qr(const char * ssid, const char * psk);
 void ui_show_config_qrcode(const char * url);
 void ui_show_clock(void);
-void ui_show_connecting(const char *ssid);
\ No newline at end of file
+void ui_show_connecting(const char *ssid);
+void ui_set_rotation(uint16_t degrees);
+void ui_weather_updated(void);
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "json_writer.h"
+
+// LRU cache of web asset bodies read from LittleFS, kept in PSRAM.
+// Entries are keyed by the resolved file path (a .gz/.br sibling is its own
+// entry) and validated against the asset's size and ETag on every hit.
+
+typedef struct {
+    uint32_t hits;      // Bodies sent from the cache
+    uint32_t misses;    // Bodies read from LittleFS (including files too large to cache)
+    uint32_t evictions; // Entries dropped to stay within the budget or because the file changed
+    uint32_t entries;   // Entries held
+    size_t bytes;       // File bytes held
+    size_t budget;      // Byte budget (CONFIG_WEATHER_WEB_CACHE_KB)
+} web_asset_cache_stats_t;
+
+/**
+ * @brief Get the body of a file, from the cache or by reading it into the cache.
+ *        size and etag describe the current file; a cached copy that differs is replaced.
+ * @return The body (size bytes), to be passed to web_asset_cache_release() once sent,
+ *         or NULL if the cache is disabled, etag is empty, the file is too large or cannot be read.
+ */
+const uint8_t *web_asset_cache_get(const char *path, const char *etag, size_t size);
+
+/**
+ * @brief Release a body returned by web_asset_cache_get().
+ */
+void web_asset_cache_release(const uint8_t *data);
+
+/**
+ * @brief Drop every entry and reset the counters.
+ */
+void web_asset_cache_clear(void);
+
+void web_asset_cache_get_stats(web_asset_cache_stats_t *stats);
+
+/**
+ * @brief Write the counters as a JSON object.
+ */
+void web_asset_cache_write_json(json_writer_t *w);
@@ -0,0 +1,31 @@
+#pragma once
+#include "esp_http_server.h"
+
+// Server-Sent Events at /api/events. A new subscriber gets the whole weather
+// document ("weather" event), then a compact "delta" event after every refresh
+// with only the values that changed, and a "tick" event with the time every
+// CONFIG_WEATHER_WEB_EVENTS_HEARTBEAT_S seconds. Each event is serialized once
+// and written to every subscriber from the HTTP server task.
+
+// Open event streams; further subscribers get 503
+#define WEB_EVENTS_MAX_SUBSCRIBERS 4
+
+/**
+ * @brief Start pushing to subscribers of this server (and the heartbeat timer).
+ */
+void web_events_init(httpd_handle_t server);
+
+/**
+ * @brief GET /api/events: keep the connection open as an event stream.
+ */
+esp_err_t web_events_get_handler(httpd_req_t *req);
+
+/**
+ * @brief httpd close_fn: forget the subscriber on that socket and close it.
+ */
+void web_events_session_closed(httpd_handle_t hd, int sockfd);
+
+/**
+ * @brief Push the changes of the latest weather refresh. Call without the weather lock held.
+ */
+void web_events_weather_updated(void);
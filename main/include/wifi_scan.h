@@ -1,9 +1,36 @@
 #pragma once
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include "json_writer.h"
+
+// Networks kept from one scan (strongest first, one entry per SSID)
+#define WIFI_SCAN_MAX_RESULTS 32
+
+// /api/scan starts a background scan when the results are older than this
+#define WIFI_SCAN_TTL_S 60
+
 /**
- * @brief Scan for available Wi-Fi SSIDs and return as JSON array
- * 
- * @param output Buffer to store the JSON string
- * @param max_len Maximum length of the buffer
+ * @brief Start a background scan unless one is already running.
+ *        Switches a SoftAP-only device to APSTA. The cache is updated on WIFI_EVENT_SCAN_DONE.
+ * @return true if a scan is running when the call returns
  */
-void wifi_scan_ssids_json(char *output, size_t max_len);
+bool wifi_scan_start(void);
+
+/**
+ * @brief Write the cached networks as a JSON array, strongest first. Only serializes:
+ *        callers decide whether to start a scan (see WIFI_SCAN_TTL_S).
+ *
+ * @param w Writer the array is written to
+ */
+void wifi_scan_write_json(json_writer_t *w);
+
+/**
+ * @brief True while a scan is running.
+ */
+bool wifi_scan_in_progress(void);
+
+/**
+ * @brief Age of the cached results in seconds, or -1 if no scan has completed yet.
+ */
+int32_t wifi_scan_age_s(void);
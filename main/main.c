@@ -7,6 +7,7 @@
 #include "web_server.h"
 #include "display.h"
 #include "openweather_service.h"
+#include "app_console.h"
 
 static const char *TAG = "main";
 static void check_memory_allocation();
@@ -39,6 +40,10 @@ void app_main(void)
 
     openweather_service_init();
 
+#if CONFIG_WEATHER_SERIAL_CONSOLE
+    app_console_init();
+#endif
+
     while (1)
     {
         vTaskDelay(pdMS_TO_TICKS(1000));
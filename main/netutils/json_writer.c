@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "esp_heap_caps.h"
+#include "json_writer.h"
+
+void json_writer_init(json_writer_t *w, json_sink_t sink, void *ctx)
+{
+    w->sink = sink;
+    w->ctx = ctx;
+    w->err = ESP_OK;
+    w->depth = 0;
+    w->has_items = 0;
+    w->len = 0;
+}
+
+static void flush(json_writer_t *w)
+{
+    if (w->len > 0 && w->err == ESP_OK)
+    {
+        w->err = w->sink(w->ctx, w->buf, w->len);
+    }
+    w->len = 0;
+}
+
+static void put(json_writer_t *w, const char *data, size_t len)
+{
+    while (len > 0 && w->err == ESP_OK)
+    {
+        size_t n = sizeof(w->buf) - w->len;
+        if (n > len)
+        {
+            n = len;
+        }
+        memcpy(w->buf + w->len, data, n);
+        w->len += n;
+        data += n;
+        len -= n;
+        if (w->len == sizeof(w->buf))
+        {
+            flush(w);
+        }
+    }
+}
+
+static void put_char(json_writer_t *w, char c)
+{
+    put(w, &c, 1);
+}
+
+static void put_escaped(json_writer_t *w, const char *s)
+{
+    put_char(w, '"');
+    const char *run = s; // Characters that need no escaping are copied in one go
+    for (; *s; s++)
+    {
+        unsigned char c = (unsigned char)*s;
+        if (c != '"' && c != '\\' && c >= 0x20)
+        {
+            continue;
+        }
+        put(w, run, s - run);
+        run = s + 1;
+
+        char escape[8];
+        switch (c)
+        {
+        case '"':
+            put(w, "\\\"", 2);
+            break;
+        case '\\':
+            put(w, "\\\\", 2);
+            break;
+        case '\n':
+            put(w, "\\n", 2);
+            break;
+        case '\r':
+            put(w, "\\r", 2);
+            break;
+        case '\t':
+            put(w, "\\t", 2);
+            break;
+        default:
+            snprintf(escape, sizeof(escape), "\\u%04x", c);
+            put(w, escape, 6);
+            break;
+        }
+    }
+    put(w, run, s - run);
+    put_char(w, '"');
+}
+
+// Comma and key before a value in the current container
+static void begin_value(json_writer_t *w, const char *key)
+{
+    uint32_t bit = 1u << w->depth;
+    if (w->depth > 0 && (w->has_items & bit))
+    {
+        put_char(w, ',');
+    }
+    w->has_items |= bit;
+    if (key)
+    {
+        put_escaped(w, key);
+        put_char(w, ':');
+    }
+}
+
+static void open_container(json_writer_t *w, const char *key, char bracket)
+{
+    begin_value(w, key);
+    put_char(w, bracket);
+    if (w->depth < JSON_WRITER_MAX_DEPTH)
+    {
+        w->depth++;
+        w->has_items &= ~(1u << w->depth);
+    }
+}
+
+static void close_container(json_writer_t *w, char bracket)
+{
+    if (w->depth > 0)
+    {
+        w->depth--;
+    }
+    put_char(w, bracket);
+}
+
+esp_err_t json_writer_finish(json_writer_t *w)
+{
+    flush(w);
+    return w->err;
+}
+
+void json_writer_begin_object(json_writer_t *w, const char *key)
+{
+    open_container(w, key, '{');
+}
+
+void json_writer_end_object(json_writer_t *w)
+{
+    close_container(w, '}');
+}
+
+void json_writer_begin_array(json_writer_t *w, const char *key)
+{
+    open_container(w, key, '[');
+}
+
+void json_writer_end_array(json_writer_t *w)
+{
+    close_container(w, ']');
+}
+
+void json_writer_string(json_writer_t *w, const char *key, const char *value)
+{
+    begin_value(w, key);
+    if (value)
+    {
+        put_escaped(w, value);
+    }
+    else
+    {
+        put(w, "null", 4);
+    }
+}
+
+void json_writer_int(json_writer_t *w, const char *key, int64_t value)
+{
+    char number[24];
+    int len = snprintf(number, sizeof(number), "%lld", (long long)value);
+    begin_value(w, key);
+    put(w, number, len);
+}
+
+void json_writer_bool(json_writer_t *w, const char *key, bool value)
+{
+    begin_value(w, key);
+    if (value)
+    {
+        put(w, "true", 4);
+    }
+    else
+    {
+        put(w, "false", 5);
+    }
+}
+
+void json_writer_null(json_writer_t *w, const char *key)
+{
+    begin_value(w, key);
+    put(w, "null", 4);
+}
+
+void json_writer_float(json_writer_t *w, const char *key, float value, int decimals)
+{
+    if (!isfinite(value))
+    {
+        json_writer_null(w, key);
+        return;
+    }
+    char number[32];
+    int len = snprintf(number, sizeof(number), "%.*f", decimals, (double)value);
+    if (len < 0 || len >= (int)sizeof(number))
+    {
+        json_writer_null(w, key);
+        return;
+    }
+    begin_value(w, key);
+    put(w, number, len);
+}
+
+esp_err_t json_buffer_sink(void *ctx, const char *data, size_t len)
+{
+    json_buffer_t *buffer = (json_buffer_t *)ctx;
+    if (buffer->len + len + 1 > buffer->capacity)
+    {
+        size_t capacity = buffer->capacity ? buffer->capacity : 1024;
+        while (capacity < buffer->len + len + 1)
+        {
+            capacity *= 2;
+        }
+        char *grown = heap_caps_realloc(buffer->data, capacity, MALLOC_CAP_SPIRAM);
+        if (grown == NULL)
+        {
+            grown = heap_caps_realloc(buffer->data, capacity, MALLOC_CAP_8BIT);
+        }
+        if (grown == NULL)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+        buffer->data = grown;
+        buffer->capacity = capacity;
+    }
+    memcpy(buffer->data + buffer->len, data, len);
+    buffer->len += len;
+    buffer->data[buffer->len] = '\0';
+    return ESP_OK;
+}
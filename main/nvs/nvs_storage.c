@@ -14,6 +14,11 @@ static esp_err_t nvs_write_str(nvs_handle_t handle, const char *key, const void
     return nvs_set_str(handle, key, (const char *)value);
 }
 
+static esp_err_t nvs_write_u16(nvs_handle_t handle, const char *key, const void *value)
+{
+    return nvs_set_u16(handle, key, *(const uint16_t *)value);
+}
+
 static bool nvs_set_generic(const char *key, nvs_write_cb_t write_cb, const void *value, const char *item_name)
 {
     if (key == NULL || write_cb == NULL || item_name == NULL)
@@ -90,6 +95,34 @@ static bool nvs_get_str_generic(const char *key, char *out, size_t max_len, cons
     return true;
 }
 
+static bool nvs_get_u16_generic(const char *key, uint16_t *out, const char *item_name)
+{
+    if (key == NULL || out == NULL || item_name == NULL)
+    {
+        ESP_LOGD(TAG, "Invalid parameters to nvs_get_u16_generic");
+        return false;
+    }
+
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
+    if (err != ESP_OK)
+    {
+        ESP_LOGD(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    err = nvs_get_u16(handle, key, out);
+    nvs_close(handle);
+
+    if (err != ESP_OK)
+    {
+        ESP_LOGD(TAG, "Failed to read %s: %s", item_name, esp_err_to_name(err));
+        return false;
+    }
+
+    return true;
+}
+
 bool nvs_storage_init(void)
 {
     esp_err_t ret = nvs_flash_init();
@@ -189,6 +222,21 @@ bool nvs_set_openweather_api_key(const char *api_key)
     return nvs_set_generic(NVS_KEY_OPENWEATHER_API_KEY, nvs_write_str, api_key, "OW API Key");
 }
 
+bool nvs_get_display_rotation(uint16_t *degrees)
+{
+    return nvs_get_u16_generic(NVS_KEY_DISPLAY_ROTATION, degrees, "Display Rotation");
+}
+
+bool nvs_set_display_rotation(uint16_t degrees)
+{
+    if (degrees != 0 && degrees != 180)
+    {
+        ESP_LOGE(TAG, "Unsupported display rotation: %u", degrees);
+        return false;
+    }
+    return nvs_set_generic(NVS_KEY_DISPLAY_ROTATION, nvs_write_u16, &degrees, "Display Rotation");
+}
+
 void get_AP_wpa_info_from_nvs(wpa_info_t *wpa_info)
 {
     if (!nvs_get_softap_ssid(wpa_info->ssid, sizeof(wpa_info->ssid)))
@@ -208,9 +256,9 @@ void get_AP_wpa_info_from_nvs(wpa_info_t *wpa_info)
     }
 }
 
-// function to read all stored information and format it as JSON
+// function to read all stored information and write it as JSON
 
-void get_config_from_nvs(char *output, size_t max_len)
+void write_config_from_nvs(json_writer_t *w)
 {
     char ap_ssid[MAX_SSID_LEN] = {0};
     char ap_psk[MAX_PSK_LEN] = {0};
@@ -220,6 +268,7 @@ void get_config_from_nvs(char *output, size_t max_len)
     char time_zone[64] = {0};
     char ntp_server[64] = {0};
     char ow_api_key[128] = {0};
+    uint16_t display_rotation = DEFAULT_DISPLAY_ROTATION;
 
     bool has_ap_ssid = nvs_get_softap_ssid(ap_ssid, sizeof(ap_ssid));
     bool has_ap_psk = nvs_get_softap_psk(ap_psk, sizeof(ap_psk));
@@ -229,46 +278,43 @@ void get_config_from_nvs(char *output, size_t max_len)
     bool has_time_zone = nvs_get_time_zone(time_zone, sizeof(time_zone));
     bool has_ntp_server = nvs_get_ntp_server(ntp_server, sizeof(ntp_server));
     bool has_ow_api_key = nvs_get_openweather_api_key(ow_api_key, sizeof(ow_api_key));
+    nvs_get_display_rotation(&display_rotation);
 
-    size_t offset = 0;
-    offset += snprintf(output + offset, max_len - offset, "{");
+    json_writer_begin_object(w, NULL);
     if (has_ap_ssid)
     {
-        offset += snprintf(output + offset, max_len - offset, "\"apSsid\":\"%s\",", ap_ssid);
+        json_writer_string(w, "apSsid", ap_ssid);
     }
     if (has_ap_psk)
     {
-        offset += snprintf(output + offset, max_len - offset, "\"apPassword\":\"%s\",", ap_psk);
+        json_writer_string(w, "apPassword", ap_psk);
     }
     if (has_wifi_ssid)
     {
-        offset += snprintf(output + offset, max_len - offset, "\"wifiSsid\":\"%s\",", wifi_ssid);
+        json_writer_string(w, "wifiSsid", wifi_ssid);
     }
     if (has_wifi_psk)
     {
-        offset += snprintf(output + offset, max_len - offset, "\"wifiPassword\":\"%s\",", wifi_psk);
+        json_writer_string(w, "wifiPassword", wifi_psk);
     }
     if (has_weather_city)
     {
-        offset += snprintf(output + offset, max_len - offset, "\"weatherCity\":\"%s\",", weather_city);
+        json_writer_string(w, "weatherCity", weather_city);
     }
     if (has_time_zone)
     {
-        offset += snprintf(output + offset, max_len - offset, "\"timeZone\":\"%s\",", time_zone);
+        json_writer_string(w, "timeZone", time_zone);
     }
     if (has_ntp_server)
     {
-        offset += snprintf(output + offset, max_len - offset, "\"ntpServer\":\"%s\",", ntp_server);
+        json_writer_string(w, "ntpServer", ntp_server);
     }
     if (has_ow_api_key)
     {
-        offset += snprintf(output + offset, max_len - offset, "\"weatherApiKey\":\"%s\",", ow_api_key);
+        json_writer_string(w, "weatherApiKey", ow_api_key);
     }
-    if (offset > 1 && output[offset - 1] == ',')
-    {
-        output[--offset] = '\0'; // Remove trailing comma
-    }
-    offset += snprintf(output + offset, max_len - offset, "}");
+    json_writer_int(w, "displayRotation", display_rotation);
+    json_writer_end_object(w);
 }
 
 void nvs_save_config_from_json(const cJSON *root)
@@ -338,4 +384,11 @@ void nvs_save_config_from_json(const cJSON *root)
     {
         nvs_set_openweather_api_key(item->valuestring);
     }
+
+    // 9. Display Rotation
+    item = cJSON_GetObjectItem(root, "displayRotation");
+    if (cJSON_IsNumber(item))
+    {
+        nvs_set_display_rotation((uint16_t)item->valueint);
+    }
 }
\ No newline at end of file
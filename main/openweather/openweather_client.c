@@ -4,6 +4,8 @@
 #include "openweather_service.h"
 #include "openweather_internal.h"
 #include "http_buffer_download.h"
+#include "ui.h"
+#include "web_events.h"
 
 static const char *TAG = "OPENWEATHER_CLIENT";
 
@@ -87,9 +89,12 @@ void fetch_and_process_weather_data(Coordinates coord, const char *api_key)
 
     if (openweather_lock(5000))
     {
-        if (parseOpenWeatherData(response_buffer, s_weather_data))
+        bool updated = parseOpenWeatherData(response_buffer, s_weather_data);
+        if (updated)
         {
-            ESP_LOGI(TAG, "Weather data updated successfully");
+            preprocessMinutelyPrecipitation(s_weather_data->minutely, &s_weather_data->minutelyDisplay);
+            s_weather_generation++;
+            ESP_LOGI(TAG, "Weather data updated successfully (generation %lu)", (unsigned long)s_weather_generation);
         }
         else
         {
@@ -97,6 +102,15 @@ void fetch_and_process_weather_data(Coordinates coord, const char *api_key)
         }
 
         openweather_unlock();
+
+        if (updated)
+        {
+            // The UI copies the new values once instead of polling them
+            ui_weather_updated();
+#if CONFIG_WEATHER_WEB_EVENTS
+            web_events_weather_updated();
+#endif
+        }
     }
     else
     {
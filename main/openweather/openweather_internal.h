@@ -14,6 +14,7 @@ void parseCoordinates(cJSON *key, Coordinates *coord);
 void parseAtmosphericForecast(cJSON *node, AtmosphericForecast *atmospheric);
 void parseWindForecast(cJSON *node, WindForecast *wind);
 void parseWeatherCondition(cJSON *node, WeatherCondition *weather);
+WeatherIcon parseWeatherIcon(const char *code);
 void parseTemperatureForecast(cJSON *node, TemperatureForecast *temperature);
 
 void parseCurrentWeather(cJSON *key, CurrentWeather *current);
@@ -21,6 +22,8 @@ void parseMinutelyForecast(cJSON *root, MinutelyForecast *minutely);
 void parseHourlyForecast(cJSON *root, HourlyForecast *hourly);
 void parseDailyForecast(cJSON *root, DailyForecast *daily);
 
+void preprocessMinutelyPrecipitation(const MinutelyForecast *minutely, MinutelyPrecipitationDisplay *display);
+
 void openweather_service_task(void *pvParameters);
 void fetch_and_process_weather_data(Coordinates coord, const char *api_key);
 
@@ -29,4 +32,5 @@ void fetch_and_process_weather_data(Coordinates coord, const char *api_key);
  */
 Coordinates get_coordinates_from_geocode(const char *api_key);
 extern SemaphoreHandle_t s_weather_mutex; 
-extern OpenWeatherData *s_weather_data;
\ No newline at end of file
+extern OpenWeatherData *s_weather_data;
+extern uint32_t s_weather_generation;
\ No newline at end of file
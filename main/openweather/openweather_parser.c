@@ -1,4 +1,5 @@
 #include <cJSON.h>
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
 #include "typedefs.h"
@@ -107,6 +108,7 @@ void parseWeatherCondition(cJSON *node, WeatherCondition *weather)
             getStringValue(firstWeather, "main", weather->main, sizeof(weather->main));
             getStringValue(firstWeather, "description", weather->description, sizeof(weather->description));
             getStringValue(firstWeather, "icon", weather->icon, sizeof(weather->icon));
+            weather->iconId = parseWeatherIcon(weather->icon);
         }
     }
     else
@@ -115,11 +117,44 @@ void parseWeatherCondition(cJSON *node, WeatherCondition *weather)
         weather->main[0] = '\0';
         weather->description[0] = '\0';
         weather->icon[0] = '\0';
+        weather->iconId = WEATHER_ICON_NA;
     }
 
     return;
 }
 
+// Icon lookup indexed by the two-digit code group and the day/night bit.
+// Groups not listed here stay zero, i.e. WEATHER_ICON_NA.
+#define ICON_GROUP_COUNT 51
+
+static const uint8_t s_icon_lut[ICON_GROUP_COUNT][2] = {
+    [1] = {WEATHER_ICON_CLEAR_DAY, WEATHER_ICON_CLEAR_NIGHT},
+    [2] = {WEATHER_ICON_FEW_CLOUDS_DAY, WEATHER_ICON_FEW_CLOUDS_NIGHT},
+    [3] = {WEATHER_ICON_SCATTERED_CLOUDS, WEATHER_ICON_SCATTERED_CLOUDS},
+    [4] = {WEATHER_ICON_BROKEN_CLOUDS, WEATHER_ICON_BROKEN_CLOUDS},
+    [9] = {WEATHER_ICON_SHOWER_RAIN, WEATHER_ICON_SHOWER_RAIN},
+    [10] = {WEATHER_ICON_RAIN_DAY, WEATHER_ICON_RAIN_NIGHT},
+    [11] = {WEATHER_ICON_THUNDERSTORM_DAY, WEATHER_ICON_THUNDERSTORM_NIGHT},
+    [13] = {WEATHER_ICON_SNOW, WEATHER_ICON_SNOW},
+    [50] = {WEATHER_ICON_MIST, WEATHER_ICON_MIST},
+};
+
+WeatherIcon parseWeatherIcon(const char *code)
+{
+    if (code == NULL || !isdigit((unsigned char)code[0]) || !isdigit((unsigned char)code[1]))
+    {
+        return WEATHER_ICON_NA;
+    }
+
+    int group = (code[0] - '0') * 10 + (code[1] - '0');
+    if (group >= ICON_GROUP_COUNT)
+    {
+        return WEATHER_ICON_NA;
+    }
+
+    return (WeatherIcon)s_icon_lut[group][code[2] == 'n' ? 1 : 0];
+}
+
 void parseTemperatureForecast(cJSON *node, TemperatureForecast *temperature)
 {
     temperature->day = getFloatValue(node, "day");
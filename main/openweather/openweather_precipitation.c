@@ -0,0 +1,65 @@
+#include <math.h>
+#include "sdkconfig.h"
+#include "typedefs.h"
+#include "openweather_internal.h"
+
+// Intensity thresholds (mm/h) used to colour the precipitation bars
+static const float LIGHT_RAIN_THRESHOLD = 10.0f;
+static const float MEDIUM_RAIN_THRESHOLD = 30.0f;
+static const float HEAVY_RAIN_THRESHOLD = 60.0f;
+
+static const float FULL_SCALE_MM_H = (float)CONFIG_WEATHER_PRECIP_FULL_SCALE_MM_H;
+
+static PrecipitationIntensity classify_precipitation(float mm_h)
+{
+    if (mm_h <= LIGHT_RAIN_THRESHOLD)
+    {
+        return PRECIP_LIGHT;
+    }
+    if (mm_h <= MEDIUM_RAIN_THRESHOLD)
+    {
+        return PRECIP_MEDIUM;
+    }
+    if (mm_h <= HEAVY_RAIN_THRESHOLD)
+    {
+        return PRECIP_HEAVY;
+    }
+    return PRECIP_EXTREME;
+}
+
+// Maps a rate in mm/h to 0..1 of the chart height using the configured scale
+static float scale_precipitation(float mm_h)
+{
+#if CONFIG_WEATHER_PRECIP_SCALE_LOG
+    return log1pf(mm_h) / log1pf(FULL_SCALE_MM_H);
+#elif CONFIG_WEATHER_PRECIP_SCALE_SQRT
+    return sqrtf(mm_h / FULL_SCALE_MM_H);
+#else
+    return mm_h / FULL_SCALE_MM_H;
+#endif
+}
+
+void preprocessMinutelyPrecipitation(const MinutelyForecast *minutely, MinutelyPrecipitationDisplay *display)
+{
+    for (int i = 0; i < NUM_MINUTELY; i++)
+    {
+        float mm_h = minutely[i].precipitation;
+        if (!(mm_h > 0.0f))
+        {
+            display->level[i] = 0;
+            display->intensity[i] = PRECIP_LIGHT;
+            continue;
+        }
+
+        float scaled = scale_precipitation(mm_h);
+        if (scaled > 1.0f)
+        {
+            scaled = 1.0f;
+        }
+
+        int32_t level = (int32_t)lroundf(scaled * PRECIP_LEVEL_MAX);
+        // Any measurable precipitation keeps a visible minimum level
+        display->level[i] = level > 0 ? level : 1;
+        display->intensity[i] = classify_precipitation(mm_h);
+    }
+}
@@ -10,6 +10,7 @@ static const int OPENWEATHER_UPDATE_INTERVAL_MS = 2 * 60 * 1000; // 2 minutes
 
 OpenWeatherData *s_weather_data = NULL;
 SemaphoreHandle_t s_weather_mutex = NULL;
+uint32_t s_weather_generation = 0; // Incremented on every successful refresh
 
 void openweather_service_init()
 {
@@ -85,10 +86,17 @@ CurrentWeather *openweather_get_current_data()
     return &(s_weather_data->current);
 }
 
-void openweather_get_scaled_minutely_precipitation_data(int32_t *data_out)
+const OpenWeatherData *openweather_get_data()
 {
-    for (int i = 0; i < NUM_MINUTELY; i++)
-    {
-        data_out[i] = (int32_t)(s_weather_data->minutely[i].precipitation);
-    }
+    return s_weather_data;
+}
+
+uint32_t openweather_get_generation()
+{
+    return s_weather_generation;
+}
+
+const MinutelyPrecipitationDisplay *openweather_get_minutely_display()
+{
+    return &(s_weather_data->minutelyDisplay);
 }
\ No newline at end of file
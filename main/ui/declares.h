@@ -25,6 +25,25 @@ LV_IMAGE_DECLARE(weather_13);
 LV_IMAGE_DECLARE(weather_50); 
 LV_IMAGE_DECLARE(weather_na);
 
+// Opaque RGB565 variants pre-blended on WEATHER_ICON_OPAQUE_BG
+// (generated by tools/imageconverter/opaque_icons.py)
+#define WEATHER_ICON_OPAQUE_BG 0x00008B
+
+LV_IMAGE_DECLARE(weather_01d_opaque);
+LV_IMAGE_DECLARE(weather_01n_opaque);
+LV_IMAGE_DECLARE(weather_02d_opaque);
+LV_IMAGE_DECLARE(weather_02n_opaque);
+LV_IMAGE_DECLARE(weather_03_opaque);
+LV_IMAGE_DECLARE(weather_04_opaque);
+LV_IMAGE_DECLARE(weather_09_opaque);
+LV_IMAGE_DECLARE(weather_10d_opaque);
+LV_IMAGE_DECLARE(weather_10n_opaque);
+LV_IMAGE_DECLARE(weather_11d_opaque);
+LV_IMAGE_DECLARE(weather_11n_opaque);
+LV_IMAGE_DECLARE(weather_13_opaque);
+LV_IMAGE_DECLARE(weather_50_opaque);
+LV_IMAGE_DECLARE(weather_na_opaque);
+
 LV_IMAGE_DECLARE(feels_like_icon);
 LV_IMAGE_DECLARE(humidity_icon);
 LV_IMAGE_DECLARE(pressure_icon);
@@ -5,6 +5,9 @@
 #include "display.h"
 #include "ui.h"
 #include "ui_events.h"
+#include "frame_profiler.h"
+#include "display_buffers.h"
+#include "nvs_storage.h"
 
 static const int DISPLAY_UPDATE_INTERVAL_MS = 100;
 static lv_disp_t *disp_handle = NULL;
@@ -15,10 +18,24 @@ void initialize_display(void)
 {
     ui_init_queue();
 
-    lcd_init(&disp_handle, true);
+    // Orientation is applied by the panel itself, LVGL renders unrotated
+    uint16_t rotation = DEFAULT_DISPLAY_ROTATION;
+    nvs_get_display_rotation(&rotation);
+    lcd_set_rotation(rotation == 180 ? LCD_ROTATION_180 : LCD_ROTATION_0);
+
+    lcd_buffer_config_t buffers = display_select_buffers();
+    lcd_init(&disp_handle, true, &buffers);
+
+#if CONFIG_WEATHER_LCD_BUFFER_BENCHMARK
+    display_benchmark_buffers(&disp_handle, &buffers);
+#endif
+
+#if CONFIG_WEATHER_FRAME_PROFILER
+    lvgl_port_lock(0);
+    frame_profiler_attach(disp_handle);
+    lvgl_port_unlock();
+#endif
 
-    lv_disp_set_rotation(disp_handle, LV_DISP_ROTATION_180);
-    
     xTaskCreatePinnedToCore(ui_update_task, "update_ui", 4096 * 3, NULL, 5, NULL, 1);
 
 }
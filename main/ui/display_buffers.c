@@ -0,0 +1,227 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "lvgl_private.h" // lv_display_t.flushing
+#include "display_buffers.h"
+#include "ui_internal.h"
+
+static const char *TAG = "DISPLAY_BUFFERS";
+
+#define INTERNAL_DMA_CAPS (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL)
+#define BENCHMARK_FRAMES 10
+
+typedef struct
+{
+    const char *name;
+    uint8_t fraction; // buffer holds 1/fraction of the screen
+    bool double_buffer;
+    bool spiram;
+} buffer_strategy_t;
+
+// Automatic mode takes the first internal entry that fits, then the PSRAM fallback
+static const buffer_strategy_t auto_strategies[] = {
+    {"SRAM 1/4 x2", 4, true, false},
+    {"SRAM 1/10 x2", 10, true, false},
+    {"SRAM 1/10 x1", 10, false, false},
+    {"PSRAM 1/10 x2", 10, true, true},
+};
+
+// Everything the benchmark tries (full frame x2 never fits in internal SRAM)
+static const buffer_strategy_t benchmark_strategies[] = {
+    {"SRAM full x1", 1, false, false},
+    {"SRAM 1/4 x2", 4, true, false},
+    {"SRAM 1/4 x1", 4, false, false},
+    {"SRAM 1/10 x2", 10, true, false},
+    {"SRAM 1/10 x1", 10, false, false},
+    {"PSRAM full x2", 1, true, true},
+    {"PSRAM full x1", 1, false, true},
+    {"PSRAM 1/4 x2", 4, true, true},
+    {"PSRAM 1/4 x1", 4, false, true},
+    {"PSRAM 1/10 x2", 10, true, true},
+    {"PSRAM 1/10 x1", 10, false, true},
+};
+
+#if CONFIG_WEATHER_LCD_BUFFER_SIZE_FULL
+#define MANUAL_BUFFER_FRACTION 1
+#elif CONFIG_WEATHER_LCD_BUFFER_SIZE_4
+#define MANUAL_BUFFER_FRACTION 4
+#else
+#define MANUAL_BUFFER_FRACTION 10
+#endif
+
+#if CONFIG_WEATHER_LCD_BUFFER_DOUBLE
+#define MANUAL_DOUBLE_BUFFER true
+#else
+#define MANUAL_DOUBLE_BUFFER false
+#endif
+
+#if CONFIG_WEATHER_LCD_BUFFER_PSRAM
+#define MANUAL_SPIRAM true
+#else
+#define MANUAL_SPIRAM false
+#endif
+
+static lcd_buffer_config_t strategy_to_config(const buffer_strategy_t *strategy)
+{
+    lcd_buffer_config_t cfg = {
+        .buffer_pixels = LVGL_BUFFER_PIXELS(strategy->fraction),
+        .double_buffer = strategy->double_buffer,
+        .spiram = strategy->spiram,
+    };
+    return cfg;
+}
+
+// Internal SRAM buffers must fit and still leave reserve_bytes free
+static bool fits_internal(const lcd_buffer_config_t *cfg, size_t reserve_bytes)
+{
+    size_t buffer_bytes = cfg->buffer_pixels * sizeof(uint16_t);
+    size_t total_bytes = buffer_bytes * (cfg->double_buffer ? 2 : 1);
+    size_t free_bytes = heap_caps_get_free_size(INTERNAL_DMA_CAPS);
+    size_t largest_block = heap_caps_get_largest_free_block(INTERNAL_DMA_CAPS);
+
+    return buffer_bytes <= largest_block && total_bytes + reserve_bytes <= free_bytes;
+}
+
+lcd_buffer_config_t display_select_buffers(void)
+{
+#if CONFIG_WEATHER_LCD_BUFFER_MANUAL
+    const buffer_strategy_t manual = {"manual", MANUAL_BUFFER_FRACTION, MANUAL_DOUBLE_BUFFER, MANUAL_SPIRAM};
+    lcd_buffer_config_t cfg = strategy_to_config(&manual);
+    if (!cfg.spiram && !fits_internal(&cfg, 0))
+    {
+        ESP_LOGW(TAG, "Configured SRAM buffers do not fit, using PSRAM");
+        cfg.spiram = true;
+    }
+    return cfg;
+#else
+    size_t reserve_bytes = CONFIG_WEATHER_LCD_INTERNAL_RESERVE_KB * 1024;
+    size_t count = sizeof(auto_strategies) / sizeof(auto_strategies[0]);
+
+    ESP_LOGI(TAG, "Internal DMA-capable RAM free: %u bytes (largest block %u)",
+             (unsigned)heap_caps_get_free_size(INTERNAL_DMA_CAPS),
+             (unsigned)heap_caps_get_largest_free_block(INTERNAL_DMA_CAPS));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        lcd_buffer_config_t cfg = strategy_to_config(&auto_strategies[i]);
+        if (cfg.spiram || fits_internal(&cfg, reserve_bytes))
+        {
+            ESP_LOGI(TAG, "Render buffers: %s", auto_strategies[i].name);
+            return cfg;
+        }
+    }
+
+    // Unreachable while the list ends with a PSRAM entry
+    lcd_buffer_config_t fallback = LCD_BUFFER_CONFIG_DEFAULT();
+    return fallback;
+#endif
+}
+
+// Full-screen redraws of the current screen, including the last transfer
+static uint32_t measure_redraw_us(lv_disp_t *disp)
+{
+    lv_refr_now(disp); // warm-up (layout, image cache)
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < BENCHMARK_FRAMES; i++)
+    {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(disp);
+    }
+    while (disp->flushing)
+    {
+        vTaskDelay(1);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    return (uint32_t)(elapsed / BENCHMARK_FRAMES);
+}
+
+// Cost of the per-flush software byte swap that LCD_SWAP_BYTES_IN_HW removes
+static void log_software_swap_cost(const lcd_buffer_config_t *buffers)
+{
+    uint32_t caps = buffers->spiram ? MALLOC_CAP_SPIRAM : INTERNAL_DMA_CAPS;
+    uint16_t *buf = heap_caps_malloc(buffers->buffer_pixels * sizeof(uint16_t), caps);
+    if (buf == NULL)
+    {
+        ESP_LOGW(TAG, "No memory to measure the software byte swap");
+        return;
+    }
+    memset(buf, 0x5A, buffers->buffer_pixels * sizeof(uint16_t));
+
+    // One full frame is flushed as this many buffers
+    uint32_t frame_pixels = LCD_H_RES * LCD_V_RES;
+    uint32_t chunks = (frame_pixels + buffers->buffer_pixels - 1) / buffers->buffer_pixels;
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < BENCHMARK_FRAMES; i++)
+    {
+        for (uint32_t c = 0; c < chunks; c++)
+        {
+            lv_draw_sw_rgb565_swap(buf, buffers->buffer_pixels);
+        }
+    }
+    uint32_t frame_us = (uint32_t)((esp_timer_get_time() - start) / BENCHMARK_FRAMES);
+    heap_caps_free(buf);
+
+    ESP_LOGI(TAG, "Software byte swap: %lu us per frame (%.1f MB/s), %s", (unsigned long)frame_us,
+             frame_us ? (frame_pixels * sizeof(uint16_t)) / (float)frame_us : 0.0f,
+             LCD_SWAP_BYTES_IN_HW ? "not used, the i80 peripheral swaps" : "included in every flush below");
+}
+
+void display_benchmark_buffers(lv_disp_t **disp_handle, const lcd_buffer_config_t *buffers)
+{
+    size_t count = sizeof(benchmark_strategies) / sizeof(benchmark_strategies[0]);
+
+    ESP_LOGI(TAG, "Benchmarking render buffers (%d full-screen redraws each)...", BENCHMARK_FRAMES);
+    log_software_swap_cost(buffers);
+
+    lvgl_port_lock(0);
+    lcd_remove_display(*disp_handle);
+    *disp_handle = NULL;
+    lvgl_port_unlock();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const buffer_strategy_t *strategy = &benchmark_strategies[i];
+        lcd_buffer_config_t cfg = strategy_to_config(strategy);
+
+        if (!cfg.spiram && !fits_internal(&cfg, 0))
+        {
+            ESP_LOGI(TAG, "  %-14s skipped (does not fit in internal RAM)", strategy->name);
+            continue;
+        }
+
+        lvgl_port_lock(0);
+        lv_disp_t *disp = lcd_add_display(&cfg);
+        if (disp == NULL)
+        {
+            lvgl_port_unlock();
+            ESP_LOGW(TAG, "  %-14s failed to allocate", strategy->name);
+            continue;
+        }
+        lv_display_set_default(disp);
+
+        // The clock screen is what the device shows most of the time. It is built on
+        // a throwaway screen that goes away with this display.
+        lv_obj_t *scr = create_screen();
+        build_clock_screen(scr);
+        lv_screen_load(scr);
+        s_last_detected_second = -1;
+        tick_clock();
+        uint32_t frame_us = measure_redraw_us(disp);
+
+        lcd_remove_display(disp);
+        lvgl_port_unlock();
+
+        ESP_LOGI(TAG, "  %-14s %6lu us/frame (%.1f fps)", strategy->name,
+                 (unsigned long)frame_us, frame_us ? 1000000.0f / frame_us : 0.0f);
+    }
+
+    lvgl_port_lock(0);
+    *disp_handle = lcd_add_display(buffers);
+    lvgl_port_unlock();
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "t_display_s3.h"
+
+/**
+ * @brief Pick the LVGL render buffer configuration from Kconfig.
+ *        In automatic mode the largest internal SRAM buffers that leave
+ *        CONFIG_WEATHER_LCD_INTERNAL_RESERVE_KB free are used, otherwise PSRAM.
+ */
+lcd_buffer_config_t display_select_buffers(void);
+
+/**
+ * @brief Measure a full-screen redraw with every buffer strategy that fits.
+ *        Re-creates the display for each strategy and leaves *disp_handle
+ *        attached with the configuration in *buffers.
+ */
+void display_benchmark_buffers(lv_disp_t **disp_handle, const lcd_buffer_config_t *buffers);
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 24 px
  * Bpp: 4
- * Opts: --bpp 4 --size 24 --no-compress --stride 1 --align 1 --font BarlowCondensed-SemiBold.ttf --range 32-96,176 --format lvgl -o barlow_condensed_sb24px.c
+ * Opts: --bpp 4 --size 24 --no-compress --stride 1 --align 1 --font BarlowCondensed-SemiBold.ttf --range 45,48-58 --format lvgl -o barlow_condensed_sb24px.c
  ******************************************************************************/
 
 #ifdef __has_include
@@ -32,160 +32,10 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((aligned(4))) = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x2f, 0xf9, 0x2f, 0xf9, 0x1f, 0xf8, 0x1f, 0xf8,
-    0x1f, 0xf8, 0xf, 0xf7, 0xf, 0xf7, 0xf, 0xf6,
-    0xf, 0xf6, 0xf, 0xf6, 0xe, 0xf5, 0x8, 0xa3,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x71, 0x4f, 0xfb,
-    0x6f, 0xfd, 0x1c, 0xe5,
-
-    /* U+0022 "\"" */
-    0x8f, 0xf0, 0xbf, 0xd8, 0xff, 0xa, 0xfd, 0x7f,
-    0xf0, 0x9f, 0xc6, 0xfe, 0x9, 0xfb, 0x5f, 0xd0,
-    0x8f, 0xa2, 0x86, 0x3, 0x84,
-
-    /* U+0023 "#" */
-    0x0, 0xc, 0xff, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0xef, 0xd0, 0x6, 0xff, 0x60, 0x0, 0xf, 0xfb,
-    0x0, 0x8f, 0xf4, 0x0, 0x3, 0xff, 0x90, 0xa,
-    0xff, 0x20, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x18,
-    0xdf, 0xf9, 0x89, 0xff, 0xd8, 0x40, 0xc, 0xff,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0xef, 0xe0, 0x5,
-    0xff, 0x60, 0x0, 0xf, 0xfc, 0x0, 0x7f, 0xf4,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7c, 0xff,
-    0xa7, 0x7f, 0xfe, 0x75, 0x0, 0x9f, 0xf2, 0x1,
-    0xff, 0xb0, 0x0, 0xc, 0xff, 0x0, 0x3f, 0xf9,
-    0x0, 0x0, 0xef, 0xe0, 0x5, 0xff, 0x70, 0x0,
-    0x7, 0x86, 0x0, 0x38, 0x82, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x3a, 0xff, 0xc5, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x70, 0xc, 0xff, 0xb9, 0xff,
-    0xf1, 0x1f, 0xfb, 0x0, 0x7f, 0xf6, 0x3f, 0xf8,
-    0x0, 0x3f, 0xf8, 0x2f, 0xfb, 0x0, 0x1a, 0xa5,
-    0xe, 0xff, 0x50, 0x0, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0x0,
-    0x8, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x5f, 0xff,
-    0xb0, 0x0, 0x0, 0x2, 0xef, 0xf5, 0x5, 0x52,
-    0x0, 0x5f, 0xf9, 0x2f, 0xf9, 0x0, 0x1f, 0xfa,
-    0xf, 0xfc, 0x0, 0x3f, 0xf8, 0xc, 0xff, 0x96,
-    0xdf, 0xf4, 0x4, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x4c, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
-
-    /* U+0025 "%" */
-    0x1, 0xaf, 0xe8, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0xdf, 0xab, 0xfa, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x6f, 0x40, 0x9, 0xf2, 0x0, 0x8f, 0x70,
-    0x0, 0xa, 0xe0, 0x0, 0x2f, 0x60, 0x1f, 0xe0,
-    0x0, 0x0, 0xae, 0x0, 0x2, 0xf6, 0x8, 0xf7,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0x8f, 0x21, 0xfe,
-    0x0, 0x0, 0x0, 0xd, 0xfa, 0xbf, 0xa0, 0x8f,
-    0x70, 0x0, 0x0, 0x0, 0x1a, 0xfe, 0x80, 0x1f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x70, 0x5, 0x86, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0xc, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x8, 0xf7, 0x8, 0xf6, 0x4, 0xec, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0xdb, 0x0, 0x7, 0xf1, 0x0,
-    0x0, 0x8f, 0x70, 0xe, 0x90, 0x0, 0x5f, 0x20,
-    0x0, 0x1f, 0xe0, 0x0, 0xbd, 0x0, 0xa, 0xe0,
-    0x0, 0x8, 0xf7, 0x0, 0x3, 0xfb, 0x69, 0xf7,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x3, 0xcf, 0xd6,
-    0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x6, 0xdf, 0xe9, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0xff,
-    0xfb, 0xdf, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xa0,
-    0x1f, 0xfe, 0x0, 0x0, 0x5, 0xff, 0x70, 0xd,
-    0xff, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x1f, 0xfd,
-    0x0, 0x0, 0x0, 0xcf, 0xf4, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0x0, 0x32, 0x0, 0xc, 0xff, 0x87,
-    0xff, 0x90, 0xdf, 0x70, 0x1f, 0xfd, 0x0, 0xcf,
-    0xfb, 0xff, 0x60, 0x3f, 0xf9, 0x0, 0x1e, 0xff,
-    0xfd, 0x0, 0x2f, 0xfb, 0x0, 0x7, 0xff, 0xf3,
-    0x0, 0xe, 0xff, 0x95, 0x8f, 0xff, 0xf6, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x4b, 0xff, 0xea, 0x33, 0xff, 0xc0,
-
-    /* U+0027 "'" */
-    0x8f, 0xf2, 0x8f, 0xf1, 0x7f, 0xf1, 0x6f, 0xf0,
-    0x5f, 0xf0, 0x27, 0x60,
-
-    /* U+0028 "(" */
-    0x0, 0x37, 0x71, 0x0, 0xdf, 0xf0, 0x5, 0xff,
-    0x90, 0xb, 0xff, 0x40, 0x1f, 0xff, 0x0, 0x5f,
-    0xfc, 0x0, 0x8f, 0xf9, 0x0, 0xbf, 0xf6, 0x0,
-    0xdf, 0xf4, 0x0, 0xef, 0xf3, 0x0, 0xff, 0xf2,
-    0x0, 0xff, 0xf2, 0x0, 0xff, 0xf2, 0x0, 0xef,
-    0xf3, 0x0, 0xcf, 0xf4, 0x0, 0xaf, 0xf7, 0x0,
-    0x7f, 0xfa, 0x0, 0x3f, 0xfd, 0x0, 0xe, 0xff,
-    0x10, 0x9, 0xff, 0x60, 0x2, 0xff, 0xc0, 0x0,
-    0xaf, 0xf1,
-
-    /* U+0029 ")" */
-    0x37, 0x71, 0x0, 0x4f, 0xf9, 0x0, 0xe, 0xff,
-    0x10, 0x9, 0xff, 0x70, 0x4, 0xff, 0xc0, 0x0,
-    0xff, 0xf1, 0x0, 0xdf, 0xf3, 0x0, 0xbf, 0xf6,
-    0x0, 0x9f, 0xf9, 0x0, 0x8f, 0xf9, 0x0, 0x7f,
-    0xfa, 0x0, 0x7f, 0xfb, 0x0, 0x7f, 0xfa, 0x0,
-    0x8f, 0xf9, 0x0, 0xaf, 0xf8, 0x0, 0xcf, 0xf5,
-    0x0, 0xff, 0xf2, 0x2, 0xff, 0xe0, 0x6, 0xff,
-    0x90, 0xb, 0xff, 0x40, 0x1f, 0xfd, 0x0, 0x6f,
-    0xf5, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x5, 0xc1, 0x0, 0x0, 0x20, 0x7f, 0x20,
-    0x20, 0x4f, 0x98, 0xf5, 0xce, 0x2, 0xcf, 0xff,
-    0xff, 0x90, 0x0, 0x9f, 0xff, 0x40, 0x1, 0x9f,
-    0xff, 0xfe, 0x60, 0x5f, 0xca, 0xf8, 0xef, 0x10,
-    0x50, 0x7f, 0x21, 0x40, 0x0, 0x7, 0xf2, 0x0,
-    0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0x50, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x3,
-    0x33, 0xdf, 0x73, 0x32, 0x5f, 0xff, 0xff, 0xff,
-    0xfe, 0x5f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x8a,
-    0x30, 0x0,
-
-    /* U+002C "," */
-    0x1, 0x32, 0xa, 0xfc, 0xb, 0xf9, 0xd, 0xf5,
-    0xf, 0xf2, 0x1f, 0xe0, 0x2f, 0xb0,
-
     /* U+002D "-" */
     0x28, 0x88, 0x88, 0x80, 0x5f, 0xff, 0xff, 0xf2,
     0x5f, 0xff, 0xff, 0xf2,
 
-    /* U+002E "." */
-    0x3, 0x73, 0x0, 0xef, 0xf1, 0x1f, 0xff, 0x20,
-    0x9f, 0x90,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x9, 0xff, 0x10, 0x0, 0x0, 0xef,
-    0xd0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x8,
-    0xff, 0x40, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x5, 0xff, 0x70, 0x0,
-    0x0, 0xaf, 0xf2, 0x0, 0x0, 0xe, 0xfe, 0x0,
-    0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0xc, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x9,
-    0xff, 0x20, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0,
-    0x2f, 0xf9, 0x0, 0x0, 0x6, 0xff, 0x40, 0x0,
-    0x0,
-
     /* U+0030 "0" */
     0x0, 0x19, 0xef, 0xd8, 0x0, 0x1, 0xef, 0xff,
     0xff, 0xb0, 0x9, 0xff, 0xd9, 0xef, 0xf6, 0xe,
@@ -325,502 +175,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     /* U+003A ":" */
     0x2d, 0xe3, 0x9f, 0xfb, 0x7f, 0xf9, 0x6, 0x70,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x70, 0x7f, 0xf9, 0x9f, 0xfb, 0x2d, 0xe3,
-
-    /* U+003B ";" */
-    0x7, 0xfa, 0x1, 0xff, 0xf4, 0xf, 0xff, 0x40,
-    0x6c, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0x9, 0xfd, 0x0, 0xbf,
-    0xa0, 0xc, 0xf7, 0x0, 0xdf, 0x40, 0xf, 0xf1,
-    0x0, 0xfe, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x39, 0x0, 0x0, 0x0,
-    0x3b, 0xfe, 0x0, 0x0, 0x4b, 0xff, 0xfd, 0x0,
-    0x4c, 0xff, 0xfe, 0x81, 0x2c, 0xff, 0xfd, 0x60,
-    0x0, 0x5f, 0xfd, 0x50, 0x0, 0x0, 0x5f, 0xff,
-    0x92, 0x0, 0x0, 0x19, 0xff, 0xff, 0xa3, 0x0,
-    0x0, 0x18, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x18,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x18, 0xee, 0x0,
-    0x0, 0x0, 0x0, 0x6,
-
-    /* U+003D "=" */
-    0x5f, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xff, 0xff,
-    0xff, 0xfe, 0x3, 0x33, 0x33, 0x33, 0x32, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x33, 0x33, 0x33,
-    0x32, 0x5f, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xff,
-    0xff, 0xff, 0xfe,
-
-    /* U+003E ">" */
-    0x47, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x10,
-    0x0, 0x0, 0x4f, 0xff, 0xf8, 0x10, 0x0, 0x4,
-    0xbf, 0xff, 0xf8, 0x10, 0x0, 0x2, 0xaf, 0xff,
-    0xf8, 0x0, 0x0, 0x1, 0x8f, 0xfe, 0x0, 0x0,
-    0x5, 0xcf, 0xfe, 0x0, 0x6, 0xdf, 0xff, 0xd5,
-    0x7, 0xef, 0xff, 0xd5, 0x0, 0x5f, 0xff, 0xc5,
-    0x0, 0x0, 0x5f, 0xc4, 0x0, 0x0, 0x0, 0x34,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x3b, 0xef, 0xc4, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x50, 0xe, 0xff, 0xcc, 0xff, 0xe0, 0x4f,
-    0xfa, 0x0, 0xcf, 0xf4, 0x7f, 0xf5, 0x0, 0x7f,
-    0xf5, 0x4a, 0xa2, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x1, 0xef, 0xf2, 0x0, 0x0, 0xc, 0xff, 0xb0,
-    0x0, 0x0, 0xbf, 0xfd, 0x10, 0x0, 0x6, 0xff,
-    0xe1, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
-    0xc, 0xff, 0x0, 0x0, 0x0, 0x6, 0x98, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x74, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0,
-    0x0, 0xf, 0xff, 0x40, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x28, 0xdf, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0xef, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0xcf, 0xe6, 0x10, 0x1,
-    0x7f, 0xfa, 0x0, 0x0, 0xa, 0xfb, 0x10, 0x0,
-    0x0, 0x3, 0xff, 0x50, 0x0, 0x6f, 0xd0, 0x5,
-    0xa8, 0x8b, 0x10, 0x7f, 0xc0, 0x0, 0xef, 0x20,
-    0x5f, 0xff, 0xff, 0x10, 0x1f, 0xf1, 0x6, 0xfa,
-    0x0, 0xcf, 0x53, 0xff, 0x0, 0xd, 0xf3, 0xa,
-    0xf4, 0x0, 0xfe, 0x0, 0xfd, 0x0, 0xb, 0xf4,
-    0xd, 0xf1, 0x2, 0xfc, 0x2, 0xfb, 0x0, 0xc,
-    0xf3, 0xf, 0xe0, 0x3, 0xfa, 0x4, 0xfa, 0x0,
-    0xf, 0xf1, 0x1f, 0xe0, 0x5, 0xf8, 0x6, 0xfa,
-    0x0, 0x4f, 0xd0, 0xf, 0xf0, 0x5, 0xfb, 0xc,
-    0xfe, 0x22, 0xdf, 0x60, 0xe, 0xf3, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x9, 0xfa, 0x0,
-    0x4c, 0xd7, 0x2a, 0xdc, 0x70, 0x0, 0x2, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf9, 0x20, 0x1, 0x7b, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3a, 0xdf, 0xfc, 0x71, 0x0,
-    0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x2, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x50, 0x0, 0x0, 0x9, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0, 0xf,
-    0xfd, 0xfe, 0x0, 0x0, 0x2, 0xff, 0x7f, 0xf2,
-    0x0, 0x0, 0x6f, 0xf2, 0xff, 0x50, 0x0, 0x9,
-    0xfd, 0xf, 0xf8, 0x0, 0x0, 0xcf, 0xa0, 0xcf,
-    0xb0, 0x0, 0xf, 0xf7, 0xa, 0xff, 0x0, 0x3,
-    0xff, 0x50, 0x7f, 0xf2, 0x0, 0x6f, 0xf2, 0x4,
-    0xff, 0x50, 0x9, 0xff, 0x44, 0x6f, 0xf8, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0x3, 0xff, 0x70, 0x0, 0x9f, 0xf2,
-    0x6f, 0xf4, 0x0, 0x6, 0xff, 0x59, 0xff, 0x10,
-    0x0, 0x3f, 0xf8,
-
-    /* U+0042 "B" */
-    0xaf, 0xff, 0xfe, 0x92, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x20, 0xbf, 0xf8, 0x8d, 0xff, 0xc0, 0xbf,
-    0xf1, 0x0, 0xef, 0xf1, 0xbf, 0xf1, 0x0, 0x9f,
-    0xf3, 0xbf, 0xf1, 0x0, 0x8f, 0xf3, 0xbf, 0xf1,
-    0x0, 0xbf, 0xf1, 0xbf, 0xf3, 0x27, 0xff, 0xa0,
-    0xbf, 0xff, 0xff, 0xfc, 0x10, 0xbf, 0xff, 0xff,
-    0xfe, 0x20, 0xbf, 0xf1, 0x4, 0xff, 0xc0, 0xbf,
-    0xf1, 0x0, 0x9f, 0xf3, 0xbf, 0xf1, 0x0, 0x6f,
-    0xf5, 0xbf, 0xf1, 0x0, 0x6f, 0xf6, 0xbf, 0xf1,
-    0x0, 0xcf, 0xf4, 0xbf, 0xf9, 0x8c, 0xff, 0xe0,
-    0xbf, 0xff, 0xff, 0xff, 0x50, 0xaf, 0xff, 0xff,
-    0xb3, 0x0,
-
-    /* U+0043 "C" */
-    0x1, 0x9e, 0xfe, 0x91, 0x0, 0x1d, 0xff, 0xff,
-    0xfe, 0x10, 0x8f, 0xfd, 0x8d, 0xff, 0xa0, 0xdf,
-    0xf1, 0x0, 0xef, 0xf0, 0xff, 0xd0, 0x0, 0xcf,
-    0xf0, 0xff, 0xc0, 0x0, 0x46, 0x50, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x46,
-    0x50, 0xff, 0xd0, 0x0, 0xcf, 0xf0, 0xdf, 0xf1,
-    0x0, 0xef, 0xe0, 0x8f, 0xfd, 0x9d, 0xff, 0x90,
-    0xd, 0xff, 0xff, 0xfe, 0x10, 0x1, 0x9e, 0xfe,
-    0x91, 0x0,
-
-    /* U+0044 "D" */
-    0xaf, 0xff, 0xfe, 0xa2, 0x0, 0xbf, 0xff, 0xff,
-    0xfe, 0x20, 0xbf, 0xf8, 0x8c, 0xff, 0xb0, 0xbf,
-    0xf1, 0x0, 0xef, 0xf1, 0xbf, 0xf1, 0x0, 0xaf,
-    0xf3, 0xbf, 0xf1, 0x0, 0x9f, 0xf3, 0xbf, 0xf1,
-    0x0, 0x9f, 0xf3, 0xbf, 0xf1, 0x0, 0x9f, 0xf3,
-    0xbf, 0xf1, 0x0, 0x9f, 0xf3, 0xbf, 0xf1, 0x0,
-    0x9f, 0xf3, 0xbf, 0xf1, 0x0, 0x9f, 0xf3, 0xbf,
-    0xf1, 0x0, 0x9f, 0xf3, 0xbf, 0xf1, 0x0, 0x9f,
-    0xf3, 0xbf, 0xf1, 0x0, 0xaf, 0xf2, 0xbf, 0xf1,
-    0x0, 0xef, 0xf1, 0xbf, 0xf8, 0x8c, 0xff, 0xb0,
-    0xbf, 0xff, 0xff, 0xfe, 0x20, 0xaf, 0xff, 0xfe,
-    0xa2, 0x0,
-
-    /* U+0045 "E" */
-    0xaf, 0xff, 0xff, 0xff, 0xab, 0xff, 0xff, 0xff,
-    0xfa, 0xbf, 0xf8, 0x88, 0x88, 0x4b, 0xff, 0x10,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xb, 0xff,
-    0x10, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xb,
-    0xff, 0x10, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x80,
-    0xb, 0xff, 0xff, 0xf9, 0x0, 0xbf, 0xf9, 0x88,
-    0x40, 0xb, 0xff, 0x10, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0, 0xbf,
-    0xf1, 0x0, 0x0, 0xb, 0xff, 0x88, 0x88, 0x84,
-    0xbf, 0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff,
-    0xfa,
-
-    /* U+0046 "F" */
-    0xaf, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff,
-    0xfa, 0xbf, 0xf8, 0x88, 0x88, 0x4b, 0xff, 0x10,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xb, 0xff,
-    0x10, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xb,
-    0xff, 0x10, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x80,
-    0xb, 0xff, 0xff, 0xf8, 0x0, 0xbf, 0xf9, 0x88,
-    0x40, 0xb, 0xff, 0x10, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0, 0xbf,
-    0xf1, 0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0xa, 0xff, 0x0, 0x0,
-    0x0,
-
-    /* U+0047 "G" */
-    0x1, 0x9e, 0xfe, 0x91, 0x0, 0x1d, 0xff, 0xff,
-    0xfe, 0x10, 0x9f, 0xfd, 0x8d, 0xff, 0xa0, 0xef,
-    0xf1, 0x0, 0xef, 0xf0, 0xff, 0xc0, 0x0, 0xbf,
-    0xf1, 0xff, 0xc0, 0x0, 0x9e, 0xe0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x36, 0x66, 0x60, 0xff, 0xc0, 0x9f,
-    0xff, 0xf1, 0xff, 0xc0, 0x8f, 0xff, 0xf1, 0xff,
-    0xc0, 0x0, 0xbf, 0xf1, 0xff, 0xc0, 0x0, 0xbf,
-    0xf1, 0xff, 0xc0, 0x0, 0xbf, 0xf1, 0xdf, 0xf1,
-    0x0, 0xef, 0xf0, 0x9f, 0xfd, 0x8d, 0xff, 0xa0,
-    0x1d, 0xff, 0xff, 0xfe, 0x10, 0x1, 0x9e, 0xfe,
-    0x91, 0x0,
-
-    /* U+0048 "H" */
-    0xaf, 0xf0, 0x0, 0x9f, 0xf2, 0xbf, 0xf1, 0x0,
-    0xaf, 0xf2, 0xbf, 0xf1, 0x0, 0xaf, 0xf2, 0xbf,
-    0xf1, 0x0, 0xaf, 0xf2, 0xbf, 0xf1, 0x0, 0xaf,
-    0xf2, 0xbf, 0xf1, 0x0, 0xaf, 0xf2, 0xbf, 0xf1,
-    0x0, 0xaf, 0xf2, 0xbf, 0xf1, 0x0, 0xaf, 0xf2,
-    0xbf, 0xff, 0xff, 0xff, 0xf2, 0xbf, 0xff, 0xff,
-    0xff, 0xf2, 0xbf, 0xf9, 0x88, 0xdf, 0xf2, 0xbf,
-    0xf1, 0x0, 0xaf, 0xf2, 0xbf, 0xf1, 0x0, 0xaf,
-    0xf2, 0xbf, 0xf1, 0x0, 0xaf, 0xf2, 0xbf, 0xf1,
-    0x0, 0xaf, 0xf2, 0xbf, 0xf1, 0x0, 0xaf, 0xf2,
-    0xbf, 0xf1, 0x0, 0xaf, 0xf2, 0xaf, 0xf0, 0x0,
-    0x9f, 0xf2,
-
-    /* U+0049 "I" */
-    0xaf, 0xf0, 0xbf, 0xf1, 0xbf, 0xf1, 0xbf, 0xf1,
-    0xbf, 0xf1, 0xbf, 0xf1, 0xbf, 0xf1, 0xbf, 0xf1,
-    0xbf, 0xf1, 0xbf, 0xf1, 0xbf, 0xf1, 0xbf, 0xf1,
-    0xbf, 0xf1, 0xbf, 0xf1, 0xbf, 0xf1, 0xbf, 0xf1,
-    0xbf, 0xf1, 0xaf, 0xf0,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0,
-    0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0x7f,
-    0xf5, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0,
-    0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x6c,
-    0xc1, 0x0, 0x7f, 0xf5, 0x9f, 0xf3, 0x0, 0x7f,
-    0xf5, 0x9f, 0xf3, 0x0, 0x7f, 0xf4, 0x7f, 0xf6,
-    0x0, 0xbf, 0xf3, 0x2f, 0xff, 0x9b, 0xff, 0xe0,
-    0x8, 0xff, 0xff, 0xff, 0x40, 0x0, 0x6c, 0xff,
-    0xb3, 0x0,
-
-    /* U+004B "K" */
-    0xaf, 0xf0, 0x0, 0x4f, 0xfa, 0xb, 0xff, 0x10,
-    0xc, 0xff, 0x20, 0xbf, 0xf1, 0x4, 0xff, 0xa0,
-    0xb, 0xff, 0x10, 0xcf, 0xf3, 0x0, 0xbf, 0xf1,
-    0x4f, 0xfb, 0x0, 0xb, 0xff, 0x1c, 0xff, 0x30,
-    0x0, 0xbf, 0xf6, 0xff, 0xb0, 0x0, 0xb, 0xff,
-    0xef, 0xf3, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x60,
-    0x0, 0xb, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xbf,
-    0xfe, 0xcf, 0xf3, 0x0, 0xb, 0xff, 0x74, 0xff,
-    0x90, 0x0, 0xbf, 0xf1, 0xe, 0xff, 0x0, 0xb,
-    0xff, 0x10, 0x8f, 0xf6, 0x0, 0xbf, 0xf1, 0x2,
-    0xff, 0xc0, 0xb, 0xff, 0x10, 0xc, 0xff, 0x20,
-    0xbf, 0xf1, 0x0, 0x6f, 0xf9, 0xa, 0xff, 0x0,
-    0x0, 0xef, 0xe0,
-
-    /* U+004C "L" */
-    0xaf, 0xf0, 0x0, 0x0, 0xb, 0xff, 0x10, 0x0,
-    0x0, 0xbf, 0xf1, 0x0, 0x0, 0xb, 0xff, 0x10,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xb, 0xff,
-    0x10, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xb,
-    0xff, 0x10, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0xb, 0xff, 0x10, 0x0, 0x0, 0xbf, 0xf1, 0x0,
-    0x0, 0xb, 0xff, 0x10, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0, 0xbf,
-    0xf1, 0x0, 0x0, 0xb, 0xff, 0x88, 0x88, 0x84,
-    0xbf, 0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff,
-    0xfa,
-
-    /* U+004D "M" */
-    0xcf, 0xf3, 0x0, 0x5, 0xff, 0xac, 0xff, 0xc0,
-    0x0, 0xdf, 0xfb, 0xcf, 0xff, 0x40, 0x5f, 0xff,
-    0xbc, 0xff, 0xfd, 0xd, 0xff, 0xfb, 0xcf, 0xff,
-    0xfb, 0xff, 0xff, 0xbc, 0xff, 0xdf, 0xff, 0xdf,
-    0xfb, 0xcf, 0xf5, 0xff, 0xf5, 0xff, 0xbc, 0xff,
-    0xd, 0xfb, 0x1f, 0xfb, 0xcf, 0xf0, 0x5f, 0x31,
-    0xff, 0xbc, 0xff, 0x0, 0x70, 0x1f, 0xfb, 0xcf,
-    0xf0, 0x0, 0x1, 0xff, 0xbc, 0xff, 0x0, 0x0,
-    0x1f, 0xfb, 0xcf, 0xf0, 0x0, 0x1, 0xff, 0xbc,
-    0xff, 0x0, 0x0, 0x1f, 0xfb, 0xcf, 0xf0, 0x0,
-    0x1, 0xff, 0xbc, 0xff, 0x0, 0x0, 0x1f, 0xfb,
-    0xcf, 0xf0, 0x0, 0x1, 0xff, 0xbc, 0xff, 0x0,
-    0x0, 0x1f, 0xfa,
-
-    /* U+004E "N" */
-    0xaf, 0xf6, 0x0, 0xd, 0xfd, 0xbf, 0xfc, 0x0,
-    0xe, 0xfe, 0xbf, 0xff, 0x10, 0xe, 0xfe, 0xbf,
-    0xff, 0x70, 0xe, 0xfe, 0xbf, 0xff, 0xc0, 0xe,
-    0xfe, 0xbf, 0xff, 0xf1, 0xe, 0xfe, 0xbf, 0xff,
-    0xf7, 0xe, 0xfe, 0xbf, 0xfa, 0xfc, 0xe, 0xfe,
-    0xbf, 0xf5, 0xff, 0x1e, 0xfe, 0xbf, 0xf0, 0xef,
-    0x7e, 0xfe, 0xbf, 0xf0, 0xaf, 0xce, 0xfe, 0xbf,
-    0xf0, 0x4f, 0xff, 0xfe, 0xbf, 0xf0, 0xf, 0xff,
-    0xfe, 0xbf, 0xf0, 0xa, 0xff, 0xfe, 0xbf, 0xf0,
-    0x5, 0xff, 0xfe, 0xbf, 0xf0, 0x0, 0xff, 0xfe,
-    0xbf, 0xf0, 0x0, 0xaf, 0xfe, 0xaf, 0xf0, 0x0,
-    0x4f, 0xfd,
-
-    /* U+004F "O" */
-    0x0, 0x8d, 0xfe, 0x91, 0x0, 0xd, 0xff, 0xff,
-    0xfe, 0x20, 0x8f, 0xfd, 0x8c, 0xff, 0xb0, 0xdf,
-    0xf1, 0x0, 0xdf, 0xf0, 0xff, 0xd0, 0x0, 0x9f,
-    0xf2, 0xff, 0xc0, 0x0, 0x9f, 0xf3, 0xff, 0xc0,
-    0x0, 0x9f, 0xf3, 0xff, 0xc0, 0x0, 0x9f, 0xf3,
-    0xff, 0xc0, 0x0, 0x9f, 0xf3, 0xff, 0xc0, 0x0,
-    0x9f, 0xf3, 0xff, 0xc0, 0x0, 0x9f, 0xf3, 0xff,
-    0xc0, 0x0, 0x9f, 0xf3, 0xff, 0xc0, 0x0, 0x9f,
-    0xf3, 0xff, 0xd0, 0x0, 0x9f, 0xf2, 0xdf, 0xf1,
-    0x0, 0xdf, 0xf0, 0x8f, 0xfd, 0x9c, 0xff, 0xb0,
-    0xd, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x8d, 0xfe,
-    0x91, 0x0,
-
-    /* U+0050 "P" */
-    0xbf, 0xff, 0xff, 0xb3, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x30, 0xbf, 0xf8, 0x8c, 0xff, 0xc0, 0xbf,
-    0xf1, 0x0, 0xdf, 0xf2, 0xbf, 0xf1, 0x0, 0x8f,
-    0xf4, 0xbf, 0xf1, 0x0, 0x7f, 0xf5, 0xbf, 0xf1,
-    0x0, 0xaf, 0xf4, 0xbf, 0xf1, 0x4, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xff, 0x70, 0xbf, 0xff, 0xff,
-    0xf8, 0x0, 0xbf, 0xf5, 0x44, 0x10, 0x0, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0,
-    0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x1, 0x9e, 0xfd, 0x80, 0x0, 0xdf, 0xff, 0xff,
-    0xc0, 0x8f, 0xfd, 0x8d, 0xff, 0x6d, 0xff, 0x10,
-    0x2f, 0xfc, 0xff, 0xd0, 0x0, 0xef, 0xef, 0xfc,
-    0x0, 0xe, 0xfe, 0xff, 0xc0, 0x0, 0xef, 0xef,
-    0xfc, 0x0, 0xe, 0xfe, 0xff, 0xc0, 0x0, 0xef,
-    0xef, 0xfc, 0x0, 0xe, 0xfe, 0xff, 0xc0, 0x0,
-    0xef, 0xef, 0xfc, 0x0, 0xe, 0xfe, 0xff, 0xc0,
-    0x0, 0xef, 0xee, 0xfd, 0x0, 0xf, 0xfd, 0xbf,
-    0xf5, 0x6, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xf3,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x2, 0xff, 0xe1,
-    0x0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0x0, 0xef,
-    0xd0, 0x0,
-
-    /* U+0052 "R" */
-    0xaf, 0xff, 0xff, 0xb3, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x30, 0xbf, 0xf8, 0x8c, 0xff, 0xc0, 0xbf,
-    0xf1, 0x0, 0xdf, 0xf2, 0xbf, 0xf1, 0x0, 0x7f,
-    0xf5, 0xbf, 0xf1, 0x0, 0x6f, 0xf5, 0xbf, 0xf1,
-    0x0, 0x9f, 0xf4, 0xbf, 0xf1, 0x4, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xff, 0x70, 0xbf, 0xff, 0xff,
-    0xf8, 0x0, 0xbf, 0xf5, 0x8f, 0xf5, 0x0, 0xbf,
-    0xf1, 0x1f, 0xf9, 0x0, 0xbf, 0xf1, 0xd, 0xfe,
-    0x0, 0xbf, 0xf1, 0x8, 0xff, 0x30, 0xbf, 0xf1,
-    0x4, 0xff, 0x80, 0xbf, 0xf1, 0x0, 0xff, 0xd0,
-    0xbf, 0xf1, 0x0, 0xbf, 0xf2, 0xaf, 0xf0, 0x0,
-    0x6f, 0xf6,
-
-    /* U+0053 "S" */
-    0x0, 0x3b, 0xff, 0xc5, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x70, 0xd, 0xff, 0xb9, 0xff, 0xf2, 0x2f,
-    0xfb, 0x0, 0x6f, 0xf7, 0x3f, 0xf8, 0x0, 0x2f,
-    0xf8, 0x2f, 0xfb, 0x0, 0x19, 0xa5, 0xd, 0xff,
-    0x60, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xb1, 0x0, 0x0, 0x6, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xc0, 0x0,
-    0x0, 0x1, 0xef, 0xf5, 0x17, 0x84, 0x0, 0x4f,
-    0xfa, 0x2f, 0xf9, 0x0, 0x1f, 0xfa, 0x1f, 0xfd,
-    0x0, 0x5f, 0xf8, 0xc, 0xff, 0xc9, 0xff, 0xf3,
-    0x3, 0xff, 0xff, 0xff, 0x90, 0x0, 0x2a, 0xef,
-    0xd6, 0x0,
-
-    /* U+0054 "T" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x28, 0x88, 0xff, 0xe8, 0x87,
-    0x10, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf,
-    0xfb, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xcf, 0xf0, 0x0, 0x7f, 0xf3, 0xcf, 0xf0, 0x0,
-    0x8f, 0xf4, 0xcf, 0xf0, 0x0, 0x8f, 0xf4, 0xcf,
-    0xf0, 0x0, 0x8f, 0xf4, 0xcf, 0xf0, 0x0, 0x8f,
-    0xf4, 0xcf, 0xf0, 0x0, 0x8f, 0xf4, 0xcf, 0xf0,
-    0x0, 0x8f, 0xf4, 0xcf, 0xf0, 0x0, 0x8f, 0xf4,
-    0xcf, 0xf0, 0x0, 0x8f, 0xf4, 0xcf, 0xf0, 0x0,
-    0x8f, 0xf4, 0xcf, 0xf0, 0x0, 0x8f, 0xf4, 0xcf,
-    0xf0, 0x0, 0x8f, 0xf4, 0xcf, 0xf0, 0x0, 0x8f,
-    0xf4, 0xcf, 0xf0, 0x0, 0x8f, 0xf3, 0x9f, 0xf4,
-    0x0, 0xdf, 0xf1, 0x3f, 0xff, 0x9c, 0xff, 0xb0,
-    0x9, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x6d, 0xfe,
-    0xa2, 0x0,
-
-    /* U+0056 "V" */
-    0x4f, 0xfa, 0x0, 0x4, 0xff, 0x91, 0xff, 0xd0,
-    0x0, 0x7f, 0xf6, 0xe, 0xff, 0x0, 0x9, 0xff,
-    0x30, 0xbf, 0xf2, 0x0, 0xcf, 0xf0, 0x8, 0xff,
-    0x50, 0xe, 0xfc, 0x0, 0x4f, 0xf7, 0x1, 0xff,
-    0x90, 0x1, 0xff, 0xa0, 0x4f, 0xf6, 0x0, 0xe,
-    0xfc, 0x6, 0xff, 0x30, 0x0, 0xbf, 0xf0, 0x9f,
-    0xf0, 0x0, 0x8, 0xff, 0x2b, 0xfc, 0x0, 0x0,
-    0x5f, 0xf4, 0xef, 0x90, 0x0, 0x1, 0xff, 0x7f,
-    0xf6, 0x0, 0x0, 0xe, 0xfd, 0xff, 0x30, 0x0,
-    0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0, 0x8, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x90, 0x0,
-    0x0, 0x2, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x30, 0x0,
-
-    /* U+0057 "W" */
-    0x6f, 0xf7, 0x0, 0x4f, 0xf5, 0x0, 0x6f, 0xf5,
-    0x3f, 0xfa, 0x0, 0x6f, 0xf7, 0x0, 0x9f, 0xf3,
-    0xf, 0xfc, 0x0, 0x8f, 0xfa, 0x0, 0xbf, 0xf0,
-    0xd, 0xff, 0x0, 0xbf, 0xfc, 0x0, 0xdf, 0xd0,
-    0xa, 0xff, 0x10, 0xdf, 0xff, 0x0, 0xff, 0xa0,
-    0x7, 0xff, 0x40, 0xff, 0xff, 0x12, 0xff, 0x70,
-    0x4, 0xff, 0x61, 0xff, 0xff, 0x44, 0xff, 0x50,
-    0x1, 0xff, 0x94, 0xfe, 0xdf, 0x66, 0xff, 0x20,
-    0x0, 0xef, 0xb6, 0xfb, 0xbf, 0x88, 0xff, 0x0,
-    0x0, 0xbf, 0xe8, 0xf9, 0x8f, 0xbb, 0xfc, 0x0,
-    0x0, 0x8f, 0xfb, 0xf7, 0x6f, 0xdd, 0xf9, 0x0,
-    0x0, 0x6f, 0xff, 0xf5, 0x3f, 0xff, 0xf7, 0x0,
-    0x0, 0x3f, 0xff, 0xf2, 0x1f, 0xff, 0xf4, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0xe, 0xff, 0xf1, 0x0,
-    0x0, 0xd, 0xff, 0xe0, 0xc, 0xff, 0xe0, 0x0,
-    0x0, 0xa, 0xff, 0xc0, 0xa, 0xff, 0xb0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x7, 0xff, 0x90, 0x0,
-    0x0, 0x4, 0xff, 0x70, 0x5, 0xff, 0x60, 0x0,
-
-    /* U+0058 "X" */
-    0x2f, 0xf9, 0x0, 0x8, 0xff, 0x30, 0xdf, 0xf0,
-    0x0, 0xef, 0xd0, 0x6, 0xff, 0x50, 0x4f, 0xf7,
-    0x0, 0x1f, 0xfa, 0x9, 0xff, 0x10, 0x0, 0xaf,
-    0xf0, 0xef, 0xb0, 0x0, 0x4, 0xff, 0xaf, 0xf5,
-    0x0, 0x0, 0xe, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x80, 0x0, 0x0, 0x2, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0,
-    0x8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xe0, 0x0, 0x0, 0x4f, 0xfa, 0xff, 0x50, 0x0,
-    0xa, 0xff, 0x1e, 0xfb, 0x0, 0x1, 0xff, 0xa0,
-    0x9f, 0xf1, 0x0, 0x6f, 0xf5, 0x4, 0xff, 0x70,
-    0xd, 0xff, 0x0, 0xe, 0xfd, 0x2, 0xff, 0x90,
-    0x0, 0x8f, 0xf3,
-
-    /* U+0059 "Y" */
-    0x3f, 0xfa, 0x0, 0xb, 0xff, 0x20, 0xef, 0xe0,
-    0x0, 0xff, 0xd0, 0x9, 0xff, 0x30, 0x4f, 0xf8,
-    0x0, 0x4f, 0xf7, 0x8, 0xff, 0x30, 0x0, 0xef,
-    0xc0, 0xcf, 0xd0, 0x0, 0x9, 0xff, 0x2f, 0xf8,
-    0x0, 0x0, 0x4f, 0xfa, 0xff, 0x30, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xe, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xd0, 0x0, 0x0,
-    0x0, 0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xd0, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0xe,
-    0xfd, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x6f, 0xff, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff,
-    0xff, 0xf0, 0x28, 0x88, 0x88, 0xff, 0xf0, 0x0,
-    0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff,
-    0x30, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0,
-    0x0, 0x6, 0xff, 0x70, 0x0, 0x0, 0xd, 0xff,
-    0x10, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
-    0xbf, 0xf3, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0,
-    0x0, 0x8, 0xff, 0x60, 0x0, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x5f, 0xfd, 0x88, 0x88, 0x70,
-    0x6f, 0xff, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff,
-    0xff, 0xf0,
-
-    /* U+005B "[" */
-    0x28, 0x88, 0x85, 0x5f, 0xff, 0xfb, 0x5f, 0xff,
-    0xfa, 0x5f, 0xf7, 0x0, 0x5f, 0xf7, 0x0, 0x5f,
-    0xf7, 0x0, 0x5f, 0xf7, 0x0, 0x5f, 0xf7, 0x0,
-    0x5f, 0xf7, 0x0, 0x5f, 0xf7, 0x0, 0x5f, 0xf7,
-    0x0, 0x5f, 0xf7, 0x0, 0x5f, 0xf7, 0x0, 0x5f,
-    0xf7, 0x0, 0x5f, 0xf7, 0x0, 0x5f, 0xf7, 0x0,
-    0x5f, 0xf7, 0x0, 0x5f, 0xf7, 0x0, 0x5f, 0xf7,
-    0x0, 0x5f, 0xf7, 0x0, 0x5f, 0xf7, 0x0, 0x5f,
-    0xfb, 0x85, 0x5f, 0xff, 0xfb, 0x5f, 0xff, 0xfa,
-
-    /* U+005C "\\" */
-    0xdf, 0xe0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x4f, 0xf7, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0xb, 0xff, 0x10, 0x0, 0x7, 0xff, 0x50, 0x0,
-    0x2, 0xff, 0xa0, 0x0, 0x0, 0xdf, 0xe0, 0x0,
-    0x0, 0x9f, 0xf3, 0x0, 0x0, 0x4f, 0xf7, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0xb, 0xff, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0x0, 0x2, 0xff, 0x90,
-    0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x9f, 0xf2,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0xf, 0xfb,
-
-    /* U+005D "]" */
-    0x58, 0x88, 0x71, 0xcf, 0xff, 0xf4, 0xbf, 0xff,
-    0xf4, 0x0, 0x8f, 0xf4, 0x0, 0x8f, 0xf4, 0x0,
-    0x8f, 0xf4, 0x0, 0x8f, 0xf4, 0x0, 0x8f, 0xf4,
-    0x0, 0x8f, 0xf4, 0x0, 0x8f, 0xf4, 0x0, 0x8f,
-    0xf4, 0x0, 0x8f, 0xf4, 0x0, 0x8f, 0xf4, 0x0,
-    0x8f, 0xf4, 0x0, 0x8f, 0xf4, 0x0, 0x8f, 0xf4,
-    0x0, 0x8f, 0xf4, 0x0, 0x8f, 0xf4, 0x0, 0x8f,
-    0xf4, 0x0, 0x8f, 0xf4, 0x0, 0x8f, 0xf4, 0x68,
-    0xcf, 0xf4, 0xcf, 0xff, 0xf4, 0xbf, 0xff, 0xf3,
-
-    /* U+005E "^" */
-    0x0, 0x5, 0xff, 0x30, 0x0, 0x0, 0xb, 0xff,
-    0x90, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x5f, 0xde, 0xf3, 0x0, 0x0, 0xaf, 0x9a, 0xf8,
-    0x0, 0x0, 0xef, 0x45, 0xfd, 0x0, 0x4, 0xff,
-    0x1, 0xff, 0x20, 0x9, 0xfb, 0x0, 0xcf, 0x70,
-    0xe, 0xf6, 0x0, 0x8f, 0xc0, 0x2f, 0xf2, 0x0,
-    0x3f, 0xf1,
-
-    /* U+005F "_" */
-    0x13, 0x33, 0x33, 0x33, 0x30, 0x9f, 0xff, 0xff,
-    0xff, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+0060 "`" */
-    0x2, 0x10, 0x3, 0xff, 0x20, 0x8, 0xfb, 0x0,
-    0xc, 0xf3,
-
-    /* U+00B0 "°" */
-    0x0, 0x8e, 0xfc, 0x40, 0x0, 0xbf, 0xff, 0xff,
-    0x50, 0x4f, 0xd1, 0x5, 0xfe, 0x8, 0xf5, 0x0,
-    0xb, 0xf2, 0x8f, 0x50, 0x0, 0xcf, 0x24, 0xfd,
-    0x20, 0x6f, 0xe0, 0xb, 0xff, 0xff, 0xf5, 0x0,
-    0x8, 0xef, 0xc4, 0x0
+    0x6, 0x70, 0x7f, 0xf9, 0x9f, 0xfb, 0x2d, 0xe3
 };
 
 
@@ -830,72 +185,18 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
 
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 103, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36, .adv_w = 118, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 57, .adv_w = 233, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 168, .adv_w = 167, .box_w = 10, .box_h = 22, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 278, .adv_w = 296, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 431, .adv_w = 223, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 557, .adv_w = 58, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 569, .adv_w = 107, .box_w = 6, .box_h = 22, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 635, .adv_w = 107, .box_w = 6, .box_h = 22, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 701, .adv_w = 139, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 742, .adv_w = 169, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 792, .adv_w = 76, .box_w = 4, .box_h = 7, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 806, .adv_w = 125, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 818, .adv_w = 81, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 828, .adv_w = 148, .box_w = 9, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 909, .adv_w = 173, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 999, .adv_w = 105, .box_w = 6, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1053, .adv_w = 163, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1143, .adv_w = 164, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1233, .adv_w = 176, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1332, .adv_w = 164, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1422, .adv_w = 165, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1512, .adv_w = 151, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1602, .adv_w = 167, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1692, .adv_w = 162, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1782, .adv_w = 97, .box_w = 4, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1806, .adv_w = 84, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1841, .adv_w = 169, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 1901, .adv_w = 169, .box_w = 10, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 1936, .adv_w = 169, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 1996, .adv_w = 159, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2086, .adv_w = 291, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2248, .adv_w = 175, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2347, .adv_w = 177, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2437, .adv_w = 175, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2527, .adv_w = 181, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2617, .adv_w = 167, .box_w = 9, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2698, .adv_w = 159, .box_w = 9, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2779, .adv_w = 177, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2869, .adv_w = 183, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2959, .adv_w = 86, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2995, .adv_w = 170, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3085, .adv_w = 183, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3184, .adv_w = 159, .box_w = 9, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3265, .adv_w = 207, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3364, .adv_w = 195, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3454, .adv_w = 179, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3544, .adv_w = 175, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3634, .adv_w = 175, .box_w = 9, .box_h = 20, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3724, .adv_w = 177, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3814, .adv_w = 167, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3904, .adv_w = 174, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4003, .adv_w = 184, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4093, .adv_w = 181, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4192, .adv_w = 255, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4336, .adv_w = 177, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4435, .adv_w = 175, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4534, .adv_w = 156, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4624, .adv_w = 127, .box_w = 6, .box_h = 24, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4696, .adv_w = 148, .box_w = 8, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4768, .adv_w = 127, .box_w = 6, .box_h = 24, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 4840, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 4890, .adv_w = 156, .box_w = 10, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4905, .adv_w = 79, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 14},
-    {.bitmap_index = 4915, .adv_w = 138, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 12}
+    {.bitmap_index = 0, .adv_w = 125, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 12, .adv_w = 173, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 102, .adv_w = 105, .box_w = 6, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 156, .adv_w = 163, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 246, .adv_w = 164, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 336, .adv_w = 176, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 435, .adv_w = 164, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 525, .adv_w = 165, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 615, .adv_w = 151, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 705, .adv_w = 167, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 795, .adv_w = 162, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 885, .adv_w = 97, .box_w = 4, .box_h = 12, .ofs_x = 1, .ofs_y = 0}
 };
 
 /*---------------------
@@ -908,11 +209,11 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 65, .glyph_id_start = 1,
+        .range_start = 45, .range_length = 1, .glyph_id_start = 1,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 176, .range_length = 1, .glyph_id_start = 66,
+        .range_start = 48, .range_length = 11, .glyph_id_start = 2,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -925,113 +226,26 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 /*Map glyph_ids to kern left classes*/
 static const uint8_t kern_left_class_mapping[] =
 {
-    0, 0, 0, 1, 0, 0, 0, 0,
-    1, 0, 0, 0, 2, 3, 4, 3,
-    5, 0, 6, 7, 8, 9, 10, 11,
-    12, 13, 13, 0, 0, 0, 0, 0,
-    0, 0, 14, 15, 16, 15, 17, 18,
-    16, 19, 0, 20, 21, 22, 0, 0,
-    16, 23, 24, 25, 26, 27, 20, 28,
-    28, 29, 30, 0, 0, 0, 0, 0,
-    0, 0, 0
+    0, 1, 0, 2, 3, 4, 5, 6,
+    7, 8, 9, 9, 0
 };
 
 /*Map glyph_ids to kern right classes*/
 static const uint8_t kern_right_class_mapping[] =
 {
-    0, 0, 0, 1, 0, 0, 0, 0,
-    1, 0, 0, 0, 0, 2, 3, 2,
-    4, 5, 6, 7, 0, 0, 0, 0,
-    8, 0, 0, 0, 0, 0, 0, 0,
-    9, 0, 10, 11, 12, 11, 11, 11,
-    12, 0, 0, 13, 14, 15, 0, 11,
-    12, 11, 12, 16, 17, 18, 0, 19,
-    19, 20, 21, 0, 0, 0, 0, 0,
-    0, 0, 0
+    0, 1, 2, 3, 4, 0, 0, 0,
+    0, 5, 0, 0, 0
 };
 
 /*Kern values between classes*/
 static const int8_t kern_class_values[] =
 {
-    0, 0, -9, 0, 0, 0, 0, 0,
-    0, -17, 0, 0, -20, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, -11, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -15, 0,
-    0, -12, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -21, 0,
-    0, 0, 0, 0, 0, -28, -4, -11,
-    0, -5, -7, -3, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -8, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -10, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -20, 0, -20,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -5, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -19, 0, -30, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -8, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -17, 0, -1, 3, 0, 0, 0,
-    0, 0, 8, 0, -6, 1, 0, 0,
-    0, -9, -23, -26, 2, -18, 0, -3,
-    0, -2, 0, 0, 0, 0, 0, -8,
-    -2, 0, 0, -2, 0, 0, 0, 0,
-    -8, -8, -10, 0, -2, -3, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -4, -4,
-    0, 0, -2, 1, 0, 0, 0, 0,
-    0, 7, 0, 0, 5, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -12,
-    -18, 0, 0, 0, 0, 0, -14, 0,
-    0, -3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, -5, 0, 0, 0, 0, 0,
-    -4, -3, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 3, 0, 3,
-    0, 0, 0, 0, 0, 5, 0, -6,
-    0, 0, 0, 0, -7, 0, 0, 0,
-    0, 0, 3, 0, 3, 0, 0, 0,
-    0, -4, 10, 0, -1, 0, 0, 0,
-    0, -1, -29, 0, 0, -12, 0, -10,
-    0, -22, 0, 0, 0, 0, 0, -12,
-    0, 0, -17, 0, 0, 0, 0, 0,
-    -4, -7, -7, 0, -2, -3, 0, 0,
-    0, 0, 0, 4, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, -4,
-    0, 0, 0, 3, 0, 0, 0, 0,
-    0, 3, 0, 0, 0, 0, 0, 0,
-    2, 0, 0, 0, -8, 0, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    0, 0, 0, 0, 0, 0, -3, -5,
-    -10, -9, 0, -17, -24, -5, 0, 0,
-    0, 0, 9, -18, 0, -9, 0, 0,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    -12, -17, -17, 0, 0, 0, 0, 0,
-    -25, 0, -5, -11, 0, 0, -2, -5,
-    0, 0, 0, 0, 0, 2, -4, 0,
-    0, 0, 0, 0, 0, 2, 0, -5,
-    -2, 0, 0, 0, -10, 0, 0, 0,
-    0, 0, -26, -20, -17, 0, 0, 0,
-    0, 0, -24, -5, -7, -17, 0, -2,
-    -2, -8, 0, 0, 0, 0
+    0, 0, 0, 0, 0, 0, 0, -5,
+    1, 0, 0, 0, -8, 0, 0, 0,
+    0, -10, 0, 0, 0, 0, -20, 0,
+    -20, 0, 0, -5, 0, 0, 0, 0,
+    -7, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, -8, 0, 0
 };
 
 
@@ -1041,8 +255,8 @@ static const lv_font_fmt_txt_kern_classes_t kern_classes =
     .class_pair_values   = kern_class_values,
     .left_class_mapping  = kern_left_class_mapping,
     .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 30,
-    .right_class_cnt     = 21,
+    .left_class_cnt      = 9,
+    .right_class_cnt     = 5,
 };
 
 /*--------------------
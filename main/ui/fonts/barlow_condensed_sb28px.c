@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 28 px
  * Bpp: 1
- * Opts: --bpp 1 --size 28 --no-compress --stride 1 --align 1 --font BarlowCondensed-SemiBold.ttf --range 32-90,176 --format lvgl -o barlow_condensed_sb28px.c
+ * Opts: --bpp 1 --size 28 --no-compress --stride 1 --align 1 --font BarlowCondensed-SemiBold.ttf --range 45-46,48-57,67,176 --format lvgl -o barlow_condensed_sb28px.c
  ******************************************************************************/
 
 #ifdef __has_include
@@ -32,77 +32,12 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((aligned(4))) = {
-    /* U+0020 " " */
-    0x0,
-
-    /* U+0021 "!" */
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe0, 0x0,
-    0x6f, 0xf6,
-
-    /* U+0022 "\"" */
-    0xef, 0xdf, 0xbf, 0x7e, 0xfd, 0xc0,
-
-    /* U+0023 "#" */
-    0xe, 0x1c, 0x1c, 0x78, 0x38, 0xf0, 0xf1, 0xc1,
-    0xe3, 0x8f, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x1c,
-    0x78, 0x38, 0xf0, 0xf1, 0xc1, 0xe3, 0x8f, 0xff,
-    0xdf, 0xff, 0xbf, 0xff, 0x1c, 0x78, 0x38, 0xf0,
-    0xf1, 0xc1, 0xe3, 0x83, 0x87, 0x0,
-
-    /* U+0024 "$" */
-    0xe, 0x3, 0x81, 0xe0, 0xfe, 0x7f, 0xbc, 0xfe,
-    0x1f, 0x87, 0xe1, 0xfc, 0x7, 0x81, 0xf0, 0x3e,
-    0x3, 0xc0, 0x78, 0xf, 0x1, 0xf8, 0x7e, 0x1f,
-    0xcf, 0x7f, 0x9f, 0xe1, 0xf0, 0x38, 0xe, 0x0,
-
-    /* U+0025 "%" */
-    0x3c, 0x7, 0xf, 0xc0, 0xc3, 0x9c, 0x38, 0x61,
-    0x86, 0xc, 0x31, 0x81, 0xce, 0x30, 0x1f, 0x8c,
-    0x1, 0xe3, 0x80, 0x0, 0x60, 0x0, 0x1c, 0x0,
-    0x3, 0x0, 0x0, 0xe7, 0x80, 0x19, 0xfc, 0x7,
-    0x71, 0xc0, 0xcc, 0x18, 0x39, 0x83, 0x6, 0x30,
-    0x61, 0xc7, 0x1c, 0x30, 0x7f, 0xc, 0x7, 0xc0,
-
-    /* U+0026 "&" */
-    0x1f, 0x0, 0x7f, 0x81, 0xff, 0x3, 0xcf, 0x7,
-    0xe, 0xe, 0x1c, 0x1e, 0x78, 0x1d, 0xe0, 0x3f,
-    0xc0, 0x3f, 0x0, 0xfc, 0x3, 0xfc, 0x47, 0x39,
-    0xdc, 0x7b, 0xb8, 0x7e, 0x70, 0x7c, 0xf0, 0xf1,
-    0xff, 0xf1, 0xff, 0xf0, 0xf8, 0xe0,
-
-    /* U+0027 "'" */
-    0xff, 0xff, 0xc0,
-
-    /* U+0028 "(" */
-    0x39, 0xce, 0xe7, 0x39, 0xdc, 0xe7, 0x39, 0xce,
-    0x73, 0x9c, 0xe7, 0x3c, 0xe7, 0x39, 0xe7, 0x38,
-
-    /* U+0029 ")" */
-    0xe7, 0x3c, 0xe7, 0x39, 0xe7, 0x39, 0xce, 0x73,
-    0x9c, 0xe7, 0x39, 0xdc, 0xe7, 0x3b, 0x9c, 0xe0,
-
-    /* U+002A "*" */
-    0xc, 0x3, 0x6, 0xd9, 0xfe, 0x3f, 0xf, 0xc7,
-    0xf9, 0xb6, 0xc, 0x3, 0x0,
-
-    /* U+002B "+" */
-    0xe, 0x1, 0xc0, 0x38, 0x7, 0xf, 0xff, 0xff,
-    0xff, 0xf8, 0x70, 0xe, 0x1, 0xc0, 0x38, 0x0,
-
-    /* U+002C "," */
-    0x66, 0xee, 0xec, 0xc0,
-
     /* U+002D "-" */
     0xff, 0xff, 0xff,
 
     /* U+002E "." */
     0x6f, 0xf6,
 
-    /* U+002F "/" */
-    0x7, 0x83, 0x81, 0xc1, 0xe0, 0xe0, 0x70, 0x78,
-    0x38, 0x1c, 0xe, 0xf, 0x7, 0x3, 0x83, 0xc1,
-    0xc0, 0xe0, 0x70, 0x70, 0x38, 0x1c, 0x0,
-
     /* U+0030 "0" */
     0x1e, 0x1f, 0xe7, 0xfb, 0xcf, 0xe1, 0xf8, 0x7e,
     0x1f, 0x87, 0xe1, 0xf8, 0x7e, 0x1f, 0x87, 0xe1,
@@ -161,196 +96,12 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0xc0, 0x7e, 0x1f, 0x87, 0xf3, 0xff, 0xe7, 0xf8,
     0xf8,
 
-    /* U+003A ":" */
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0xf6,
-
-    /* U+003B ";" */
-    0x6f, 0xf6, 0x0, 0x0, 0x7, 0x6e, 0xee, 0xec,
-
-    /* U+003C "<" */
-    0x0, 0x20, 0x1c, 0xf, 0x87, 0xf3, 0xf1, 0xf8,
-    0x3c, 0x7, 0xc0, 0xfe, 0x3, 0xf0, 0x1f, 0x80,
-    0xf0, 0x6,
-
-    /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff,
-
-    /* U+003E ">" */
-    0x80, 0x1c, 0x3, 0xe0, 0x7f, 0x1, 0xf8, 0xf,
-    0xc0, 0x78, 0x1f, 0xf, 0xe7, 0xe3, 0xf0, 0x78,
-    0xc, 0x0,
-
-    /* U+003F "?" */
-    0x1e, 0x1f, 0xe7, 0xfb, 0xcf, 0xe1, 0xf8, 0x70,
-    0x1c, 0xf, 0x7, 0x83, 0xc1, 0xe0, 0x70, 0x1c,
-    0x7, 0x0, 0x0, 0x0, 0xc, 0x7, 0x81, 0xe0,
-    0x30,
-
-    /* U+0040 "@" */
-    0x0, 0xfc, 0x0, 0xff, 0xe0, 0x3c, 0x1e, 0xf,
-    0x1, 0xe3, 0xc0, 0x1c, 0x71, 0xf3, 0xdc, 0x7e,
-    0x3b, 0x8c, 0xc7, 0xf3, 0x98, 0xfc, 0x62, 0x1f,
-    0x8c, 0x43, 0xf1, 0x88, 0x7e, 0x33, 0x1d, 0xc6,
-    0x73, 0xb8, 0xff, 0xe7, 0x8e, 0x78, 0x70, 0x0,
-    0xf, 0x0, 0x0, 0xf0, 0x60, 0xf, 0xfc, 0x0,
-    0x7e, 0x0,
-
-    /* U+0041 "A" */
-    0xf, 0x0, 0xf0, 0xf, 0x1, 0xf8, 0x1f, 0x81,
-    0xf8, 0x1f, 0x81, 0x98, 0x39, 0xc3, 0x9c, 0x39,
-    0xc3, 0x9c, 0x39, 0xc7, 0xe, 0x7f, 0xe7, 0xfe,
-    0x7f, 0xef, 0xf, 0xe0, 0xfe, 0x7,
-
-    /* U+0042 "B" */
-    0xfe, 0x3f, 0xef, 0xfb, 0x8f, 0xe1, 0xf8, 0x7e,
-    0x1f, 0x8f, 0xff, 0xbf, 0xcf, 0xfb, 0x8e, 0xe1,
-    0xf8, 0x7e, 0x1f, 0x87, 0xe3, 0xff, 0xef, 0xfb,
-    0xf8,
-
     /* U+0043 "C" */
     0x1e, 0x1f, 0xe7, 0xfb, 0xcf, 0xe1, 0xf8, 0x7e,
     0x3, 0x80, 0xe0, 0x38, 0xe, 0x3, 0x80, 0xe0,
     0x38, 0xe, 0x1f, 0x87, 0xf3, 0xdf, 0xe7, 0xf8,
     0x78,
 
-    /* U+0044 "D" */
-    0xfe, 0x3f, 0xef, 0xfb, 0x8f, 0xe1, 0xf8, 0x7e,
-    0x1f, 0x87, 0xe1, 0xf8, 0x7e, 0x1f, 0x87, 0xe1,
-    0xf8, 0x7e, 0x1f, 0x87, 0xe3, 0xff, 0xef, 0xfb,
-    0xf8,
-
-    /* U+0045 "E" */
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xe0, 0x38, 0xe,
-    0x3, 0x80, 0xff, 0x3f, 0xcf, 0xf3, 0x80, 0xe0,
-    0x38, 0xe, 0x3, 0x80, 0xe0, 0x3f, 0xff, 0xff,
-    0xff,
-
-    /* U+0046 "F" */
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xe0, 0x38, 0xe,
-    0x3, 0x80, 0xff, 0x3f, 0xcf, 0xf3, 0x80, 0xe0,
-    0x38, 0xe, 0x3, 0x80, 0xe0, 0x38, 0xe, 0x3,
-    0x80,
-
-    /* U+0047 "G" */
-    0x1e, 0x1f, 0xe7, 0xfb, 0xcf, 0xe1, 0xf8, 0x7e,
-    0x3, 0x80, 0xe0, 0x39, 0xfe, 0x7f, 0x9f, 0xe1,
-    0xf8, 0x7e, 0x1f, 0x87, 0xf3, 0xdf, 0xe7, 0xf8,
-    0x78,
-
-    /* U+0048 "H" */
-    0xe1, 0xf8, 0x7e, 0x1f, 0x87, 0xe1, 0xf8, 0x7e,
-    0x1f, 0x87, 0xff, 0xff, 0xff, 0xff, 0x87, 0xe1,
-    0xf8, 0x7e, 0x1f, 0x87, 0xe1, 0xf8, 0x7e, 0x1f,
-    0x87,
-
-    /* U+0049 "I" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+004A "J" */
-    0x1, 0xc0, 0x70, 0x1c, 0x7, 0x1, 0xc0, 0x70,
-    0x1c, 0x7, 0x1, 0xc0, 0x70, 0x1c, 0x7, 0xe1,
-    0xf8, 0x7e, 0x1f, 0x87, 0xf3, 0xdf, 0xe7, 0xf8,
-    0x78,
-
-    /* U+004B "K" */
-    0xe1, 0xfc, 0x3b, 0x8f, 0x71, 0xce, 0x79, 0xce,
-    0x3b, 0xc7, 0x70, 0xfe, 0x1f, 0xc3, 0xf8, 0x7f,
-    0x8f, 0x71, 0xcf, 0x38, 0xe7, 0x1c, 0xe3, 0xdc,
-    0x3b, 0x87, 0xf0, 0x70,
-
-    /* U+004C "L" */
-    0xe0, 0x38, 0xe, 0x3, 0x80, 0xe0, 0x38, 0xe,
-    0x3, 0x80, 0xe0, 0x38, 0xe, 0x3, 0x80, 0xe0,
-    0x38, 0xe, 0x3, 0x80, 0xe0, 0x3f, 0xff, 0xff,
-    0xff,
-
-    /* U+004D "M" */
-    0xe0, 0x7f, 0xf, 0xf9, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xf7, 0xe6, 0x7e, 0x67, 0xe0,
-    0x7e, 0x7, 0xe0, 0x7e, 0x7, 0xe0, 0x7e, 0x7,
-    0xe0, 0x7e, 0x7, 0xe0, 0x7e, 0x7,
-
-    /* U+004E "N" */
-    0xf0, 0xfe, 0x1f, 0xc3, 0xfc, 0x7f, 0x8f, 0xf9,
-    0xff, 0x3f, 0xe7, 0xfe, 0xfd, 0xdf, 0xbb, 0xf7,
-    0xfe, 0x7f, 0xcf, 0xf9, 0xff, 0x1f, 0xe3, 0xfc,
-    0x7f, 0x87, 0xf0, 0xf0,
-
-    /* U+004F "O" */
-    0x1f, 0xf, 0xf9, 0xff, 0x78, 0xfe, 0xf, 0xc1,
-    0xf8, 0x3f, 0x7, 0xe0, 0xfc, 0x1f, 0x83, 0xf0,
-    0x7e, 0xf, 0xc1, 0xf8, 0x3f, 0x7, 0xf1, 0xef,
-    0xf9, 0xff, 0xf, 0x80,
-
-    /* U+0050 "P" */
-    0xfe, 0x3f, 0xef, 0xfb, 0x8f, 0xe1, 0xf8, 0x7e,
-    0x1f, 0x87, 0xe3, 0xff, 0xef, 0xfb, 0xf8, 0xe0,
-    0x38, 0xe, 0x3, 0x80, 0xe0, 0x38, 0xe, 0x3,
-    0x80,
-
-    /* U+0051 "Q" */
-    0x1f, 0x7, 0xf1, 0xff, 0x78, 0xfe, 0xf, 0xc1,
-    0xf8, 0x3f, 0x7, 0xe0, 0xfc, 0x1f, 0x83, 0xf0,
-    0x7e, 0xf, 0xc1, 0xf8, 0x3f, 0x7, 0xe0, 0xee,
-    0x39, 0xff, 0x1f, 0xc0, 0xe0, 0x1c, 0x3, 0x80,
-
-    /* U+0052 "R" */
-    0xfe, 0x3f, 0xef, 0xfb, 0x8f, 0xe1, 0xf8, 0x7e,
-    0x1f, 0x87, 0xe3, 0xff, 0xef, 0xfb, 0xfc, 0xe7,
-    0x39, 0xce, 0x7b, 0x8e, 0xe3, 0xb8, 0xfe, 0x1f,
-    0x87,
-
-    /* U+0053 "S" */
-    0x1e, 0x1f, 0xe7, 0xfb, 0xcf, 0xe1, 0xf8, 0x7e,
-    0x1, 0xc0, 0x78, 0xf, 0x81, 0xf0, 0x1e, 0x3,
-    0x80, 0x7e, 0x1f, 0x87, 0xf3, 0xdf, 0xe7, 0xf8,
-    0x78,
-
-    /* U+0054 "T" */
-    0xff, 0xff, 0xff, 0xff, 0x87, 0x0, 0xe0, 0x1c,
-    0x3, 0x80, 0x70, 0xe, 0x1, 0xc0, 0x38, 0x7,
-    0x0, 0xe0, 0x1c, 0x3, 0x80, 0x70, 0xe, 0x1,
-    0xc0, 0x38, 0x7, 0x0,
-
-    /* U+0055 "U" */
-    0xe1, 0xf8, 0x7e, 0x1f, 0x87, 0xe1, 0xf8, 0x7e,
-    0x1f, 0x87, 0xe1, 0xf8, 0x7e, 0x1f, 0x87, 0xe1,
-    0xf8, 0x7e, 0x1f, 0x87, 0xf3, 0xdf, 0xe7, 0xf8,
-    0x78,
-
-    /* U+0056 "V" */
-    0xe0, 0xfc, 0x1f, 0xc3, 0xf8, 0xf7, 0x1e, 0xe3,
-    0x9c, 0x73, 0x8e, 0x79, 0xc7, 0x78, 0xee, 0x1d,
-    0xc3, 0xb8, 0x77, 0x7, 0xc0, 0xf8, 0x1f, 0x3,
-    0xe0, 0x3c, 0x7, 0x0,
-
-    /* U+0057 "W" */
-    0xe1, 0xc3, 0xf0, 0xe1, 0xf8, 0x71, 0xfe, 0x78,
-    0xef, 0x3e, 0x73, 0x9f, 0x39, 0xcf, 0x9c, 0xe7,
-    0xce, 0x73, 0x6e, 0x3d, 0xb7, 0xf, 0xdb, 0x87,
-    0xef, 0xc3, 0xf7, 0xe1, 0xf3, 0xf0, 0xf8, 0xf0,
-    0x3c, 0x78, 0x1e, 0x3c, 0xf, 0x1e, 0x7, 0x8f,
-    0x3, 0xc7, 0x0,
-
-    /* U+0058 "X" */
-    0xe0, 0xfe, 0x3d, 0xc7, 0x38, 0xe3, 0xb8, 0x77,
-    0xe, 0xe0, 0xf8, 0x1f, 0x1, 0xc0, 0x38, 0xf,
-    0x81, 0xf0, 0x7f, 0xe, 0xe3, 0xdc, 0x71, 0xce,
-    0x3b, 0xc7, 0xf0, 0x70,
-
-    /* U+0059 "Y" */
-    0xf0, 0xfe, 0x3d, 0xc7, 0x38, 0xe7, 0xbc, 0x77,
-    0xe, 0xe0, 0xd8, 0x1f, 0x3, 0xe0, 0x38, 0x7,
-    0x0, 0xe0, 0x1c, 0x3, 0x80, 0x70, 0xe, 0x1,
-    0xc0, 0x38, 0x7, 0x0,
-
-    /* U+005A "Z" */
-    0xff, 0xff, 0xff, 0xfc, 0xf, 0x3, 0x81, 0xe0,
-    0x70, 0x3c, 0xe, 0x7, 0x81, 0xe0, 0x70, 0x3c,
-    0xe, 0x7, 0x81, 0xc0, 0xf0, 0x3f, 0xff, 0xff,
-    0xff,
-
     /* U+00B0 "°" */
     0x3e, 0x3f, 0xb8, 0xf8, 0x3c, 0x1e, 0xf, 0x8e,
     0xfe, 0x3e, 0x0
@@ -363,84 +114,45 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
 
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 90, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1, .adv_w = 121, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11, .adv_w = 137, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 17, .adv_w = 271, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 55, .adv_w = 194, .box_w = 10, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 87, .adv_w = 346, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 135, .adv_w = 260, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 173, .adv_w = 68, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 176, .adv_w = 125, .box_w = 5, .box_h = 25, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 192, .adv_w = 125, .box_w = 5, .box_h = 25, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 208, .adv_w = 162, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 11},
-    {.bitmap_index = 221, .adv_w = 197, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 237, .adv_w = 89, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 241, .adv_w = 146, .box_w = 8, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 244, .adv_w = 95, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 246, .adv_w = 173, .box_w = 9, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 269, .adv_w = 202, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 294, .adv_w = 123, .box_w = 6, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 309, .adv_w = 190, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 334, .adv_w = 191, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 359, .adv_w = 206, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 389, .adv_w = 192, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 414, .adv_w = 192, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 439, .adv_w = 176, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 464, .adv_w = 194, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 489, .adv_w = 190, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 514, .adv_w = 113, .box_w = 4, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 521, .adv_w = 98, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 529, .adv_w = 197, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 547, .adv_w = 197, .box_w = 11, .box_h = 8, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 558, .adv_w = 197, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 576, .adv_w = 185, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 601, .adv_w = 340, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 651, .adv_w = 204, .box_w = 12, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 681, .adv_w = 207, .box_w = 10, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 706, .adv_w = 205, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 731, .adv_w = 211, .box_w = 10, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 756, .adv_w = 195, .box_w = 10, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 781, .adv_w = 186, .box_w = 10, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 806, .adv_w = 207, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 831, .adv_w = 214, .box_w = 10, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 856, .adv_w = 100, .box_w = 3, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 864, .adv_w = 198, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 889, .adv_w = 214, .box_w = 11, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 917, .adv_w = 186, .box_w = 10, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 942, .adv_w = 241, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 972, .adv_w = 227, .box_w = 11, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1000, .adv_w = 209, .box_w = 11, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1028, .adv_w = 205, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1053, .adv_w = 204, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1085, .adv_w = 207, .box_w = 10, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1110, .adv_w = 194, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1135, .adv_w = 202, .box_w = 11, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1163, .adv_w = 214, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1188, .adv_w = 211, .box_w = 11, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1216, .adv_w = 298, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1259, .adv_w = 206, .box_w = 11, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1287, .adv_w = 204, .box_w = 11, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1315, .adv_w = 182, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1340, .adv_w = 161, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 14}
+    {.bitmap_index = 0, .adv_w = 146, .box_w = 8, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 3, .adv_w = 95, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5, .adv_w = 202, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 30, .adv_w = 123, .box_w = 6, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 45, .adv_w = 190, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 70, .adv_w = 191, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 95, .adv_w = 206, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 125, .adv_w = 192, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 150, .adv_w = 192, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 175, .adv_w = 176, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 200, .adv_w = 194, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 225, .adv_w = 190, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 250, .adv_w = 205, .box_w = 10, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 275, .adv_w = 161, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 14}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x6d
+};
 
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 59, .glyph_id_start = 1,
+        .range_start = 45, .range_length = 2, .glyph_id_start = 1,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 176, .range_length = 1, .glyph_id_start = 60,
+        .range_start = 48, .range_length = 10, .glyph_id_start = 3,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 67, .range_length = 110, .glyph_id_start = 13,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -452,111 +164,30 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 /*Map glyph_ids to kern left classes*/
 static const uint8_t kern_left_class_mapping[] =
 {
-    0, 0, 0, 1, 0, 0, 0, 0,
-    1, 0, 0, 0, 2, 3, 4, 3,
-    5, 0, 6, 7, 8, 9, 10, 11,
-    12, 13, 13, 0, 0, 0, 0, 0,
-    0, 0, 14, 15, 16, 15, 17, 18,
-    16, 19, 0, 20, 21, 22, 0, 0,
-    16, 23, 24, 25, 26, 27, 20, 28,
-    28, 29, 30, 0, 0
+    0, 2, 1, 0, 3, 4, 5, 6,
+    7, 8, 9, 10, 10, 11, 0
 };
 
 /*Map glyph_ids to kern right classes*/
 static const uint8_t kern_right_class_mapping[] =
 {
-    0, 0, 0, 1, 0, 0, 0, 0,
-    1, 0, 0, 0, 0, 2, 3, 2,
-    4, 5, 6, 7, 0, 0, 0, 0,
-    8, 0, 0, 0, 0, 0, 0, 0,
-    9, 0, 10, 11, 12, 11, 11, 11,
-    12, 0, 0, 13, 14, 15, 0, 11,
-    12, 11, 12, 16, 17, 18, 0, 19,
-    19, 20, 21, 0, 0
+    0, 2, 1, 3, 4, 5, 0, 0,
+    0, 0, 6, 0, 0, 7, 0
 };
 
 /*Kern values between classes*/
 static const int8_t kern_class_values[] =
 {
-    0, 0, -11, 0, 0, 0, 0, 0,
-    0, -19, 0, 0, -23, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -5, -13, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -18, 0,
-    0, -14, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -24, 0,
-    0, 0, 0, 0, 0, -33, -4, -13,
-    0, -6, -8, -4, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -6, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -11, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -23, 0, -23,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -6, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -8,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -22, 0, -35, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -10, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -19, 0, -1, 3, 0, 0, 0,
-    0, 0, 10, 0, -7, 1, 0, 0,
-    0, -10, -26, -31, 2, -22, 0, -4,
-    0, -2, 0, 0, 0, 0, 0, -9,
-    -2, 0, 0, -2, 0, 0, 0, 0,
-    -9, -10, -12, 0, -2, -3, 0, 0,
-    0, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -5, -4,
-    0, 0, -2, 1, 0, 0, 0, 0,
-    0, 9, 0, 0, 6, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -14,
-    -21, 0, 0, 0, 0, 0, -16, 0,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, -18, 0, 0, -14, 0, -2,
     0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, -6, 0, 0, 0, 0, 0,
-    -5, -4, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 4, 0, 4,
-    0, 0, 0, 0, 0, 6, 0, -7,
+    0, -6, 1, 0, 0, 0, 0, 0,
+    -9, 0, 0, 0, 0, 0, 0, -11,
+    0, 0, 0, 0, 0, 0, -23, 0,
+    -23, 0, 0, 0, 0, -6, 0, 0,
     0, 0, 0, 0, -8, 0, 0, 0,
-    0, 0, 4, 0, 4, 0, 0, 0,
-    0, -5, 12, 0, -1, 0, 0, 0,
-    0, -1, -34, 0, 0, -14, 0, -12,
-    0, -26, 0, 0, 0, 0, 0, -14,
-    0, 0, -20, 0, 0, 0, 0, 0,
-    -5, -8, -8, 0, -2, -3, 0, 0,
-    0, 0, 0, 5, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, -5,
-    0, 0, 0, 4, 0, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    2, 0, 0, 0, -10, 0, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    0, 0, 0, 0, 0, 0, -4, -5,
-    -12, -10, 0, -20, -28, -6, 0, 0,
-    0, 0, 10, -22, 0, -11, 0, 0,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    -14, -20, -20, 0, 0, 0, 0, 0,
-    -30, 0, -6, -13, 0, 0, -2, -6,
-    0, 0, 0, 0, 0, 2, -5, 0,
-    0, 0, 0, 0, 0, 2, 0, -5,
-    -3, 0, 0, 0, -12, 0, 0, 0,
-    0, 0, -30, -24, -20, 0, 0, 0,
-    0, 0, -28, -6, -8, -20, 0, -2,
-    -2, -10, 0, 0, 0, 0
+    -22, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, -10, 0, 0, 0, -2, -3,
+    0, 0, 0, 0, 0
 };
 
 
@@ -566,8 +197,8 @@ static const lv_font_fmt_txt_kern_classes_t kern_classes =
     .class_pair_values   = kern_class_values,
     .left_class_mapping  = kern_left_class_mapping,
     .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 30,
-    .right_class_cnt     = 21,
+    .left_class_cnt      = 11,
+    .right_class_cnt     = 7,
 };
 
 /*--------------------
@@ -589,7 +220,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = &kern_classes,
     .kern_scale = 16,
-    .cmap_num = 2,
+    .cmap_num = 3,
     .bpp = 1,
     .kern_classes = 1,
     .bitmap_format = 0,
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 32 px
  * Bpp: 1
- * Opts: --bpp 1 --size 32 --no-compress --stride 1 --align 1 --font BarlowCondensed-SemiBold.ttf --range 32-90,176 --format lvgl -o barlow_condensed_sb32px.c
+ * Opts: --bpp 1 --size 32 --no-compress --stride 1 --align 1 --font BarlowCondensed-SemiBold.ttf --range 45,48-58 --format lvgl -o barlow_condensed_sb32px.c
  ******************************************************************************/
 
 #ifdef __has_include
@@ -32,89 +32,9 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((aligned(4))) = {
-    /* U+0020 " " */
-    0x0,
-
-    /* U+0021 "!" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x6, 0xff, 0x60,
-
-    /* U+0022 "\"" */
-    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
-
-    /* U+0023 "#" */
-    0x7, 0xe, 0x7, 0x87, 0x83, 0xc3, 0xc1, 0xe1,
-    0xc0, 0xf1, 0xe0, 0x78, 0xf1, 0xff, 0xfe, 0xff,
-    0xff, 0x7f, 0xff, 0x8f, 0xe, 0x7, 0x8f, 0x3,
-    0xc7, 0x81, 0xc3, 0xc7, 0xff, 0xfb, 0xff, 0xfd,
-    0xff, 0xfe, 0x3c, 0x38, 0x1e, 0x3c, 0xf, 0x1e,
-    0x7, 0xf, 0x7, 0x87, 0x83, 0xc3, 0xc0,
-
-    /* U+0024 "$" */
-    0xe, 0x0, 0xe0, 0xe, 0x3, 0xf8, 0x7f, 0xc7,
-    0xfe, 0xf9, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0,
-    0xf, 0x80, 0x7c, 0x7, 0xf0, 0x3f, 0x81, 0xfc,
-    0x7, 0xe0, 0x3e, 0x1, 0xf0, 0xf, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0x9e, 0x7f, 0xe3, 0xfc, 0x1f,
-    0x0, 0xe0, 0xe, 0x0,
-
-    /* U+0025 "%" */
-    0x1e, 0x1, 0xc3, 0xfc, 0x1c, 0x38, 0x60, 0xe1,
-    0x81, 0x8e, 0xc, 0xc, 0x70, 0x60, 0x67, 0x3,
-    0x86, 0x38, 0xf, 0xf3, 0x80, 0x1e, 0x1c, 0x0,
-    0x1, 0xc0, 0x0, 0xc, 0x0, 0x0, 0xe0, 0x0,
-    0x6, 0x0, 0x0, 0x70, 0xe0, 0x3, 0x1f, 0xc0,
-    0x38, 0xc6, 0x1, 0x8c, 0x18, 0x1c, 0x60, 0xc0,
-    0xc3, 0x6, 0xe, 0x18, 0x30, 0x60, 0x63, 0x7,
-    0x3, 0xf8, 0x30, 0xf, 0x80,
-
-    /* U+0026 "&" */
-    0xf, 0x80, 0x3f, 0xc0, 0x3f, 0xe0, 0x7d, 0xf0,
-    0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x7d, 0xf0,
-    0x3d, 0xe0, 0x1f, 0xc0, 0xf, 0x80, 0x1f, 0x0,
-    0x3f, 0x0, 0x7f, 0x84, 0x7b, 0xce, 0xf1, 0xee,
-    0xf1, 0xfe, 0xf0, 0xfc, 0xf0, 0x7c, 0xf8, 0xfc,
-    0x7f, 0xfc, 0x7f, 0xfe, 0x1f, 0x8f,
-
-    /* U+0027 "'" */
-    0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0028 "(" */
-    0x1e, 0x38, 0xf1, 0xe7, 0x8f, 0x1e, 0x3c, 0xf1,
-    0xe3, 0xc7, 0x8f, 0x1e, 0x3c, 0x78, 0xf1, 0xe3,
-    0xc7, 0x87, 0x8f, 0x1e, 0x3c, 0x3c, 0x78, 0xf0,
-    0xf0,
-
-    /* U+0029 ")" */
-    0xf0, 0xe1, 0xe3, 0xc3, 0xc7, 0x8f, 0x1e, 0x1e,
-    0x3c, 0x78, 0xf1, 0xe3, 0xc7, 0x8f, 0x1e, 0x3c,
-    0x78, 0xf3, 0xc7, 0x8f, 0x1e, 0x78, 0xf1, 0xc7,
-    0x80,
-
-    /* U+002A "*" */
-    0xc, 0x3, 0xc, 0xcf, 0xff, 0x7f, 0x87, 0x87,
-    0xfb, 0xff, 0xcc, 0xc3, 0x0, 0xc0,
-
-    /* U+002B "+" */
-    0x7, 0x0, 0x70, 0x7, 0x0, 0x70, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x70, 0x7, 0x0, 0x70, 0x7,
-    0x0, 0x70,
-
-    /* U+002C "," */
-    0x77, 0x77, 0xee, 0xee,
-
     /* U+002D "-" */
     0xff, 0xff, 0xff, 0xe0,
 
-    /* U+002E "." */
-    0x6f, 0xf6,
-
-    /* U+002F "/" */
-    0x3, 0xc0, 0xf0, 0x38, 0x1e, 0x7, 0x81, 0xc0,
-    0xf0, 0x3c, 0xf, 0x3, 0x81, 0xe0, 0x78, 0x1c,
-    0xf, 0x3, 0xc0, 0xe0, 0x78, 0x1e, 0x7, 0x81,
-    0xc0, 0xf0, 0x3c, 0xe, 0x0,
-
     /* U+0030 "0" */
     0x1f, 0x83, 0xfc, 0x7f, 0xef, 0x9f, 0xf0, 0xff,
     0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0,
@@ -183,230 +103,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0xfc, 0x1f, 0x80,
 
     /* U+003A ":" */
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60,
-
-    /* U+003B ";" */
-    0x6f, 0xff, 0x60, 0x0, 0x0, 0x7, 0x7f, 0xee,
-    0xee, 0xe0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x1, 0xc0, 0x7e, 0xf, 0xe1, 0xfe,
-    0x3f, 0xc3, 0xf0, 0x1e, 0x0, 0xfc, 0x7, 0xf8,
-    0xf, 0xf0, 0xf, 0xe0, 0x1f, 0x80, 0x3c, 0x0,
-    0x60,
-
-    /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+003E ">" */
-    0x80, 0x7, 0x0, 0x3e, 0x1, 0xfc, 0x3, 0xf8,
-    0x7, 0xf0, 0xf, 0xe0, 0x1f, 0x1, 0xf8, 0x3f,
-    0x87, 0xf1, 0xfe, 0xf, 0xc0, 0x78, 0x3, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0xf, 0x83, 0xfc, 0x7f, 0xef, 0x9f, 0xf0, 0xff,
-    0xf, 0xf0, 0xf0, 0xf, 0x1, 0xf0, 0x3e, 0x3,
-    0xe0, 0x7c, 0xf, 0x0, 0xe0, 0xe, 0x0, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0xf, 0x0,
-    0xf0, 0x6, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x7f, 0x0, 0x7, 0xff, 0x0, 0x7f, 0xfe,
-    0x3, 0xe0, 0x7c, 0x1e, 0x0, 0x78, 0xf0, 0x0,
-    0xe3, 0x8f, 0x63, 0xde, 0x7f, 0x87, 0x71, 0xce,
-    0x1d, 0xc7, 0x38, 0x7e, 0x38, 0xe1, 0xf8, 0xe3,
-    0x7, 0xe3, 0x8c, 0x1f, 0x8e, 0x30, 0xee, 0x38,
-    0xe7, 0xb8, 0xe7, 0xfc, 0xe1, 0xff, 0xf3, 0xc3,
-    0xcf, 0x7, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x3e,
-    0xe, 0x0, 0x7f, 0xf8, 0x0, 0xff, 0xc0, 0x0,
-    0xfc, 0x0,
-
-    /* U+0041 "A" */
-    0x7, 0x80, 0x1f, 0x0, 0x7c, 0x3, 0xf0, 0xf,
-    0xc0, 0x3f, 0x0, 0xfe, 0x3, 0xb8, 0x1c, 0xe0,
-    0x73, 0x81, 0xce, 0x7, 0x3c, 0x3c, 0xf0, 0xf1,
-    0xc3, 0x87, 0xe, 0x1c, 0x3f, 0xf9, 0xff, 0xe7,
-    0xff, 0x9e, 0xe, 0x70, 0x3d, 0xc0, 0xff, 0x3,
-    0xc0,
-
-    /* U+0042 "B" */
-    0xff, 0xf, 0xfc, 0xff, 0xef, 0x1f, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0x1e, 0xff,
-    0xef, 0xf8, 0xff, 0xcf, 0x1e, 0xf0, 0xff, 0xf,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0x1f, 0xff, 0xef,
-    0xfc, 0xff, 0x80,
-
-    /* U+0043 "C" */
-    0x1f, 0x83, 0xfc, 0x7f, 0xef, 0x9f, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0x0, 0xf0, 0xf, 0x0, 0xf0,
-    0xf, 0x0, 0xf0, 0xf, 0x0, 0xf0, 0xf, 0x0,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0x9f, 0x7f, 0xe3,
-    0xfc, 0x1f, 0x80,
-
-    /* U+0044 "D" */
-    0xff, 0x8f, 0xfc, 0xff, 0xef, 0x1e, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0,
-    0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0x1e, 0xff, 0xef,
-    0xfc, 0xff, 0x80,
-
-    /* U+0045 "E" */
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0x1, 0xe0,
-    0x3c, 0x7, 0x80, 0xf0, 0x1e, 0x3, 0xfe, 0x7f,
-    0xcf, 0xf9, 0xe0, 0x3c, 0x7, 0x80, 0xf0, 0x1e,
-    0x3, 0xc0, 0x78, 0xf, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+0046 "F" */
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0x1, 0xe0,
-    0x3c, 0x7, 0x80, 0xf0, 0x1e, 0x3, 0xfe, 0x7f,
-    0xcf, 0xf9, 0xe0, 0x3c, 0x7, 0x80, 0xf0, 0x1e,
-    0x3, 0xc0, 0x78, 0xf, 0x1, 0xe0, 0x3c, 0x0,
-
-    /* U+0047 "G" */
-    0x1f, 0x83, 0xfc, 0x7f, 0xef, 0x9f, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0x0, 0xf0, 0xf, 0x0, 0xf0,
-    0xf, 0x3f, 0xf3, 0xff, 0x3f, 0xf0, 0xff, 0xf,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0x9f, 0x7f, 0xe3,
-    0xfc, 0x1f, 0x80,
-
-    /* U+0048 "H" */
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf, 0xf0, 0xff, 0xf,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff,
-    0xf, 0xf0, 0xf0,
-
-    /* U+0049 "I" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0,
-
-    /* U+004A "J" */
-    0x0, 0xf0, 0xf, 0x0, 0xf0, 0xf, 0x0, 0xf0,
-    0xf, 0x0, 0xf0, 0xf, 0x0, 0xf0, 0xf, 0x0,
-    0xf0, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0xff, 0xf,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0x9f, 0x7f, 0xe3,
-    0xfc, 0x1f, 0x80,
-
-    /* U+004B "K" */
-    0xf0, 0x7f, 0x87, 0xbc, 0x3d, 0xe3, 0xcf, 0x1e,
-    0x79, 0xe3, 0xcf, 0x1e, 0xf0, 0xf7, 0x87, 0xf8,
-    0x3f, 0xc1, 0xff, 0xf, 0xf8, 0x7d, 0xe3, 0xef,
-    0x1e, 0x78, 0xf1, 0xe7, 0x8f, 0x3c, 0x3d, 0xe1,
-    0xef, 0xf, 0x78, 0x3f, 0xc1, 0xe0,
-
-    /* U+004C "L" */
-    0xf0, 0x1e, 0x3, 0xc0, 0x78, 0xf, 0x1, 0xe0,
-    0x3c, 0x7, 0x80, 0xf0, 0x1e, 0x3, 0xc0, 0x78,
-    0xf, 0x1, 0xe0, 0x3c, 0x7, 0x80, 0xf0, 0x1e,
-    0x3, 0xc0, 0x78, 0xf, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+004D "M" */
-    0xf0, 0x3f, 0xe1, 0xff, 0x87, 0xff, 0x3f, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf,
-    0xde, 0xff, 0x33, 0xfc, 0xcf, 0xf0, 0x3f, 0xc0,
-    0xff, 0x3, 0xfc, 0xf, 0xf0, 0x3f, 0xc0, 0xff,
-    0x3, 0xfc, 0xf, 0xf0, 0x3f, 0xc0, 0xff, 0x3,
-    0xc0,
-
-    /* U+004E "N" */
-    0xf0, 0x7f, 0xc3, 0xfe, 0x1f, 0xf0, 0xff, 0xc7,
-    0xfe, 0x3f, 0xf1, 0xff, 0xcf, 0xfe, 0x7f, 0xf3,
-    0xfd, 0xdf, 0xee, 0xff, 0x77, 0xf9, 0xff, 0xcf,
-    0xfe, 0x7f, 0xf1, 0xff, 0x8f, 0xfc, 0x7f, 0xe1,
-    0xff, 0xf, 0xf8, 0x7f, 0xc1, 0xe0,
-
-    /* U+004F "O" */
-    0x1f, 0x83, 0xfc, 0x7f, 0xef, 0x9f, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0,
-    0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0x9f, 0x7f, 0xe3,
-    0xfc, 0x1f, 0x80,
-
-    /* U+0050 "P" */
-    0xff, 0x8f, 0xfc, 0xff, 0xef, 0x1e, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0x1f, 0xff,
-    0xef, 0xfc, 0xff, 0x8f, 0x0, 0xf0, 0xf, 0x0,
-    0xf0, 0xf, 0x0, 0xf0, 0xf, 0x0, 0xf0, 0xf,
-    0x0, 0xf0, 0x0,
-
-    /* U+0051 "Q" */
-    0x1f, 0x83, 0xfc, 0x7f, 0xef, 0x9e, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0,
-    0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0x9f, 0x7f, 0xe3,
-    0xfc, 0x1f, 0x80, 0xf0, 0xf, 0x0, 0xf0,
-
-    /* U+0052 "R" */
-    0xff, 0x8f, 0xfc, 0xff, 0xef, 0x1e, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0x1e, 0xff,
-    0xef, 0xfc, 0xff, 0x8f, 0x38, 0xf3, 0x8f, 0x3c,
-    0xf1, 0xcf, 0x1c, 0xf1, 0xef, 0x1e, 0xf0, 0xef,
-    0xf, 0xf0, 0xf0,
-
-    /* U+0053 "S" */
-    0x1f, 0x83, 0xfc, 0x7f, 0xef, 0x9f, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0x80, 0xf8, 0x7, 0xe0, 0x3f,
-    0x1, 0xf8, 0xf, 0xc0, 0x7e, 0x3, 0xf0, 0x1f,
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0x9f, 0x7f, 0xe3,
-    0xfc, 0x1f, 0x80,
-
-    /* U+0054 "T" */
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1e, 0x0, 0xf0,
-    0x7, 0x80, 0x3c, 0x1, 0xe0, 0xf, 0x0, 0x78,
-    0x3, 0xc0, 0x1e, 0x0, 0xf0, 0x7, 0x80, 0x3c,
-    0x1, 0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1e,
-    0x0, 0xf0, 0x7, 0x80, 0x3c, 0x0,
-
-    /* U+0055 "U" */
-    0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff,
-    0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0,
-    0xff, 0xf, 0xf0, 0xff, 0xf, 0xf0, 0xff, 0xf,
-    0xf0, 0xff, 0xf, 0xf0, 0xf7, 0x9e, 0x7f, 0xe3,
-    0xfc, 0x1f, 0x80,
-
-    /* U+0056 "V" */
-    0xf0, 0x7f, 0x83, 0xfc, 0x1e, 0xe0, 0xf7, 0x87,
-    0x3c, 0x79, 0xe3, 0xcf, 0x1e, 0x38, 0xf1, 0xc7,
-    0xf, 0x38, 0x7b, 0xc3, 0xde, 0xe, 0xe0, 0x77,
-    0x3, 0xb8, 0x1f, 0xc0, 0xfe, 0x3, 0xe0, 0x1f,
-    0x0, 0xf8, 0x7, 0xc0, 0x3e, 0x0,
-
-    /* U+0057 "W" */
-    0xf0, 0xe0, 0xff, 0xf, 0xe, 0xf0, 0xf1, 0xef,
-    0xf, 0x1e, 0x71, 0xf1, 0xe7, 0x1f, 0x1e, 0x79,
-    0xf1, 0xc7, 0x9f, 0x9c, 0x79, 0xf9, 0xc3, 0x9b,
-    0xbc, 0x39, 0xbb, 0xc3, 0xbb, 0xbc, 0x3f, 0xbb,
-    0x83, 0xf9, 0xb8, 0x3f, 0x9f, 0x81, 0xf9, 0xf8,
-    0x1f, 0x9f, 0x81, 0xf1, 0xf0, 0x1f, 0x1f, 0x1,
-    0xf1, 0xf0, 0xf, 0xf, 0x0, 0xf0, 0xf0, 0xf,
-    0xf, 0x0,
-
-    /* U+0058 "X" */
-    0xf0, 0x7f, 0x83, 0x9e, 0x3c, 0xf1, 0xe3, 0x8e,
-    0x1e, 0xf0, 0xf7, 0x3, 0xf8, 0x1f, 0xc0, 0x7c,
-    0x3, 0xe0, 0x1e, 0x0, 0xf8, 0x7, 0xc0, 0x7f,
-    0x3, 0xf8, 0x3d, 0xc1, 0xef, 0xe, 0x38, 0xf1,
-    0xe7, 0x8f, 0x78, 0x3b, 0xc1, 0xe0,
-
-    /* U+0059 "Y" */
-    0x70, 0x79, 0xe1, 0xe7, 0x87, 0x8e, 0x1c, 0x3c,
-    0xf0, 0xf3, 0xc1, 0xce, 0x7, 0xf8, 0x1f, 0xe0,
-    0x3f, 0x0, 0xfc, 0x3, 0xf0, 0x7, 0x80, 0x1e,
-    0x0, 0x78, 0x1, 0xe0, 0x7, 0x80, 0x1e, 0x0,
-    0x78, 0x1, 0xe0, 0x7, 0x80, 0x1e, 0x0, 0x78,
-    0x0,
-
-    /* U+005A "Z" */
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf0, 0x1c, 0x7,
-    0x80, 0xf0, 0x3c, 0x7, 0x81, 0xe0, 0x3c, 0x7,
-    0x1, 0xe0, 0x3c, 0xf, 0x1, 0xe0, 0x78, 0xf,
-    0x1, 0xc0, 0x78, 0xf, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+00B0 "°" */
-    0x1e, 0xf, 0xc7, 0xfb, 0x87, 0xc0, 0xf0, 0x3c,
-    0xf, 0x87, 0x7f, 0x8f, 0xc1, 0xe0
+    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60
 };
 
 
@@ -416,66 +113,18 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
 
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 102, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1, .adv_w = 138, .box_w = 4, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13, .adv_w = 157, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 16},
-    {.bitmap_index = 20, .adv_w = 310, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 67, .adv_w = 222, .box_w = 12, .box_h = 29, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 111, .adv_w = 395, .box_w = 21, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 172, .adv_w = 297, .box_w = 16, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 218, .adv_w = 78, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = 16},
-    {.bitmap_index = 222, .adv_w = 143, .box_w = 7, .box_h = 28, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 247, .adv_w = 143, .box_w = 7, .box_h = 28, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 272, .adv_w = 185, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 13},
-    {.bitmap_index = 286, .adv_w = 225, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 304, .adv_w = 102, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 308, .adv_w = 166, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 312, .adv_w = 108, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 314, .adv_w = 198, .box_w = 10, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 343, .adv_w = 230, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 378, .adv_w = 140, .box_w = 8, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 401, .adv_w = 218, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 436, .adv_w = 218, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 468, .adv_w = 235, .box_w = 14, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 509, .adv_w = 219, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 544, .adv_w = 220, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 576, .adv_w = 201, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 611, .adv_w = 222, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 646, .adv_w = 217, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 681, .adv_w = 129, .box_w = 4, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 689, .adv_w = 112, .box_w = 4, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 699, .adv_w = 225, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 724, .adv_w = 225, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 738, .adv_w = 225, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 763, .adv_w = 211, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 798, .adv_w = 389, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 864, .adv_w = 233, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 905, .adv_w = 237, .box_w = 12, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 940, .adv_w = 234, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 975, .adv_w = 242, .box_w = 12, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1010, .adv_w = 223, .box_w = 11, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1042, .adv_w = 212, .box_w = 11, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1074, .adv_w = 237, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1109, .adv_w = 244, .box_w = 12, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1144, .adv_w = 115, .box_w = 4, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1156, .adv_w = 227, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1191, .adv_w = 244, .box_w = 13, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1229, .adv_w = 212, .box_w = 11, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1261, .adv_w = 275, .box_w = 14, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1302, .adv_w = 260, .box_w = 13, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1340, .adv_w = 239, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1375, .adv_w = 234, .box_w = 12, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1410, .adv_w = 233, .box_w = 12, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1449, .adv_w = 236, .box_w = 12, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1484, .adv_w = 222, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1519, .adv_w = 231, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1557, .adv_w = 245, .box_w = 12, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1592, .adv_w = 241, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1630, .adv_w = 340, .box_w = 20, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1688, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1726, .adv_w = 233, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1767, .adv_w = 208, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1799, .adv_w = 184, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 16}
+    {.bitmap_index = 0, .adv_w = 166, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 4, .adv_w = 230, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 39, .adv_w = 140, .box_w = 8, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 62, .adv_w = 218, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 97, .adv_w = 218, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 129, .adv_w = 235, .box_w = 14, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 170, .adv_w = 219, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 205, .adv_w = 220, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 237, .adv_w = 201, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 272, .adv_w = 222, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 307, .adv_w = 217, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 342, .adv_w = 129, .box_w = 4, .box_h = 15, .ofs_x = 2, .ofs_y = 0}
 };
 
 /*---------------------
@@ -488,11 +137,11 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 59, .glyph_id_start = 1,
+        .range_start = 45, .range_length = 1, .glyph_id_start = 1,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 176, .range_length = 1, .glyph_id_start = 60,
+        .range_start = 48, .range_length = 11, .glyph_id_start = 2,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -505,111 +154,26 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 /*Map glyph_ids to kern left classes*/
 static const uint8_t kern_left_class_mapping[] =
 {
-    0, 0, 0, 1, 0, 0, 0, 0,
-    1, 0, 0, 0, 2, 3, 4, 3,
-    5, 0, 6, 7, 8, 9, 10, 11,
-    12, 13, 13, 0, 0, 0, 0, 0,
-    0, 0, 14, 15, 16, 15, 17, 18,
-    16, 19, 0, 20, 21, 22, 0, 0,
-    16, 23, 24, 25, 26, 27, 20, 28,
-    28, 29, 30, 0, 0
+    0, 1, 0, 2, 3, 4, 5, 6,
+    7, 8, 9, 9, 0
 };
 
 /*Map glyph_ids to kern right classes*/
 static const uint8_t kern_right_class_mapping[] =
 {
-    0, 0, 0, 1, 0, 0, 0, 0,
-    1, 0, 0, 0, 0, 2, 3, 2,
-    4, 5, 6, 7, 0, 0, 0, 0,
-    8, 0, 0, 0, 0, 0, 0, 0,
-    9, 0, 10, 11, 12, 11, 11, 11,
-    12, 0, 0, 13, 14, 15, 0, 11,
-    12, 11, 12, 16, 17, 18, 0, 19,
-    19, 20, 21, 0, 0
+    0, 1, 2, 3, 4, 0, 0, 0,
+    0, 5, 0, 0, 0
 };
 
 /*Kern values between classes*/
 static const int8_t kern_class_values[] =
 {
-    0, 0, -12, 0, 0, 0, 0, 0,
-    0, -22, 0, 0, -26, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -6, -14, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -20, 0,
-    0, -16, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -28, 0,
-    0, 0, 0, 0, 0, -37, -5, -15,
-    0, -7, -9, -5, -5, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, 2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -11, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -13, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -26, 0, -27,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -9,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -25, 0, -40, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -11, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -22, 0, -1, 4, 0, 0, 0,
-    0, 0, 11, 0, -8, 2, 0, 0,
-    0, -12, -30, -35, 2, -25, 0, -5,
-    0, -2, 0, 0, 0, 0, 0, -10,
-    -2, 0, 0, -2, 0, 0, 0, 0,
-    -11, -11, -14, 0, -2, -4, 0, 0,
-    0, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -6, -5,
-    0, 0, -2, 1, 0, 0, 0, 0,
-    0, 10, 0, 0, 7, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -16,
-    -24, 0, 0, 0, 0, 0, -18, 0,
-    0, -5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -5, 0, -7, 0, 0, 0, 0, 0,
-    -6, -5, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 5, 0, 5,
-    0, 0, 0, 0, 0, 7, 0, -8,
-    0, 0, 0, 0, -9, 0, 0, 0,
-    0, 0, 5, 0, 5, 0, 0, 0,
-    0, -6, 13, 0, -2, 0, 0, 0,
-    0, -2, -38, 0, 0, -16, 0, -13,
-    0, -30, 0, 0, 0, 0, 0, -16,
-    0, 0, -23, 0, 0, 0, 0, 0,
-    -6, -9, -9, 0, -2, -4, 0, 0,
-    0, 0, 0, 6, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -5, -6,
-    0, 0, 0, 5, 0, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    2, 0, -1, 0, -11, 0, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    0, 0, 0, 0, 0, 0, -5, -6,
-    -13, -12, 0, -23, -32, -7, 0, 0,
-    0, 0, 12, -25, 0, -12, 0, 0,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    -16, -23, -23, 0, 0, 0, 0, 0,
-    -34, 0, -7, -14, 0, 0, -2, -7,
-    0, 0, 0, 0, 0, 2, -6, 0,
-    0, 0, 0, 0, 0, 2, 0, -6,
-    -3, 0, 0, 0, -13, 0, 0, 0,
-    0, 0, -35, -27, -23, 0, 0, 0,
-    0, 0, -32, -7, -9, -23, 0, -2,
-    -3, -11, 0, 0, 0, 0
+    0, 0, 0, 0, 0, 0, 0, -7,
+    2, 0, 0, 0, -11, 0, 0, 0,
+    0, -13, 0, 0, 0, 0, -26, 0,
+    -27, 0, 0, -7, 0, 0, 0, 0,
+    -9, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, -11, 0, 0
 };
 
 
@@ -619,8 +183,8 @@ static const lv_font_fmt_txt_kern_classes_t kern_classes =
     .class_pair_values   = kern_class_values,
     .left_class_mapping  = kern_left_class_mapping,
     .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 30,
-    .right_class_cnt     = 21,
+    .left_class_cnt      = 9,
+    .right_class_cnt     = 5,
 };
 
 /*--------------------
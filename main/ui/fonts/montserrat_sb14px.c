@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 14 px
  * Bpp: 4
- * Opts: --bpp 4 --size 14 --no-compress --stride 1 --align 1 --font Montserrat-SemiBold.ttf --range 32-127 --format lvgl -o montserrat_sb14px.c
+ * Opts: --bpp 4 --size 14 --no-compress --stride 1 --align 1 --font Montserrat-SemiBold.ttf --range 70,77,83-84,87,97,100-101,104-105,110-111,114-117,121 --format lvgl -o montserrat_sb14px.c
  ******************************************************************************/
 
 #ifdef __has_include
@@ -32,265 +32,6 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((aligned(4))) = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xf, 0xf0, 0xf, 0xe0, 0xf, 0xd0, 0xe, 0xd0,
-    0xd, 0xc0, 0xc, 0xb0, 0xb, 0x90, 0x2, 0x20,
-    0x1f, 0xf0, 0xd, 0xc0,
-
-    /* U+0022 "\"" */
-    0x3f, 0x48, 0xf2, 0xf4, 0x7f, 0x2f, 0x37, 0xe2,
-    0xf3, 0x6e, 0x1, 0x0, 0x10,
-
-    /* U+0023 "#" */
-    0x0, 0xe, 0x50, 0x4f, 0x0, 0x0, 0xf, 0x30,
-    0x6d, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfa, 0x15,
-    0x8f, 0x55, 0xcb, 0x53, 0x0, 0x6d, 0x0, 0xc7,
-    0x0, 0x1, 0x9c, 0x11, 0xe6, 0x10, 0xaf, 0xff,
-    0xff, 0xff, 0xf2, 0x24, 0xd9, 0x46, 0xf5, 0x40,
-    0x0, 0xe6, 0x4, 0xf0, 0x0, 0x0, 0xf4, 0x6,
-    0xe0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x1a, 0xef,
-    0xfb, 0x40, 0xd, 0xfc, 0xfb, 0xea, 0x4, 0xfa,
-    0x1f, 0x0, 0x10, 0x3f, 0xc2, 0xf0, 0x0, 0x0,
-    0xaf, 0xff, 0x82, 0x0, 0x0, 0x39, 0xff, 0xf9,
-    0x0, 0x0, 0x1f, 0x2c, 0xf3, 0x6, 0x1, 0xf0,
-    0x9f, 0x45, 0xfe, 0xbf, 0xcf, 0xd0, 0x6, 0xbf,
-    0xfe, 0xa1, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
-    0x0, 0x80, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x9, 0xee, 0x40, 0x0, 0xab, 0x0, 0x5d, 0x4,
-    0xf0, 0x5, 0xf1, 0x0, 0x89, 0x0, 0xf2, 0x1e,
-    0x60, 0x0, 0x6d, 0x4, 0xf0, 0xab, 0x0, 0x0,
-    0xb, 0xff, 0x55, 0xf4, 0xce, 0x70, 0x0, 0x10,
-    0x1e, 0x6c, 0x83, 0xe4, 0x0, 0x0, 0xab, 0x1f,
-    0x10, 0x98, 0x0, 0x5, 0xe1, 0x1f, 0x0, 0x98,
-    0x0, 0x1e, 0x50, 0xd, 0x50, 0xd4, 0x0, 0xab,
-    0x0, 0x3, 0xdf, 0x80,
-
-    /* U+0026 "&" */
-    0x0, 0x5d, 0xfe, 0x50, 0x0, 0x1, 0xfc, 0x5b,
-    0xf1, 0x0, 0x3, 0xf6, 0x5, 0xf2, 0x0, 0x0,
-    0xde, 0x6e, 0xa0, 0x0, 0x0, 0x7f, 0xf9, 0x0,
-    0x0, 0x8, 0xf8, 0xee, 0x24, 0xc1, 0x3f, 0x70,
-    0x2d, 0xec, 0xf0, 0x6f, 0x60, 0x1, 0xef, 0x90,
-    0x2f, 0xf9, 0x8b, 0xff, 0xf4, 0x3, 0xbf, 0xfd,
-    0x71, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x3f, 0x42, 0xf4, 0x2f, 0x32, 0xf3, 0x1, 0x0,
-
-    /* U+0028 "(" */
-    0x6, 0xf5, 0xd, 0xd0, 0x3f, 0x80, 0x7f, 0x40,
-    0xaf, 0x10, 0xcf, 0x0, 0xde, 0x0, 0xde, 0x0,
-    0xcf, 0x0, 0xaf, 0x10, 0x7f, 0x40, 0x3f, 0x80,
-    0xd, 0xd0, 0x6, 0xf4,
-
-    /* U+0029 ")" */
-    0x7f, 0x40, 0xf, 0xb0, 0xa, 0xf1, 0x6, 0xf5,
-    0x3, 0xf8, 0x1, 0xf9, 0x0, 0xfa, 0x0, 0xfa,
-    0x1, 0xf9, 0x3, 0xf8, 0x6, 0xf5, 0xa, 0xf1,
-    0xf, 0xb0, 0x7f, 0x30,
-
-    /* U+002A "*" */
-    0x0, 0xa7, 0x0, 0x8a, 0xb9, 0xc5, 0x1b, 0xff,
-    0x90, 0x5e, 0xff, 0xd3, 0x55, 0x97, 0x73, 0x0,
-    0x64, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x6, 0x90, 0x0, 0x0, 0x9, 0xe0, 0x0,
-    0x2, 0x2a, 0xe2, 0x20, 0x1f, 0xff, 0xff, 0xf5,
-    0x5, 0x5b, 0xf5, 0x51, 0x0, 0x9, 0xe0, 0x0,
-    0x0, 0x8, 0xb0, 0x0,
-
-    /* U+002C "," */
-    0x5, 0x25, 0xfc, 0x3f, 0xb0, 0xe5, 0x2f, 0x0,
-
-    /* U+002D "-" */
-    0x28, 0x88, 0x53, 0xff, 0xfa,
-
-    /* U+002E "." */
-    0x6, 0x26, 0xfc, 0x3f, 0x90,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0xf, 0x90, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0xae, 0x0, 0x0, 0xe, 0x90, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x9e, 0x0, 0x0, 0xe, 0x90,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x9e, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0xe, 0xa0, 0x0, 0x4, 0xf4, 0x0,
-    0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x4c, 0xfe, 0x80, 0x0, 0x5f, 0xfb, 0xdf,
-    0xc0, 0xe, 0xf2, 0x0, 0xaf, 0x53, 0xfa, 0x0,
-    0x3, 0xfa, 0x5f, 0x70, 0x0, 0xf, 0xc5, 0xf7,
-    0x0, 0x0, 0xfc, 0x3f, 0xa0, 0x0, 0x3f, 0xa0,
-    0xef, 0x20, 0xa, 0xf5, 0x5, 0xff, 0xbd, 0xfc,
-    0x0, 0x5, 0xcf, 0xe9, 0x0,
-
-    /* U+0031 "1" */
-    0xef, 0xff, 0x89, 0xef, 0x0, 0xdf, 0x0, 0xdf,
-    0x0, 0xdf, 0x0, 0xdf, 0x0, 0xdf, 0x0, 0xdf,
-    0x0, 0xdf, 0x0, 0xdf,
-
-    /* U+0032 "2" */
-    0x7, 0xdf, 0xfb, 0x20, 0x9f, 0xeb, 0xcf, 0xe1,
-    0x17, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x2, 0xee, 0x20,
-    0x0, 0x3e, 0xe3, 0x0, 0x4, 0xfe, 0x20, 0x0,
-    0x4f, 0xfc, 0xaa, 0xa7, 0x8f, 0xff, 0xff, 0xfb,
-
-    /* U+0033 "3" */
-    0x8f, 0xff, 0xff, 0xf2, 0x59, 0x99, 0xcf, 0xd1,
-    0x0, 0x2, 0xed, 0x10, 0x0, 0x2e, 0xf6, 0x0,
-    0x0, 0x4f, 0xff, 0xb0, 0x0, 0x0, 0x1b, 0xf5,
-    0x0, 0x0, 0x4, 0xf8, 0x44, 0x0, 0x8, 0xf7,
-    0xcf, 0xdb, 0xcf, 0xe1, 0x29, 0xef, 0xfb, 0x20,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x6f, 0x90, 0x0, 0x0, 0x2, 0xfd, 0x1, 0xf9,
-    0x0, 0xd, 0xf2, 0x1, 0xf9, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xf5, 0x5a, 0xaa, 0xab, 0xfd, 0xa3,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0,
-
-    /* U+0035 "5" */
-    0xa, 0xff, 0xff, 0xf2, 0xb, 0xf9, 0x99, 0x91,
-    0xd, 0xd0, 0x0, 0x0, 0xf, 0xea, 0x96, 0x0,
-    0xf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x1a, 0xf8,
-    0x0, 0x0, 0x2, 0xfb, 0x25, 0x0, 0x5, 0xf9,
-    0xaf, 0xeb, 0xcf, 0xf3, 0x18, 0xdf, 0xfc, 0x30,
-
-    /* U+0036 "6" */
-    0x0, 0x2a, 0xef, 0xe8, 0x0, 0x3f, 0xfb, 0xab,
-    0x80, 0xd, 0xf4, 0x0, 0x0, 0x3, 0xfa, 0x27,
-    0x73, 0x0, 0x5f, 0xdf, 0xff, 0xf9, 0x6, 0xff,
-    0x60, 0x2c, 0xf3, 0x4f, 0xc0, 0x0, 0x5f, 0x60,
-    0xfe, 0x0, 0x8, 0xf5, 0x7, 0xfd, 0x8a, 0xfd,
-    0x0, 0x6, 0xdf, 0xfa, 0x10,
-
-    /* U+0037 "7" */
-    0x9f, 0xff, 0xff, 0xff, 0x9, 0xfa, 0xaa, 0xbf,
-    0xe0, 0x9f, 0x10, 0x7, 0xf7, 0x3, 0x50, 0x0,
-    0xef, 0x10, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x8, 0xf6, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x1, 0x9e, 0xfe, 0xa1, 0x0, 0xcf, 0xb8, 0xaf,
-    0xd0, 0x1f, 0xc0, 0x0, 0xaf, 0x30, 0xee, 0x30,
-    0x2d, 0xf1, 0x6, 0xff, 0xff, 0xf8, 0x1, 0xfe,
-    0x64, 0x5d, 0xf3, 0x6f, 0x70, 0x0, 0x5f, 0x85,
-    0xf9, 0x0, 0x7, 0xf7, 0xe, 0xfb, 0x8a, 0xff,
-    0x20, 0x1a, 0xef, 0xea, 0x20,
-
-    /* U+0039 "9" */
-    0x4, 0xcf, 0xfb, 0x30, 0x3, 0xfe, 0x99, 0xef,
-    0x30, 0x9f, 0x30, 0x1, 0xfc, 0x9, 0xf3, 0x0,
-    0x1f, 0xf0, 0x4f, 0xe9, 0x9e, 0xff, 0x20, 0x5d,
-    0xfe, 0x9b, 0xf1, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x8f, 0x90, 0xc, 0xba, 0xdf, 0xd1,
-    0x1, 0xae, 0xfe, 0x81, 0x0,
-
-    /* U+003A ":" */
-    0x3f, 0x95, 0xfc, 0x6, 0x20, 0x0, 0x0, 0x0,
-    0x62, 0x6f, 0xc3, 0xf9,
-
-    /* U+003B ";" */
-    0x3f, 0x95, 0xfc, 0x6, 0x20, 0x0, 0x0, 0x0,
-    0x52, 0x5f, 0xc3, 0xfb, 0xe, 0x52, 0xf0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x43, 0x0, 0x1, 0x7d, 0xf5,
-    0x3, 0xaf, 0xfa, 0x30, 0x1f, 0xe7, 0x10, 0x0,
-    0xd, 0xfc, 0x60, 0x0, 0x0, 0x4a, 0xff, 0x91,
-    0x0, 0x0, 0x18, 0xe5, 0x0, 0x0, 0x0, 0x1,
-
-    /* U+003D "=" */
-    0x1f, 0xff, 0xff, 0xf5, 0x7, 0x77, 0x77, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22, 0x20,
-    0x1f, 0xff, 0xff, 0xf5, 0x5, 0x55, 0x55, 0x51,
-
-    /* U+003E ">" */
-    0x6, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0x20, 0x0,
-    0x2, 0x8e, 0xfc, 0x50, 0x0, 0x0, 0x5c, 0xf5,
-    0x0, 0x4, 0xbf, 0xe3, 0x8, 0xef, 0xc6, 0x0,
-    0x1f, 0x93, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x7, 0xdf, 0xfb, 0x30, 0xaf, 0xd9, 0xbf, 0xf1,
-    0x16, 0x0, 0xa, 0xf4, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x2, 0x20, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0xd, 0xd0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x7c, 0xff, 0xea, 0x40, 0x0, 0x0,
-    0x3e, 0xd7, 0x43, 0x59, 0xfb, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x1, 0x2c, 0xb0, 0xb, 0xc0, 0x2c,
-    0xff, 0xad, 0xc1, 0xf4, 0x1f, 0x40, 0xee, 0x64,
-    0xbf, 0xc0, 0x9a, 0x5f, 0x5, 0xf4, 0x0, 0xe,
-    0xc0, 0x5d, 0x6e, 0x7, 0xf2, 0x0, 0xc, 0xc0,
-    0x5d, 0x5f, 0x5, 0xf5, 0x0, 0x1f, 0xc0, 0x7b,
-    0x1f, 0x40, 0xdf, 0x76, 0xcf, 0xf7, 0xe6, 0xb,
-    0xb0, 0x1b, 0xff, 0x93, 0xdf, 0x90, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xd7,
-    0x43, 0x6b, 0x10, 0x0, 0x0, 0x1, 0x7c, 0xff,
-    0xea, 0x10, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xce, 0x8f,
-    0x30, 0x0, 0x0, 0x3, 0xf8, 0x1f, 0xa0, 0x0,
-    0x0, 0xa, 0xf1, 0xa, 0xf2, 0x0, 0x0, 0x1f,
-    0xb0, 0x3, 0xf9, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xee, 0x88, 0x88, 0xaf, 0x70,
-    0x6, 0xf7, 0x0, 0x0, 0xe, 0xe0, 0xd, 0xf1,
-    0x0, 0x0, 0x8, 0xf5,
-
-    /* U+0042 "B" */
-    0xbf, 0xff, 0xff, 0xc6, 0x0, 0xbf, 0x98, 0x89,
-    0xff, 0x40, 0xbf, 0x20, 0x0, 0x6f, 0x70, 0xbf,
-    0x20, 0x1, 0xaf, 0x30, 0xbf, 0xff, 0xff, 0xfb,
-    0x0, 0xbf, 0x98, 0x88, 0xcf, 0x90, 0xbf, 0x20,
-    0x0, 0xe, 0xf0, 0xbf, 0x20, 0x0, 0xe, 0xf0,
-    0xbf, 0x98, 0x88, 0xdf, 0xa0, 0xbf, 0xff, 0xff,
-    0xe8, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x8, 0xdf, 0xfc, 0x50, 0x1, 0xdf, 0xeb,
-    0xbf, 0xf7, 0xb, 0xf9, 0x0, 0x1, 0x91, 0x2f,
-    0xd0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0,
-    0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x1, 0x91,
-    0x1, 0xdf, 0xeb, 0xbf, 0xf7, 0x0, 0x8, 0xdf,
-    0xfc, 0x50,
-
-    /* U+0044 "D" */
-    0xbf, 0xff, 0xfe, 0xb4, 0x0, 0xbf, 0xaa, 0xab,
-    0xff, 0x90, 0xbf, 0x20, 0x0, 0x2d, 0xf5, 0xbf,
-    0x20, 0x0, 0x3, 0xfb, 0xbf, 0x20, 0x0, 0x0,
-    0xee, 0xbf, 0x20, 0x0, 0x0, 0xee, 0xbf, 0x20,
-    0x0, 0x3, 0xfb, 0xbf, 0x20, 0x0, 0x2d, 0xf5,
-    0xbf, 0xaa, 0xab, 0xff, 0x90, 0xbf, 0xff, 0xfe,
-    0xb4, 0x0,
-
-    /* U+0045 "E" */
-    0xbf, 0xff, 0xff, 0xf7, 0xbf, 0xa9, 0x99, 0x94,
-    0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xe0, 0xbf, 0xa9, 0x99, 0x80,
-    0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0xbf, 0xa9, 0x99, 0x96, 0xbf, 0xff, 0xff, 0xfa,
-
     /* U+0046 "F" */
     0xbf, 0xff, 0xff, 0xf7, 0xbf, 0xa9, 0x99, 0x94,
     0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
@@ -298,51 +39,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
     0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
 
-    /* U+0047 "G" */
-    0x0, 0x7, 0xdf, 0xfc, 0x60, 0x1, 0xdf, 0xfb,
-    0xbf, 0xf9, 0xb, 0xf9, 0x0, 0x0, 0x82, 0x2f,
-    0xd0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0,
-    0x11, 0x5f, 0x80, 0x0, 0x0, 0xfb, 0x2f, 0xd0,
-    0x0, 0x0, 0xfb, 0xb, 0xf9, 0x0, 0x0, 0xfb,
-    0x1, 0xdf, 0xfb, 0xbe, 0xfa, 0x0, 0x8, 0xdf,
-    0xfc, 0x70,
-
-    /* U+0048 "H" */
-    0xbf, 0x20, 0x0, 0xc, 0xf0, 0xbf, 0x20, 0x0,
-    0xc, 0xf0, 0xbf, 0x20, 0x0, 0xc, 0xf0, 0xbf,
-    0x20, 0x0, 0xc, 0xf0, 0xbf, 0xff, 0xff, 0xff,
-    0xf0, 0xbf, 0xba, 0xaa, 0xaf, 0xf0, 0xbf, 0x20,
-    0x0, 0xc, 0xf0, 0xbf, 0x20, 0x0, 0xc, 0xf0,
-    0xbf, 0x20, 0x0, 0xc, 0xf0, 0xbf, 0x20, 0x0,
-    0xc, 0xf0,
-
-    /* U+0049 "I" */
-    0xbf, 0x2b, 0xf2, 0xbf, 0x2b, 0xf2, 0xbf, 0x2b,
-    0xf2, 0xbf, 0x2b, 0xf2, 0xbf, 0x2b, 0xf2,
-
-    /* U+004A "J" */
-    0x2, 0xff, 0xff, 0xf2, 0x1, 0x99, 0x9d, 0xf2,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0xa, 0xf2, 0x5, 0x20, 0xd, 0xf0,
-    0xf, 0xfa, 0xcf, 0xb0, 0x3, 0xcf, 0xfa, 0x10,
-
-    /* U+004B "K" */
-    0xbf, 0x20, 0x0, 0x7f, 0x90, 0xbf, 0x20, 0x6,
-    0xfa, 0x0, 0xbf, 0x20, 0x6f, 0xb0, 0x0, 0xbf,
-    0x25, 0xfc, 0x0, 0x0, 0xbf, 0x6f, 0xf2, 0x0,
-    0x0, 0xbf, 0xff, 0xfb, 0x0, 0x0, 0xbf, 0xe2,
-    0xbf, 0x80, 0x0, 0xbf, 0x30, 0x1d, 0xf4, 0x0,
-    0xbf, 0x20, 0x2, 0xff, 0x20, 0xbf, 0x20, 0x0,
-    0x4f, 0xd0,
-
-    /* U+004C "L" */
-    0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0xbf, 0xaa, 0xaa, 0xa2, 0xbf, 0xff, 0xff, 0xf4,
-
     /* U+004D "M" */
     0xbf, 0x20, 0x0, 0x0, 0xc, 0xf0, 0xbf, 0xb0,
     0x0, 0x0, 0x5f, 0xf0, 0xbf, 0xf4, 0x0, 0x0,
@@ -353,53 +49,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0xbf, 0x0, 0xc, 0x40, 0xb, 0xf0, 0xbf, 0x0,
     0x0, 0x0, 0xb, 0xf0,
 
-    /* U+004E "N" */
-    0xbf, 0x30, 0x0, 0xc, 0xf0, 0xbf, 0xe1, 0x0,
-    0xc, 0xf0, 0xbf, 0xfb, 0x0, 0xc, 0xf0, 0xbf,
-    0x9f, 0x80, 0xc, 0xf0, 0xbf, 0x2b, 0xf4, 0xc,
-    0xf0, 0xbf, 0x21, 0xde, 0x1c, 0xf0, 0xbf, 0x20,
-    0x3f, 0xcc, 0xf0, 0xbf, 0x20, 0x6, 0xff, 0xf0,
-    0xbf, 0x20, 0x0, 0x9f, 0xf0, 0xbf, 0x20, 0x0,
-    0xd, 0xf0,
-
-    /* U+004F "O" */
-    0x0, 0x7, 0xdf, 0xfc, 0x60, 0x0, 0x1, 0xdf,
-    0xeb, 0xcf, 0xfb, 0x0, 0xb, 0xf9, 0x0, 0x1,
-    0xcf, 0x80, 0x2f, 0xd0, 0x0, 0x0, 0x1f, 0xe0,
-    0x5f, 0x80, 0x0, 0x0, 0xb, 0xf2, 0x5f, 0x80,
-    0x0, 0x0, 0xb, 0xf2, 0x2f, 0xd0, 0x0, 0x0,
-    0x1f, 0xe0, 0xb, 0xf9, 0x0, 0x1, 0xcf, 0x80,
-    0x1, 0xdf, 0xeb, 0xcf, 0xfb, 0x0, 0x0, 0x7,
-    0xdf, 0xfc, 0x60, 0x0,
-
-    /* U+0050 "P" */
-    0xbf, 0xff, 0xfe, 0x91, 0xb, 0xfb, 0xaa, 0xdf,
-    0xd0, 0xbf, 0x20, 0x0, 0x9f, 0x6b, 0xf2, 0x0,
-    0x5, 0xf8, 0xbf, 0x20, 0x0, 0xaf, 0x6b, 0xfb,
-    0xaa, 0xdf, 0xd0, 0xbf, 0xff, 0xfe, 0x91, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x7, 0xdf, 0xfc, 0x60, 0x0, 0x1, 0xdf,
-    0xeb, 0xcf, 0xfb, 0x0, 0xb, 0xf9, 0x0, 0x1,
-    0xcf, 0x80, 0x2f, 0xd0, 0x0, 0x0, 0x1f, 0xe0,
-    0x5f, 0x80, 0x0, 0x0, 0xb, 0xf2, 0x5f, 0x80,
-    0x0, 0x0, 0xb, 0xf2, 0x2f, 0xd0, 0x0, 0x0,
-    0x1f, 0xe0, 0xb, 0xf9, 0x0, 0x1, 0xcf, 0x80,
-    0x1, 0xdf, 0xeb, 0xcf, 0xfb, 0x0, 0x0, 0x7,
-    0xdf, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x53, 0xc4, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x44, 0x10,
-
-    /* U+0052 "R" */
-    0xbf, 0xff, 0xfe, 0x91, 0xb, 0xfb, 0xaa, 0xdf,
-    0xd0, 0xbf, 0x20, 0x0, 0xaf, 0x6b, 0xf2, 0x0,
-    0x5, 0xf8, 0xbf, 0x20, 0x0, 0x9f, 0x6b, 0xfa,
-    0x99, 0xcf, 0xd0, 0xbf, 0xff, 0xff, 0xc1, 0xb,
-    0xf2, 0x0, 0xee, 0x10, 0xbf, 0x20, 0x4, 0xfb,
-    0xb, 0xf2, 0x0, 0x9, 0xf5,
-
     /* U+0053 "S" */
     0x1, 0xae, 0xfe, 0xb4, 0x0, 0xdf, 0xc9, 0xbe,
     0xa0, 0x4f, 0xa0, 0x0, 0x1, 0x3, 0xfc, 0x10,
@@ -416,24 +65,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0x0, 0xbf, 0x20, 0x0, 0x0, 0xb, 0xf2, 0x0,
     0x0, 0x0, 0xbf, 0x20, 0x0,
 
-    /* U+0055 "U" */
-    0xcf, 0x0, 0x0, 0xf, 0xdc, 0xf0, 0x0, 0x0,
-    0xfd, 0xcf, 0x0, 0x0, 0xf, 0xdc, 0xf0, 0x0,
-    0x0, 0xfd, 0xcf, 0x0, 0x0, 0xf, 0xdc, 0xf0,
-    0x0, 0x0, 0xfc, 0xbf, 0x20, 0x0, 0x1f, 0xb7,
-    0xfa, 0x0, 0x9, 0xf8, 0xd, 0xfe, 0xbd, 0xfe,
-    0x10, 0x19, 0xef, 0xea, 0x10,
-
-    /* U+0056 "V" */
-    0xd, 0xf2, 0x0, 0x0, 0xc, 0xf1, 0x6, 0xf8,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0xfe, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x9f, 0x60, 0x1, 0xfc, 0x0,
-    0x0, 0x2f, 0xc0, 0x7, 0xf5, 0x0, 0x0, 0xb,
-    0xf3, 0xe, 0xe0, 0x0, 0x0, 0x4, 0xfa, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0xdf, 0xdf, 0x10, 0x0,
-    0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0x0, 0x0,
-
     /* U+0057 "W" */
     0x7f, 0x60, 0x0, 0xe, 0xf1, 0x0, 0x4, 0xf7,
     0x2f, 0xb0, 0x0, 0x4f, 0xf6, 0x0, 0x9, 0xf2,
@@ -446,85 +77,12 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0x0, 0xd, 0xff, 0x10, 0x1, 0xff, 0xe0, 0x0,
     0x0, 0x8, 0xfb, 0x0, 0x0, 0xbf, 0x80, 0x0,
 
-    /* U+0058 "X" */
-    0x5f, 0xb0, 0x0, 0x1e, 0xe1, 0x9, 0xf6, 0x0,
-    0xaf, 0x40, 0x0, 0xdf, 0x26, 0xf9, 0x0, 0x0,
-    0x3f, 0xdf, 0xd0, 0x0, 0x0, 0x8, 0xff, 0x20,
-    0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0x6f,
-    0xae, 0xf2, 0x0, 0x2, 0xfe, 0x4, 0xfc, 0x0,
-    0xc, 0xf3, 0x0, 0x9f, 0x80, 0x8f, 0x80, 0x0,
-    0xd, 0xf4,
-
-    /* U+0059 "Y" */
-    0xd, 0xf2, 0x0, 0x0, 0xbf, 0x10, 0x3f, 0xb0,
-    0x0, 0x4f, 0x70, 0x0, 0xaf, 0x40, 0xd, 0xd0,
-    0x0, 0x1, 0xfd, 0x7, 0xf4, 0x0, 0x0, 0x7,
-    0xf9, 0xfb, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x5f, 0xff, 0xff, 0xff, 0xc3, 0xaa, 0xaa, 0xaf,
-    0xf8, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x3,
-    0xfe, 0x10, 0x0, 0x1, 0xef, 0x20, 0x0, 0x0,
-    0xcf, 0x50, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0x3f, 0xfb, 0xaa, 0xaa,
-    0x96, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+005B "[" */
-    0xbf, 0xfa, 0xbf, 0x84, 0xbf, 0x10, 0xbf, 0x10,
-    0xbf, 0x10, 0xbf, 0x10, 0xbf, 0x10, 0xbf, 0x10,
-    0xbf, 0x10, 0xbf, 0x10, 0xbf, 0x10, 0xbf, 0x10,
-    0xbf, 0x85, 0xbf, 0xfa,
-
-    /* U+005C "\\" */
-    0x6f, 0x20, 0x0, 0x1, 0xf8, 0x0, 0x0, 0xb,
-    0xd0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0xb, 0xd0, 0x0, 0x0, 0x6f, 0x20,
-    0x0, 0x1, 0xf7, 0x0, 0x0, 0xc, 0xd0, 0x0,
-    0x0, 0x6f, 0x20, 0x0, 0x1, 0xf7, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x1,
-    0xf7,
-
-    /* U+005D "]" */
-    0xcf, 0xf9, 0x59, 0xf9, 0x3, 0xf9, 0x3, 0xf9,
-    0x3, 0xf9, 0x3, 0xf9, 0x3, 0xf9, 0x3, 0xf9,
-    0x3, 0xf9, 0x3, 0xf9, 0x3, 0xf9, 0x3, 0xf9,
-    0x59, 0xf9, 0xcf, 0xf9,
-
-    /* U+005E "^" */
-    0x0, 0xc, 0xf1, 0x0, 0x0, 0x3f, 0xe7, 0x0,
-    0x0, 0x9b, 0x6e, 0x0, 0x1, 0xf4, 0x1f, 0x40,
-    0x7, 0xe0, 0xa, 0xb0, 0xd, 0x80, 0x3, 0xf2,
-
-    /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xf2, 0x22, 0x22, 0x22,
-
-    /* U+0060 "`" */
-    0x2d, 0xd1, 0x0, 0xb, 0xd1,
-
     /* U+0061 "a" */
     0x6, 0xcf, 0xfc, 0x30, 0xd, 0xb9, 0xaf, 0xe0,
     0x0, 0x0, 0x8, 0xf5, 0x6, 0xef, 0xff, 0xf6,
     0x3f, 0xb3, 0x37, 0xf6, 0x6f, 0x50, 0x7, 0xf6,
     0x2f, 0xc4, 0x6f, 0xf6, 0x5, 0xef, 0xd8, 0xf6,
 
-    /* U+0062 "b" */
-    0xde, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0xd, 0xe7, 0xef,
-    0xc4, 0x0, 0xdf, 0xfa, 0xaf, 0xf5, 0xd, 0xf5,
-    0x0, 0x2f, 0xd0, 0xdf, 0x0, 0x0, 0xbf, 0xd,
-    0xf0, 0x0, 0xc, 0xf0, 0xdf, 0x50, 0x2, 0xfd,
-    0xd, 0xff, 0xba, 0xff, 0x50, 0xdd, 0x7e, 0xfc,
-    0x40, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x7d, 0xfe, 0x80, 0xa, 0xfd, 0x9c, 0xf8,
-    0x3f, 0xb0, 0x0, 0x61, 0x6f, 0x50, 0x0, 0x0,
-    0x6f, 0x50, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x71,
-    0x9, 0xfd, 0x9d, 0xf8, 0x0, 0x7d, 0xfe, 0x70,
-
     /* U+0064 "d" */
     0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x4,
     0xf7, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x8, 0xef,
@@ -541,22 +99,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0x0, 0x4, 0x0, 0xa, 0xfd, 0x9b, 0xf7, 0x0,
     0x7, 0xdf, 0xe9, 0x10,
 
-    /* U+0066 "f" */
-    0x0, 0x9f, 0xf6, 0x5, 0xfb, 0x83, 0x9, 0xf1,
-    0x0, 0xdf, 0xff, 0xf2, 0x6c, 0xf8, 0x71, 0x9,
-    0xf2, 0x0, 0x9, 0xf2, 0x0, 0x9, 0xf2, 0x0,
-    0x9, 0xf2, 0x0, 0x9, 0xf2, 0x0, 0x9, 0xf2,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x8e, 0xfc, 0x5f, 0x90, 0xbf, 0xc8, 0xbf,
-    0xf9, 0x3f, 0xb0, 0x0, 0x9f, 0x97, 0xf5, 0x0,
-    0x3, 0xf9, 0x6f, 0x50, 0x0, 0x4f, 0x93, 0xfc,
-    0x0, 0xa, 0xf9, 0xb, 0xfd, 0x9c, 0xff, 0x90,
-    0x8, 0xef, 0xc7, 0xf8, 0x1, 0x0, 0x0, 0x8f,
-    0x50, 0xde, 0xa9, 0xbf, 0xd0, 0x4, 0xbe, 0xfe,
-    0xa1, 0x0,
-
     /* U+0068 "h" */
     0xde, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
     0xde, 0x0, 0x0, 0x0, 0xde, 0x7e, 0xfc, 0x40,
@@ -570,35 +112,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0xd, 0xe0, 0xd, 0xe0, 0xd, 0xe0, 0xd, 0xe0,
     0xd, 0xe0, 0xd, 0xe0, 0xd, 0xe0,
 
-    /* U+006A "j" */
-    0x0, 0xc, 0xe1, 0x0, 0xe, 0xf2, 0x0, 0x1,
-    0x20, 0x0, 0xc, 0xf0, 0x0, 0xc, 0xf0, 0x0,
-    0xc, 0xf0, 0x0, 0xc, 0xf0, 0x0, 0xc, 0xf0,
-    0x0, 0xc, 0xf0, 0x0, 0xc, 0xf0, 0x0, 0xc,
-    0xf0, 0x0, 0xc, 0xf0, 0xa, 0x9f, 0xb0, 0x2e,
-    0xfc, 0x20,
-
-    /* U+006B "k" */
-    0xde, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0xde, 0x0, 0x1d, 0xf3,
-    0xde, 0x1, 0xdf, 0x40, 0xde, 0x2e, 0xf5, 0x0,
-    0xdf, 0xef, 0xb0, 0x0, 0xdf, 0xfe, 0xf5, 0x0,
-    0xdf, 0x42, 0xff, 0x20, 0xde, 0x0, 0x5f, 0xc0,
-    0xde, 0x0, 0x9, 0xf8,
-
-    /* U+006C "l" */
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xde,
-
-    /* U+006D "m" */
-    0xdd, 0x8e, 0xfc, 0x26, 0xdf, 0xd5, 0xd, 0xfe,
-    0x9a, 0xff, 0xfa, 0x8e, 0xf3, 0xdf, 0x30, 0xa,
-    0xf9, 0x0, 0x4f, 0x9d, 0xe0, 0x0, 0x7f, 0x50,
-    0x1, 0xfa, 0xde, 0x0, 0x7, 0xf4, 0x0, 0x1f,
-    0xad, 0xe0, 0x0, 0x7f, 0x40, 0x1, 0xfa, 0xde,
-    0x0, 0x7, 0xf4, 0x0, 0x1f, 0xad, 0xe0, 0x0,
-    0x7f, 0x40, 0x1, 0xfa,
-
     /* U+006E "n" */
     0xdd, 0x8e, 0xfc, 0x40, 0xdf, 0xf9, 0x9f, 0xf1,
     0xdf, 0x40, 0x7, 0xf6, 0xde, 0x0, 0x3, 0xf8,
@@ -612,24 +125,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0x0, 0xb, 0xf3, 0x9, 0xfd, 0x9d, 0xfa, 0x0,
     0x7, 0xef, 0xe7, 0x0,
 
-    /* U+0070 "p" */
-    0xdd, 0x7e, 0xfc, 0x40, 0xd, 0xff, 0xaa, 0xff,
-    0x50, 0xdf, 0x50, 0x2, 0xfd, 0xd, 0xf0, 0x0,
-    0xb, 0xf0, 0xdf, 0x0, 0x0, 0xcf, 0xd, 0xf5,
-    0x0, 0x2f, 0xd0, 0xdf, 0xfb, 0xaf, 0xf5, 0xd,
-    0xe7, 0xef, 0xd4, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x8e, 0xfc, 0x6f, 0x70, 0xbf, 0xd9, 0xdf,
-    0xf7, 0x3f, 0xb0, 0x0, 0xbf, 0x77, 0xf5, 0x0,
-    0x5, 0xf7, 0x7f, 0x50, 0x0, 0x5f, 0x73, 0xfc,
-    0x0, 0xb, 0xf7, 0xb, 0xfd, 0x9d, 0xff, 0x70,
-    0x8, 0xef, 0xc7, 0xf7, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0,
-    0x4f, 0x70,
-
     /* U+0072 "r" */
     0xdd, 0x7e, 0x7d, 0xff, 0xb4, 0xdf, 0x50, 0xd,
     0xf0, 0x0, 0xde, 0x0, 0xd, 0xe0, 0x0, 0xde,
@@ -653,28 +148,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0xed, 0x0, 0x6, 0xf6, 0xcf, 0x20, 0xc, 0xf6,
     0x7f, 0xea, 0xdf, 0xf6, 0x8, 0xef, 0xc7, 0xf6,
 
-    /* U+0076 "v" */
-    0xd, 0xe0, 0x0, 0xb, 0xe0, 0x7, 0xf5, 0x0,
-    0x2f, 0x80, 0x1, 0xfb, 0x0, 0x8f, 0x20, 0x0,
-    0xaf, 0x20, 0xeb, 0x0, 0x0, 0x4f, 0x85, 0xf5,
-    0x0, 0x0, 0xd, 0xec, 0xe0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0,
-
-    /* U+0077 "w" */
-    0xcd, 0x0, 0x7, 0xf6, 0x0, 0xe, 0xa6, 0xf3,
-    0x0, 0xcf, 0xb0, 0x4, 0xf4, 0x1f, 0x80, 0x2f,
-    0xef, 0x10, 0x9e, 0x0, 0xbd, 0x7, 0xf4, 0xf6,
-    0xe, 0x90, 0x6, 0xf3, 0xdb, 0xd, 0xb4, 0xf4,
-    0x0, 0x1f, 0xbf, 0x50, 0x8f, 0xbe, 0x0, 0x0,
-    0xbf, 0xf0, 0x2, 0xff, 0x90, 0x0, 0x6, 0xfa,
-    0x0, 0xc, 0xf3, 0x0,
-
-    /* U+0078 "x" */
-    0x6f, 0x80, 0x7, 0xf6, 0xa, 0xf4, 0x3f, 0xa0,
-    0x1, 0xee, 0xde, 0x10, 0x0, 0x4f, 0xf4, 0x0,
-    0x0, 0x5f, 0xf6, 0x0, 0x2, 0xfc, 0xcf, 0x20,
-    0xc, 0xf2, 0x2f, 0xc0, 0x8f, 0x60, 0x7, 0xf8,
-
     /* U+0079 "y" */
     0xd, 0xe0, 0x0, 0xb, 0xe0, 0x7, 0xf5, 0x0,
     0x2f, 0x80, 0x1, 0xfb, 0x0, 0x8f, 0x20, 0x0,
@@ -682,35 +155,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
     0x0, 0x0, 0xd, 0xec, 0xe0, 0x0, 0x0, 0x6,
     0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
     0x0, 0x1, 0xfb, 0x0, 0x0, 0xc, 0x9c, 0xf3,
-    0x0, 0x0, 0x1b, 0xfe, 0x60, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x6f, 0xff, 0xff, 0xd3, 0x77, 0x7c, 0xf9, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0xde, 0x20, 0x0, 0xaf,
-    0x40, 0x0, 0x7f, 0x80, 0x0, 0x3f, 0xf7, 0x77,
-    0x77, 0xff, 0xff, 0xff,
-
-    /* U+007B "{" */
-    0x0, 0x5e, 0xe0, 0xf, 0xf7, 0x2, 0xfa, 0x0,
-    0x2f, 0x90, 0x2, 0xf9, 0x0, 0x2f, 0x90, 0x1a,
-    0xf7, 0x3, 0xff, 0x30, 0x3, 0xf9, 0x0, 0x2f,
-    0x90, 0x2, 0xf9, 0x0, 0x2f, 0xa0, 0x0, 0xff,
-    0x70, 0x6, 0xef,
-
-    /* U+007C "|" */
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-
-    /* U+007D "}" */
-    0xce, 0x80, 0x5, 0xef, 0x20, 0x7, 0xf5, 0x0,
-    0x6f, 0x50, 0x6, 0xf5, 0x0, 0x6f, 0x50, 0x4,
-    0xfc, 0x30, 0x1e, 0xf6, 0x6, 0xf6, 0x0, 0x6f,
-    0x50, 0x6, 0xf5, 0x0, 0x7f, 0x50, 0x6d, 0xf3,
-    0xc, 0xf8, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x72, 0xc7,
-    0x2f, 0x68, 0xff, 0xe1, 0x14, 0x0, 0x14, 0x10
+    0x0, 0x0, 0x1b, 0xfe, 0x60, 0x0, 0x0
 };
 
 
@@ -720,115 +165,42 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] __attribute__((alig
 
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 62, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 62, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20, .adv_w = 93, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 33, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 83, .adv_w = 141, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 151, .adv_w = 193, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 211, .adv_w = 158, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 266, .adv_w = 49, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 274, .adv_w = 78, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 302, .adv_w = 78, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 330, .adv_w = 93, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 348, .adv_w = 132, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 376, .adv_w = 55, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 384, .adv_w = 86, .box_w = 5, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 389, .adv_w = 55, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 394, .adv_w = 83, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 443, .adv_w = 151, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 488, .adv_w = 85, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 508, .adv_w = 130, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 548, .adv_w = 130, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 588, .adv_w = 152, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 638, .adv_w = 131, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 678, .adv_w = 140, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 723, .adv_w = 136, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 768, .adv_w = 146, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 813, .adv_w = 140, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 858, .adv_w = 55, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 870, .adv_w = 55, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 885, .adv_w = 132, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 917, .adv_w = 132, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 941, .adv_w = 132, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 973, .adv_w = 130, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1013, .adv_w = 232, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1104, .adv_w = 168, .box_w = 12, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1164, .adv_w = 170, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1214, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1264, .adv_w = 185, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1314, .adv_w = 150, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1354, .adv_w = 143, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1394, .adv_w = 173, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1444, .adv_w = 181, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1494, .adv_w = 71, .box_w = 3, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1509, .adv_w = 118, .box_w = 8, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1549, .adv_w = 163, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1599, .adv_w = 134, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1639, .adv_w = 214, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1699, .adv_w = 181, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1749, .adv_w = 189, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1809, .adv_w = 163, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1854, .adv_w = 189, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1932, .adv_w = 164, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1977, .adv_w = 141, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2022, .adv_w = 135, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2067, .adv_w = 177, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2112, .adv_w = 163, .box_w = 12, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2172, .adv_w = 256, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2252, .adv_w = 155, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2302, .adv_w = 148, .box_w = 11, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2357, .adv_w = 149, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2402, .adv_w = 78, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 2430, .adv_w = 83, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 2479, .adv_w = 78, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2507, .adv_w = 132, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 2531, .adv_w = 112, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2538, .adv_w = 134, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 2543, .adv_w = 136, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2575, .adv_w = 154, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2625, .adv_w = 130, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2657, .adv_w = 154, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2707, .adv_w = 139, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2743, .adv_w = 83, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2776, .adv_w = 155, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2826, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2870, .adv_w = 65, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2892, .adv_w = 66, .box_w = 6, .box_h = 14, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 2934, .adv_w = 142, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2978, .adv_w = 65, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2989, .adv_w = 236, .box_w = 13, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3041, .adv_w = 153, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3073, .adv_w = 144, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3109, .adv_w = 154, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3159, .adv_w = 154, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3209, .adv_w = 94, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3229, .adv_w = 115, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3257, .adv_w = 95, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3287, .adv_w = 153, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3319, .adv_w = 129, .box_w = 10, .box_h = 8, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 3359, .adv_w = 206, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3411, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3443, .adv_w = 129, .box_w = 10, .box_h = 11, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 3498, .adv_w = 119, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3526, .adv_w = 83, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3561, .adv_w = 68, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3575, .adv_w = 83, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3610, .adv_w = 132, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 3}
+    {.bitmap_index = 0, .adv_w = 143, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 40, .adv_w = 214, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 100, .adv_w = 141, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 145, .adv_w = 135, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 190, .adv_w = 256, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 270, .adv_w = 136, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 302, .adv_w = 154, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 352, .adv_w = 139, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 388, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 432, .adv_w = 65, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 454, .adv_w = 153, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 486, .adv_w = 144, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 522, .adv_w = 94, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 542, .adv_w = 115, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 570, .adv_w = 95, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 600, .adv_w = 153, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 632, .adv_w = 129, .box_w = 10, .box_h = 11, .ofs_x = -1, .ofs_y = -3}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x7, 0xd, 0xe, 0x11, 0x1b, 0x1e, 0x1f,
+    0x22, 0x23, 0x28, 0x29, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x33
+};
 
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+        .range_start = 70, .range_length = 52, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 17, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -0,0 +1,235 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "lvgl.h"
+#include "lvgl_private.h" // inv_areas / inv_p of lv_display_t
+#include "frame_profiler.h"
+
+static const char *TAG = "FRAME_PROFILER";
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Ring buffer of the last FRAME_PROFILER_WINDOW frames
+static frame_sample_t s_ring[FRAME_PROFILER_WINDOW];
+static uint32_t s_head = 0;  // Next slot to write
+static uint32_t s_count = 0; // Valid samples in the ring
+static uint32_t s_frames = 0;
+
+// State of the refresh in progress (only touched from the LVGL task)
+static int64_t s_refr_start_us = 0;
+static int64_t s_flush_start_us = 0;
+static int64_t s_wait_start_us = 0;
+static uint32_t s_flush_us = 0;
+static bool s_rendering = false;
+static frame_sample_t s_current;
+
+static void count_invalidated_areas(lv_display_t *disp)
+{
+    uint32_t pixels = 0;
+    uint16_t areas = 0;
+
+    for (uint32_t i = 0; i < disp->inv_p; i++)
+    {
+        if (disp->inv_area_joined[i] == 0)
+        {
+            pixels += lv_area_get_size(&disp->inv_areas[i]);
+            areas++;
+        }
+    }
+
+    s_current.pixels = pixels;
+    s_current.areas = areas;
+}
+
+static void push_sample(const frame_sample_t *sample)
+{
+    taskENTER_CRITICAL(&s_lock);
+    s_ring[s_head] = *sample;
+    s_head = (s_head + 1) % FRAME_PROFILER_WINDOW;
+    if (s_count < FRAME_PROFILER_WINDOW)
+    {
+        s_count++;
+    }
+    s_frames++;
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+static void display_event_cb(lv_event_t *e)
+{
+    int64_t now = esp_timer_get_time();
+
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_REFR_START:
+        s_refr_start_us = now;
+        s_flush_us = 0;
+        s_rendering = false;
+        break;
+
+    case LV_EVENT_RENDER_START:
+        // Areas are already joined at this point
+        s_rendering = true;
+        count_invalidated_areas(lv_event_get_target(e));
+        break;
+
+    case LV_EVENT_FLUSH_START:
+        s_flush_start_us = now;
+        break;
+
+    case LV_EVENT_FLUSH_FINISH:
+        s_flush_us += (uint32_t)(now - s_flush_start_us);
+        break;
+
+    case LV_EVENT_FLUSH_WAIT_START:
+        s_wait_start_us = now;
+        break;
+
+    case LV_EVENT_FLUSH_WAIT_FINISH:
+        s_flush_us += (uint32_t)(now - s_wait_start_us);
+        break;
+
+    case LV_EVENT_REFR_READY:
+        // Idle refresh periods (nothing invalidated) are not frames
+        if (s_rendering)
+        {
+            uint32_t total_us = (uint32_t)(now - s_refr_start_us);
+            s_current.flush_us = s_flush_us;
+            s_current.render_us = total_us > s_flush_us ? total_us - s_flush_us : 0;
+            push_sample(&s_current);
+            s_rendering = false;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void frame_profiler_attach(lv_display_t *disp)
+{
+    if (disp == NULL)
+    {
+        ESP_LOGE(TAG, "No display to attach to");
+        return;
+    }
+
+    static const lv_event_code_t codes[] = {
+        LV_EVENT_REFR_START,
+        LV_EVENT_RENDER_START,
+        LV_EVENT_FLUSH_START,
+        LV_EVENT_FLUSH_FINISH,
+        LV_EVENT_FLUSH_WAIT_START,
+        LV_EVENT_FLUSH_WAIT_FINISH,
+        LV_EVENT_REFR_READY,
+    };
+
+    for (size_t i = 0; i < sizeof(codes) / sizeof(codes[0]); i++)
+    {
+        lv_display_add_event_cb(disp, display_event_cb, codes[i], NULL);
+    }
+
+    ESP_LOGI(TAG, "Frame profiler attached (window: %d frames)", FRAME_PROFILER_WINDOW);
+}
+
+size_t frame_profiler_get_samples(frame_sample_t *out, size_t max_samples)
+{
+    taskENTER_CRITICAL(&s_lock);
+    size_t n = s_count < max_samples ? s_count : max_samples;
+    // Oldest sample first; skip the oldest ones if the caller has less room
+    uint32_t start = (s_head + FRAME_PROFILER_WINDOW - n) % FRAME_PROFILER_WINDOW;
+    for (size_t i = 0; i < n; i++)
+    {
+        out[i] = s_ring[(start + i) % FRAME_PROFILER_WINDOW];
+    }
+    taskEXIT_CRITICAL(&s_lock);
+    return n;
+}
+
+void frame_profiler_get_stats(frame_stats_t *stats)
+{
+    frame_sample_t samples[FRAME_PROFILER_WINDOW];
+    size_t n = frame_profiler_get_samples(samples, FRAME_PROFILER_WINDOW);
+
+    memset(stats, 0, sizeof(*stats));
+    taskENTER_CRITICAL(&s_lock);
+    stats->frames = s_frames;
+    taskEXIT_CRITICAL(&s_lock);
+    stats->samples = n;
+    if (n == 0)
+    {
+        return;
+    }
+
+    uint64_t render_sum = 0, flush_sum = 0, pixels_sum = 0, areas_sum = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        render_sum += samples[i].render_us;
+        flush_sum += samples[i].flush_us;
+        pixels_sum += samples[i].pixels;
+        areas_sum += samples[i].areas;
+
+        if (samples[i].render_us > stats->render_max_us)
+            stats->render_max_us = samples[i].render_us;
+        if (samples[i].flush_us > stats->flush_max_us)
+            stats->flush_max_us = samples[i].flush_us;
+        if (samples[i].pixels > stats->pixels_max)
+            stats->pixels_max = samples[i].pixels;
+        if (samples[i].areas > stats->areas_max)
+            stats->areas_max = samples[i].areas;
+    }
+
+    stats->render_avg_us = render_sum / n;
+    stats->flush_avg_us = flush_sum / n;
+    stats->pixels_avg = pixels_sum / n;
+    stats->areas_avg = areas_sum / n;
+}
+
+void frame_profiler_reset(void)
+{
+    taskENTER_CRITICAL(&s_lock);
+    s_head = 0;
+    s_count = 0;
+    s_frames = 0;
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+static void write_aggregate(json_writer_t *w, const char *key, uint32_t avg, uint32_t max)
+{
+    json_writer_begin_object(w, key);
+    json_writer_int(w, "avg", avg);
+    json_writer_int(w, "max", max);
+    json_writer_end_object(w);
+}
+
+void frame_profiler_write_json(json_writer_t *w)
+{
+    frame_stats_t stats;
+    frame_sample_t samples[FRAME_PROFILER_WINDOW];
+
+    frame_profiler_get_stats(&stats);
+    size_t n = frame_profiler_get_samples(samples, FRAME_PROFILER_WINDOW);
+
+    json_writer_begin_object(w, NULL);
+    json_writer_int(w, "frames", stats.frames);
+    json_writer_int(w, "window", n);
+    write_aggregate(w, "render_us", stats.render_avg_us, stats.render_max_us);
+    write_aggregate(w, "flush_us", stats.flush_avg_us, stats.flush_max_us);
+    write_aggregate(w, "pixels", stats.pixels_avg, stats.pixels_max);
+    write_aggregate(w, "areas", stats.areas_avg, stats.areas_max);
+
+    // Each sample as [render_us, flush_us, pixels, areas]
+    json_writer_begin_array(w, "samples");
+    for (size_t i = 0; i < n; i++)
+    {
+        json_writer_begin_array(w, NULL);
+        json_writer_int(w, NULL, samples[i].render_us);
+        json_writer_int(w, NULL, samples[i].flush_us);
+        json_writer_int(w, NULL, samples[i].pixels);
+        json_writer_int(w, NULL, samples[i].areas);
+        json_writer_end_array(w);
+    }
+    json_writer_end_array(w);
+    json_writer_end_object(w);
+}
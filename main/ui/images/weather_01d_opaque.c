@@ -0,0 +1,471 @@
+#include "lvgl.h"
+#include "esp_attr.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+/* Source: weather_01d.c | Size: 60x60 | Stride: 120 */
+/* Pre-blended on background 0x00008B | RGB565 little-endian */
+
+const uint8_t weather_01d_opaque_map[] __attribute__((aligned(4))) = {
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xcd, 0x49, 0xa5, 0xed, 0xa5, 0xed, 0xcd, 0x49,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xc7, 0xcc, 0x44, 0xfe, 0x44, 0xfe, 0xc7, 0xcc, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x06, 0xd5, 0x04, 0xfe, 0x04, 0xfe, 0x06, 0xd5,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x70, 0x10, 0xc9, 0x9b, 0x68, 0xb4, 0x4e, 0x31, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x2e, 0x31, 0x48, 0xb4, 0xa9, 0x9b, 0x70, 0x10, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xa9, 0x9b, 0xa5, 0xfe, 0x44, 0xfe, 0xe5, 0xf5,
+    0x6e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x26, 0xdd, 0x04, 0xfe, 0x04, 0xfe, 0x26, 0xdd, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39, 0xc5, 0xed, 0x44, 0xfe, 0xa5, 0xfe, 0xa9, 0x9b,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x28, 0xac, 0x64, 0xfe, 0xa4, 0xf5, 0x24, 0xfe, 0xe5, 0xf5, 0x6e, 0x39, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xa9, 0x9b, 0xa5, 0xfe, 0xa5, 0xfe, 0xa9, 0x9b,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39, 0xc5, 0xed,
+    0x24, 0xfe, 0xa4, 0xf5, 0x44, 0xfe, 0x48, 0xb4, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x0f, 0x29, 0xa5, 0xed, 0x24, 0xfe, 0xc4, 0xf5,
+    0x24, 0xfe, 0xe5, 0xf5, 0x6e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x30, 0x08, 0x8b, 0x6a, 0x8b, 0x6a, 0x30, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x4e, 0x39, 0xc5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xc5, 0xed, 0x2e, 0x31,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x2e, 0x31, 0xa5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xe5, 0xf5, 0x6e, 0x39,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39, 0xc5, 0xed, 0x24, 0xfe, 0xc4, 0xf5,
+    0x24, 0xfe, 0xc5, 0xed, 0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x2e, 0x31, 0xa5, 0xed,
+    0x24, 0xfe, 0xc4, 0xf5, 0x04, 0xfe, 0xe5, 0xf5, 0x6e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39,
+    0xc5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xc5, 0xed, 0x4e, 0x39, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x2e, 0x31, 0xa5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe,
+    0xc5, 0xed, 0x0f, 0x29, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0xef, 0x20, 0xa5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xc5, 0xed,
+    0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x2e, 0x31, 0xa5, 0xed, 0x24, 0xfe, 0xa4, 0xed, 0x84, 0xfe, 0xeb, 0x7a, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xcb, 0x72, 0x84, 0xfe,
+    0xa4, 0xed, 0x24, 0xfe, 0xc5, 0xed, 0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x2e, 0x31, 0xa5, 0xe5, 0x84, 0xfe,
+    0x04, 0xfe, 0x6e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0xee, 0x28, 0xec, 0x59, 0xca, 0x7a, 0x28, 0x93, 0x28, 0x93, 0xca, 0x7a,
+    0xec, 0x59, 0xef, 0x28, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x6e, 0x39, 0x04, 0xfe, 0x84, 0xfe, 0xa5, 0xed, 0x4e, 0x39, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0xaf, 0x18, 0xcc, 0x6a, 0x4e, 0x31, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x50, 0x08, 0x6b, 0x6a, 0x65, 0xc4, 0x83, 0xf5, 0x03, 0xfe,
+    0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x03, 0xfe, 0x83, 0xf5, 0x65, 0xcc, 0x6b, 0x6a,
+    0x50, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39,
+    0xeb, 0x72, 0xcf, 0x20, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xec, 0x51, 0xe4, 0xdc,
+    0x03, 0xfe, 0x04, 0xfe, 0xe4, 0xfd, 0xe4, 0xf5, 0xe4, 0xf5, 0xe4, 0xf5, 0xe4, 0xf5, 0xe4, 0xf5,
+    0xe4, 0xf5, 0xe4, 0xfd, 0x04, 0xfe, 0x03, 0xfe, 0xe4, 0xdc, 0xec, 0x51, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x28, 0x93, 0xe3, 0xfd, 0x04, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xf5,
+    0x04, 0xfe, 0xe3, 0xfd, 0x28, 0x93, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xa7, 0xa3, 0x23, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xf5, 0x23, 0xfe, 0xa7, 0xa3,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x28, 0x93,
+    0x23, 0xfe, 0xc4, 0xf5, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xf5, 0x23, 0xfe, 0x28, 0x93, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0xcc, 0x51, 0xe3, 0xfd, 0xc4, 0xf5, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xf5,
+    0xe3, 0xfd, 0xcc, 0x51, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x50, 0x08, 0xe4, 0xdc, 0x04, 0xfe,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0x04, 0xfe, 0xe4, 0xdc, 0x50, 0x08, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x4b, 0x6a, 0x03, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xc4, 0xf5, 0x03, 0xfe, 0x4b, 0x6a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x65, 0xcc, 0x04, 0xfe, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xf5, 0xe4, 0xfd, 0x65, 0xcc, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xcf, 0x28, 0x83, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xfd,
+    0xc4, 0xfd, 0xa3, 0xfd, 0x83, 0xf5, 0xef, 0x28, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xec, 0x59, 0x03, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xc4, 0xfd, 0xc4, 0xfd, 0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xf5, 0xe3, 0xfd, 0xec, 0x59,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xcd, 0x49, 0xc7, 0xc4, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5,
+    0x06, 0xd5, 0x26, 0xd5, 0xa9, 0x9b, 0x50, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xc9, 0x7a, 0x24, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xfd, 0xc4, 0xfd, 0xc3, 0xfd, 0xc3, 0xfd, 0xa3, 0xfd,
+    0xa3, 0xfd, 0x83, 0xf5, 0xe3, 0xfd, 0xca, 0x7a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x50, 0x08, 0xa9, 0x9b, 0x26, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5,
+    0x06, 0xd5, 0x06, 0xd5, 0xc7, 0xc4, 0xcd, 0x49, 0xa5, 0xf5, 0x44, 0xfe, 0x04, 0xfe, 0x24, 0xfe,
+    0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x04, 0xfe, 0xa5, 0xfe, 0x8b, 0x6a,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x28, 0x93, 0x24, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xfd, 0xc4, 0xfd,
+    0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0x83, 0xfd, 0x63, 0xf5, 0xe3, 0xfd, 0x29, 0x93,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x8b, 0x6a, 0xa5, 0xfe, 0x04, 0xfe, 0x24, 0xfe,
+    0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x04, 0xfe, 0x44, 0xfe, 0xa5, 0xf5,
+    0xa5, 0xf5, 0x44, 0xfe, 0x04, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe,
+    0x24, 0xfe, 0x04, 0xfe, 0xa5, 0xfe, 0x8b, 0x6a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x28, 0x93, 0x24, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xc4, 0xfd, 0xc4, 0xfd, 0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0x83, 0xfd, 0x83, 0xfd,
+    0x83, 0xfd, 0x63, 0xf5, 0xc3, 0xfd, 0x29, 0x93, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x8b, 0x6a, 0xa5, 0xfe, 0x04, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe,
+    0x24, 0xfe, 0x04, 0xfe, 0x44, 0xfe, 0xa5, 0xf5, 0xcd, 0x49, 0xc7, 0xc4, 0x06, 0xd5, 0x06, 0xd5,
+    0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x26, 0xd5, 0xa9, 0x9b, 0x50, 0x08,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xc9, 0x7a, 0x24, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xfd, 0xc4, 0xfd, 0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd,
+    0xa3, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x63, 0xfd, 0x43, 0xf5, 0xc3, 0xfd, 0xca, 0x7a,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x50, 0x08, 0xa9, 0x9b, 0x26, 0xd5, 0x06, 0xd5,
+    0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0x06, 0xd5, 0xc7, 0xc4, 0xcd, 0x49,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xec, 0x59, 0x03, 0xfe, 0xe4, 0xf5, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xfd, 0xc4, 0xfd, 0xc3, 0xfd, 0xc3, 0xfd,
+    0xa3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x63, 0xfd, 0x62, 0xfd,
+    0x62, 0xfd, 0x42, 0xf5, 0xc3, 0xfd, 0x0c, 0x5a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xcf, 0x28, 0x83, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xfd,
+    0xc4, 0xfd, 0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd,
+    0x63, 0xfd, 0x62, 0xfd, 0x62, 0xfd, 0x42, 0xf5, 0x42, 0xf5, 0x42, 0xfd, 0x63, 0xf5, 0xef, 0x28,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x65, 0xcc, 0x04, 0xfe, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd,
+    0xe4, 0xfd, 0xc4, 0xfd, 0xc4, 0xfd, 0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0x83, 0xfd,
+    0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x62, 0xfd, 0x62, 0xfd, 0x62, 0xfd, 0x42, 0xf5, 0x42, 0xf5,
+    0x22, 0xf5, 0x62, 0xfd, 0x65, 0xcc, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4b, 0x6a, 0x03, 0xfe, 0xe4, 0xf5,
+    0xe4, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xfd, 0xc4, 0xfd, 0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd,
+    0xa3, 0xfd, 0xa3, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x63, 0xfd, 0x62, 0xfd, 0x62, 0xfd,
+    0x42, 0xf5, 0x42, 0xf5, 0x42, 0xf5, 0x22, 0xf5, 0x02, 0xf5, 0xc2, 0xfd, 0x4b, 0x6a, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x50, 0x08, 0xe4, 0xdc, 0xe4, 0xfd, 0xe4, 0xfd, 0xc4, 0xfd, 0xc4, 0xfd, 0xc3, 0xfd,
+    0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x63, 0xfd,
+    0x62, 0xfd, 0x62, 0xfd, 0x42, 0xf5, 0x42, 0xf5, 0x42, 0xf5, 0x42, 0xf5, 0x22, 0xf5, 0x02, 0xf5,
+    0x42, 0xfd, 0xe4, 0xdc, 0x50, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xcc, 0x51, 0xe3, 0xfd,
+    0xa4, 0xf5, 0xc4, 0xfd, 0xc3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0xa3, 0xfd, 0x83, 0xfd, 0x83, 0xfd,
+    0x83, 0xfd, 0x83, 0xfd, 0x62, 0xfd, 0x62, 0xfd, 0x42, 0xf5, 0x42, 0xf5, 0x42, 0xf5, 0x42, 0xf5,
+    0x22, 0xf5, 0x22, 0xf5, 0x21, 0xf5, 0x02, 0xf5, 0xc2, 0xfd, 0xcc, 0x51, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x28, 0x93, 0x03, 0xfe, 0x84, 0xf5, 0xa3, 0xfd, 0xa3, 0xfd,
+    0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x62, 0xfd, 0x62, 0xfd, 0x62, 0xfd, 0x42, 0xf5,
+    0x42, 0xf5, 0x42, 0xf5, 0x22, 0xf5, 0x22, 0xf5, 0x22, 0xf5, 0x01, 0xf5, 0xe1, 0xf4, 0xc2, 0xfd,
+    0x29, 0x93, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xa7, 0xa3, 0x03, 0xfe, 0x83, 0xf5, 0x83, 0xf5, 0x83, 0xfd, 0x83, 0xfd, 0x63, 0xfd, 0x62, 0xfd,
+    0x62, 0xfd, 0x42, 0xf5, 0x42, 0xf5, 0x42, 0xf5, 0x22, 0xf5, 0x22, 0xf5, 0x22, 0xf5, 0x21, 0xf5,
+    0x01, 0xf5, 0xe1, 0xf4, 0xc2, 0xfd, 0xa7, 0xa3, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x28, 0x93, 0xc3, 0xfd, 0xa3, 0xfd,
+    0x43, 0xf5, 0x63, 0xf5, 0x42, 0xf5, 0x62, 0xf5, 0x42, 0xf5, 0x42, 0xf5, 0x42, 0xf5, 0x22, 0xf5,
+    0x22, 0xf5, 0x01, 0xf5, 0x01, 0xf5, 0xe1, 0xf4, 0x21, 0xfd, 0xa2, 0xfd, 0x49, 0x93, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0xec, 0x51, 0xe4, 0xdc, 0xc3, 0xfd, 0xa2, 0xfd, 0x42, 0xf5, 0x22, 0xf5,
+    0x02, 0xf5, 0x02, 0xf5, 0x02, 0xf5, 0xe2, 0xf4, 0xe1, 0xf4, 0x01, 0xf5, 0x42, 0xfd, 0xa2, 0xfd,
+    0xe5, 0xdc, 0xec, 0x51, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xcf, 0x20, 0xeb, 0x72,
+    0x6e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x50, 0x08,
+    0x6b, 0x6a, 0x65, 0xc4, 0x63, 0xf5, 0xa2, 0xfd, 0xa2, 0xfd, 0xa2, 0xfd, 0xa2, 0xfd, 0xa2, 0xfd,
+    0xa2, 0xfd, 0x62, 0xf5, 0x66, 0xcc, 0x6b, 0x6a, 0x50, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39, 0xeb, 0x72, 0xef, 0x28, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x4e, 0x39, 0xc5, 0xed, 0x84, 0xfe, 0x24, 0xfe, 0x6e, 0x39, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xef, 0x28, 0x0c, 0x5a,
+    0xca, 0x7a, 0x29, 0x93, 0x29, 0x93, 0xca, 0x7a, 0x0c, 0x5a, 0xef, 0x28, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39, 0x04, 0xfe,
+    0x84, 0xfe, 0xc5, 0xed, 0x6e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39, 0xc5, 0xed, 0x24, 0xfe, 0xa4, 0xed,
+    0x84, 0xfe, 0xeb, 0x7a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0xab, 0x72, 0x84, 0xfe, 0xa4, 0xed, 0x24, 0xfe, 0xe5, 0xf5, 0x6e, 0x39,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39,
+    0xc5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xa5, 0xed, 0xef, 0x20, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xcf, 0x20, 0x85, 0xed,
+    0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xe5, 0xf5, 0x6e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x4e, 0x39, 0xc5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xc5, 0xed,
+    0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x2e, 0x31, 0xa5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe,
+    0xe5, 0xf5, 0x6e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x39, 0xc5, 0xed, 0x24, 0xfe,
+    0xc4, 0xf5, 0x24, 0xfe, 0xc5, 0xed, 0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x2e, 0x31, 0xa5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xe5, 0xf5, 0x6e, 0x39, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x2e, 0x31, 0xc5, 0xed, 0x24, 0xfe, 0xc4, 0xf5, 0x24, 0xfe, 0xc5, 0xed, 0x4e, 0x39, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x30, 0x08, 0x8b, 0x6a, 0x8b, 0x6a, 0x30, 0x08,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x2e, 0x31, 0xa5, 0xed, 0x24, 0xfe,
+    0xc4, 0xf5, 0x24, 0xfe, 0xe5, 0xf5, 0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x48, 0xb4, 0x44, 0xfe, 0xa4, 0xf5, 0x24, 0xfe,
+    0xc5, 0xed, 0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xa9, 0x9b, 0xa5, 0xfe, 0xa5, 0xfe, 0xa9, 0x9b, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x2e, 0x31, 0xa5, 0xed, 0x24, 0xfe, 0xa4, 0xf5, 0x44, 0xfe, 0x67, 0xbc,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xa9, 0x9b, 0xa5, 0xfe, 0x44, 0xfe, 0xc5, 0xed, 0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x26, 0xdd, 0x04, 0xfe, 0x04, 0xfe, 0x26, 0xdd,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x2e, 0x31,
+    0xa5, 0xed, 0x44, 0xfe, 0xa5, 0xfe, 0xe8, 0xa3, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x70, 0x10, 0xa9, 0x9b, 0x48, 0xb4, 0x2e, 0x31,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x0f, 0x29, 0x28, 0xac, 0xc9, 0x9b, 0x90, 0x10,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x06, 0xd5, 0x24, 0xfe, 0x24, 0xfe, 0x06, 0xd5,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x06, 0xd5, 0x04, 0xfe, 0x04, 0xfe, 0x06, 0xd5, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xc7, 0xcc, 0x44, 0xfe, 0x44, 0xfe, 0xc7, 0xcc,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xcd, 0x49, 0xa5, 0xed, 0xa5, 0xed, 0xcd, 0x49, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+};
+
+const lv_image_dsc_t weather_01d_opaque = {
+    .header.w = 60,
+    .header.h = 60,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.stride = 120,
+    .data_size = 7200,
+    .data = weather_01d_opaque_map,
+};
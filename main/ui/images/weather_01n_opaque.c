@@ -0,0 +1,471 @@
+#include "lvgl.h"
+#include "esp_attr.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+/* Source: weather_01n.c | Size: 60x60 | Stride: 120 */
+/* Pre-blended on background 0x00008B | RGB565 little-endian */
+
+const uint8_t weather_01n_opaque_map[] __attribute__((aligned(4))) = {
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x33, 0x11, 0x95, 0x32,
+    0xd7, 0x4b, 0xb8, 0x5c, 0xbb, 0x6d, 0x98, 0x5c, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x53, 0x19,
+    0x36, 0x3b, 0xd9, 0x5c, 0xba, 0x75, 0x1c, 0x7e, 0x3c, 0x7e, 0x1b, 0x7e, 0x3c, 0x7e, 0x17, 0x4c,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x14, 0x2a, 0x98, 0x5c, 0xfb, 0x75, 0x5c, 0x7e, 0x3c, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0xfb, 0x85, 0x3c, 0x7e, 0xb5, 0x32, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x14, 0x2a, 0xd9, 0x5c, 0x3c, 0x7e, 0x3c, 0x7e, 0xfb, 0x7d,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x85, 0x1b, 0x7e, 0xb4, 0x21,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xf2, 0x10, 0x58, 0x54, 0x1c, 0x7e,
+    0x1b, 0x7e, 0xfb, 0x85, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0xba, 0x75, 0xf2, 0x10, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x75, 0x32, 0xba, 0x6d, 0x3c, 0x7e, 0xfb, 0x7d, 0x1b, 0x86, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x7a, 0x6d, 0x92, 0x08,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0xb7, 0x4b, 0x3c, 0x7e, 0x1b, 0x7e, 0x1b, 0x86, 0x3b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x3b, 0x86, 0x39, 0x65, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x92, 0x08, 0x98, 0x5c, 0x5c, 0x7e,
+    0xfb, 0x7d, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3b, 0x86, 0xf9, 0x64, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x92, 0x08, 0xf9, 0x64, 0x3c, 0x7e, 0xfb, 0x85, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x3b, 0x86, 0xf9, 0x64, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x72, 0x08, 0xf9, 0x5c, 0x3c, 0x7e, 0xfb, 0x85, 0x3b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3b, 0x86, 0x19, 0x65, 0x31, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x78, 0x54,
+    0x3c, 0x7e, 0xfb, 0x85, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x79, 0x6d, 0x72, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x96, 0x43, 0x5c, 0x7e, 0xfb, 0x85, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xba, 0x75, 0xf2, 0x10,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x34, 0x2a, 0x3c, 0x7e, 0xfb, 0x7d,
+    0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0xfb, 0x85, 0x1b, 0x76, 0x93, 0x19, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xb2, 0x08, 0x9a, 0x6d, 0xfb, 0x7d, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3c, 0x7e, 0x95, 0x32,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xf7, 0x4b, 0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x5c, 0x7e, 0xd7, 0x4b, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x93, 0x19,
+    0x1b, 0x76, 0xfb, 0x7d, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3b, 0x86, 0x19, 0x65,
+    0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x78, 0x54, 0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x85, 0xfb, 0x75, 0x53, 0x19, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x93, 0x19, 0x1b, 0x76,
+    0xfa, 0x85, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x5c, 0x7e,
+    0x36, 0x3b, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x17, 0x4c, 0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0x19, 0x65, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xd2, 0x08, 0xba, 0x6d, 0x1b, 0x7e,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x85,
+    0x3c, 0x7e, 0x14, 0x22, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x95, 0x32, 0x5c, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3c, 0x7e, 0x98, 0x5c, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x58, 0x54, 0x3c, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0xfb, 0x85, 0x1c, 0x7e, 0xd4, 0x21, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x92, 0x08, 0x79, 0x6d, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0xf9, 0x5c, 0x31, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xd4, 0x21, 0xfb, 0x75, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0xfb, 0x85, 0x3c, 0x7e, 0xd5, 0x3a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x16, 0x3b, 0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x7d, 0xdb, 0x75,
+    0x33, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x17, 0x4c, 0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0xf9, 0x64, 0x51, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xd9, 0x5c, 0x1b, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x85,
+    0x3c, 0x7e, 0x17, 0x4c, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x59, 0x65, 0x1b, 0x7e, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3b, 0x86, 0xfb, 0x7d, 0x3c, 0x7e, 0x76, 0x43, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x9a, 0x6d, 0x1b, 0x7e, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x3b, 0x86, 0xfb, 0x7d, 0x3c, 0x7e, 0x56, 0x3b, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xba, 0x75, 0x1b, 0x7e, 0x3b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x7d, 0x3c, 0x7e,
+    0x97, 0x43, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xba, 0x75, 0x1b, 0x7e, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xda, 0x7d, 0x3c, 0x7e, 0x58, 0x54, 0x92, 0x08, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x9a, 0x6d, 0x1b, 0x7e, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0xda, 0x7d, 0x3c, 0x7e, 0x3a, 0x65, 0xb4, 0x21, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x39, 0x65, 0x1b, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0x1b, 0x86, 0xfa, 0x7d, 0x1b, 0x7e, 0xfb, 0x75,
+    0x97, 0x43, 0x92, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xb8, 0x5c, 0x1b, 0x7e, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xda, 0x75, 0x3c, 0x7e, 0x7a, 0x6d, 0xd5, 0x32, 0x72, 0x08,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xf7, 0x4b, 0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x7e, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xda, 0x7d, 0xfb, 0x75, 0x3c, 0x7e, 0x5a, 0x6d, 0x16, 0x3b, 0xf3, 0x10, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xf6, 0x3a, 0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xda, 0x7d, 0xda, 0x75, 0xfb, 0x75,
+    0x3c, 0x7e, 0xba, 0x75, 0x58, 0x54, 0x95, 0x32, 0x13, 0x11, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xb4, 0x21, 0xfb, 0x75, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d,
+    0xfa, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xba, 0x75, 0xda, 0x75, 0x1c, 0x7e, 0x3c, 0x7e,
+    0xda, 0x75, 0x19, 0x65, 0x17, 0x54, 0x16, 0x3b, 0x55, 0x2a, 0xd4, 0x21, 0x73, 0x19, 0x53, 0x19,
+    0x53, 0x19, 0x73, 0x19, 0xf4, 0x21, 0xd4, 0x21, 0x92, 0x08, 0x59, 0x65, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d,
+    0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xba, 0x75, 0xba, 0x6d, 0xda, 0x75, 0xfb, 0x75, 0x1c, 0x7e, 0x3c, 0x7e,
+    0x3c, 0x7e, 0x1c, 0x7e, 0xfb, 0x75, 0xfb, 0x75, 0xfb, 0x75, 0xfb, 0x75, 0x3c, 0x7e, 0xda, 0x75,
+    0x11, 0x00, 0x38, 0x54, 0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x7e, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0x9a, 0x6d, 0x9a, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0x9a, 0x6d, 0xfb, 0x75, 0x38, 0x54, 0x11, 0x00, 0x75, 0x2a, 0x3c, 0x7e, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0x9a, 0x65, 0x1b, 0x76, 0x34, 0x2a,
+    0x11, 0x00, 0x92, 0x08, 0x9a, 0x6d, 0x1b, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d,
+    0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0x9a, 0x65, 0xdb, 0x6d, 0x59, 0x6d, 0x72, 0x08, 0x11, 0x00, 0x11, 0x00, 0xd7, 0x4b, 0x3c, 0x7e,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x7e, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0x7a, 0x65, 0x3c, 0x7e, 0x76, 0x43, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x53, 0x19, 0xfb, 0x75, 0xfb, 0x85, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0x9a, 0x65, 0x9a, 0x65,
+    0xba, 0x6d, 0xdb, 0x75, 0xf2, 0x10, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x17, 0x54,
+    0x3c, 0x7e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d,
+    0xfa, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x99, 0x65, 0x3c, 0x76, 0xd7, 0x4b, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x33, 0x11, 0xfb, 0x75, 0xfb, 0x7d, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d,
+    0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0xba, 0x6d,
+    0xda, 0x75, 0xf2, 0x10, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x76, 0x43, 0x3c, 0x7e, 0xfb, 0x85, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x7e, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x79, 0x65, 0x3c, 0x7e, 0x16, 0x3b, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x72, 0x08, 0x39, 0x65, 0x1b, 0x7e, 0xfb, 0x85,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x79, 0x65, 0xfb, 0x75, 0xf9, 0x64,
+    0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x93, 0x19, 0x1b, 0x76, 0xdb, 0x7d, 0xfb, 0x85, 0x1b, 0x7e, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d,
+    0xfa, 0x7d, 0xfa, 0x7d, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x79, 0x65, 0xba, 0x6d, 0xfb, 0x75, 0x53, 0x19, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xd5, 0x32, 0x3c, 0x7e,
+    0xda, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d,
+    0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x99, 0x65, 0x9a, 0x65, 0x3c, 0x7e, 0x75, 0x32, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xb7, 0x4b, 0x5c, 0x7e, 0xda, 0x7d, 0xfb, 0x7d, 0xfb, 0x7d,
+    0xfb, 0x7d, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x7a, 0x65,
+    0x5c, 0x7e, 0x56, 0x43, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x18, 0x4c, 0x3c, 0x7e, 0xda, 0x75, 0xfb, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d,
+    0xfa, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x99, 0x5d, 0x7a, 0x65, 0x5c, 0x7e, 0xd7, 0x4b, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x18, 0x54, 0x5c, 0x7e, 0xba, 0x75,
+    0xda, 0x7d, 0xfa, 0x7d, 0xfa, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x79, 0x5d, 0x7a, 0x65, 0x5c, 0x7e, 0xd7, 0x4b,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x97, 0x43, 0x3c, 0x7e, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x79, 0x5d,
+    0xba, 0x6d, 0x3c, 0x7e, 0x56, 0x43, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xb5, 0x32,
+    0xfb, 0x75, 0x1b, 0x76, 0xba, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75,
+    0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x79, 0x5d, 0x79, 0x5d, 0xfb, 0x75, 0xdb, 0x75, 0x75, 0x32, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x73, 0x19, 0xf9, 0x64, 0x3c, 0x7e, 0xda, 0x75,
+    0xba, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x75, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x79, 0x5d, 0x79, 0x5d, 0xba, 0x6d, 0x3c, 0x7e, 0xd9, 0x5c,
+    0x33, 0x19, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x51, 0x00, 0x36, 0x3b, 0xba, 0x75, 0x3c, 0x7e, 0xda, 0x75, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x79, 0x5d, 0x79, 0x5d, 0xba, 0x65,
+    0x3c, 0x76, 0xba, 0x75, 0xf6, 0x3a, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x13, 0x11,
+    0xd7, 0x4b, 0xdb, 0x75, 0x3c, 0x7e, 0xdb, 0x75, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x79, 0x5d, 0x79, 0x5d,
+    0x79, 0x65, 0xda, 0x6d, 0x3c, 0x76, 0xda, 0x75, 0xb7, 0x4b, 0xf2, 0x10, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x13, 0x11, 0x77, 0x43, 0x7a, 0x6d,
+    0x3c, 0x7e, 0x3c, 0x7e, 0xfb, 0x75, 0xba, 0x6d, 0x9a, 0x6d, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65,
+    0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x9a, 0x65, 0x7a, 0x65, 0x79, 0x65, 0x79, 0x65,
+    0x79, 0x65, 0x9a, 0x65, 0xdb, 0x6d, 0x1c, 0x76, 0x3c, 0x7e, 0x5a, 0x6d, 0x57, 0x43, 0xf2, 0x10,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x72, 0x08, 0x14, 0x2a, 0xd7, 0x4b, 0x39, 0x65, 0xda, 0x75,
+    0x1b, 0x76, 0x1b, 0x76, 0xfb, 0x75, 0xdb, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d,
+    0xba, 0x6d, 0xda, 0x6d, 0xfb, 0x75, 0x1b, 0x76, 0x1b, 0x76, 0xda, 0x75, 0x39, 0x65, 0xd7, 0x4b,
+    0xf4, 0x21, 0x72, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x51, 0x00, 0x73, 0x19, 0xb5, 0x32, 0xb7, 0x4b, 0x98, 0x5c, 0x19, 0x65,
+    0x9a, 0x6d, 0xba, 0x75, 0xda, 0x75, 0xba, 0x75, 0x7a, 0x6d, 0x19, 0x65, 0x98, 0x5c, 0xb7, 0x4b,
+    0x95, 0x32, 0x73, 0x19, 0x51, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+};
+
+const lv_image_dsc_t weather_01n_opaque = {
+    .header.w = 60,
+    .header.h = 60,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.stride = 120,
+    .data_size = 7200,
+    .data = weather_01n_opaque_map,
+};
@@ -0,0 +1,471 @@
+#include "lvgl.h"
+#include "esp_attr.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+/* Source: weather_02d.c | Size: 60x60 | Stride: 120 */
+/* Pre-blended on background 0x00008B | RGB565 little-endian */
+
+const uint8_t weather_02d_opaque_map[] __attribute__((aligned(4))) = {
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xa9, 0x9b,
+    0xa5, 0xed, 0x90, 0x18, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xa7, 0xc4, 0x85, 0xfe, 0x2e, 0x31, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x87, 0xc4,
+    0x44, 0xfe, 0x2e, 0x31, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x87, 0xc4, 0x44, 0xfe, 0x2e, 0x31, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xaf, 0x18, 0xcb, 0x6a, 0x50, 0x08, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xa7, 0xc4,
+    0x64, 0xfe, 0x2e, 0x31, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x0d, 0x52, 0xcd, 0x49, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x0a, 0x7b, 0x25, 0xff, 0x87, 0xbc, 0x50, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x28, 0xac, 0x24, 0xfe, 0xcf, 0x20, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x8b, 0x6a, 0x85, 0xfe, 0x85, 0xed,
+    0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x52, 0x08,
+    0x72, 0x08, 0x51, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xaf, 0x18, 0xe6, 0xd4, 0xa5, 0xfe, 0x87, 0xc4,
+    0x50, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x70, 0x10,
+    0x0f, 0x29, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x8b, 0x6a, 0x44, 0xfe, 0x44, 0xfe, 0x6c, 0x62, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x53, 0x21,
+    0x77, 0x6b, 0x3b, 0x9d, 0x5d, 0xbe, 0xde, 0xd6, 0xfe, 0xd6, 0xbd, 0xce, 0x1c, 0xbe, 0xda, 0x94,
+    0xd6, 0x52, 0xb2, 0x10, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0xb0, 0x18, 0x06, 0xd5, 0xa5, 0xfe, 0x87, 0xbc, 0x70, 0x10, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x8b, 0x6a, 0x44, 0xfe, 0x44, 0xfe, 0x6c, 0x62, 0x11, 0x00,
+    0x11, 0x00, 0xd5, 0x39, 0x7b, 0xa5, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xdf, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xdf, 0x9a, 0x8c, 0x13, 0x19,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xaf, 0x18, 0x06, 0xd5,
+    0x05, 0xff, 0x4c, 0x5a, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x50, 0x08, 0xc4, 0xf5,
+    0x64, 0xfe, 0x6c, 0x62, 0x11, 0x00, 0x72, 0x08, 0x9a, 0x8c, 0xdf, 0xf7, 0xff, 0xff, 0xbf, 0xf7,
+    0x9f, 0xef, 0x9f, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xf7,
+    0x9f, 0xef, 0xdf, 0xf7, 0xff, 0xff, 0x5e, 0xe7, 0x57, 0x63, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xb0, 0x18, 0xcb, 0x6a, 0x70, 0x10, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0xcf, 0x20, 0x6b, 0x6a, 0x68, 0x9b, 0xa8, 0xa3, 0xea, 0x82, 0x8d, 0x41, 0x11, 0x00,
+    0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x0d, 0x52, 0x0d, 0x52, 0x11, 0x00, 0x13, 0x21, 0x5d, 0xc6,
+    0xff, 0xff, 0xbf, 0xf7, 0x9f, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xdf, 0xf7,
+    0xff, 0xff, 0xfa, 0x9c, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x29, 0x8b, 0xa3, 0xf5, 0x44, 0xfe, 0x44, 0xfe,
+    0x43, 0xfe, 0x22, 0xfe, 0xe2, 0xfd, 0x44, 0xc4, 0xed, 0x30, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x13, 0x21, 0xbd, 0xce, 0xff, 0xff, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xff, 0x5b, 0xa5, 0x31, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x30, 0x08, 0x06, 0xbc,
+    0x44, 0xfe, 0x05, 0xfe, 0xc4, 0xf5, 0xc3, 0xfd, 0x07, 0xf6, 0x6e, 0xee, 0xb3, 0xee, 0x35, 0xff,
+    0x95, 0xe6, 0xd7, 0x7b, 0x35, 0x42, 0x51, 0x08, 0x51, 0x08, 0x3d, 0xc6, 0xff, 0xff, 0x9f, 0xef,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xff, 0x9a, 0x8c, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x28, 0x93, 0x44, 0xfe, 0xc5, 0xf5, 0xc2, 0xfd, 0x27, 0xfe, 0xf4, 0xee,
+    0x7e, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x3d, 0xbe,
+    0x9c, 0xad, 0xff, 0xf7, 0x9f, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xff,
+    0x96, 0x4a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xee, 0x28, 0xc3, 0xfd, 0x05, 0xfe,
+    0xc2, 0xfd, 0x6c, 0xf6, 0x7d, 0xe7, 0xbf, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xdf, 0xf7, 0xbe, 0xce, 0x72, 0x08, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0xaa, 0x7a, 0x44, 0xfe, 0xc3, 0xf5, 0x6d, 0xf6, 0x9f, 0xe7, 0xbf, 0xef, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef,
+    0xff, 0xff, 0x57, 0x63, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xeb, 0x7a, 0x09, 0xa4, 0xe9, 0xa3, 0xc9, 0xa3,
+    0x09, 0xa4, 0x4a, 0x8b, 0x50, 0x08, 0x11, 0x00, 0x11, 0x00, 0xc7, 0xab, 0x23, 0xfe, 0x28, 0xf6,
+    0x7e, 0xe7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xff, 0xff, 0x3d, 0xbe, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x24, 0xfe, 0xc5, 0xfe, 0xa5, 0xfe, 0xa5, 0xfe, 0xc5, 0xfe, 0x64, 0xfe, 0xef, 0x20, 0x11, 0x00,
+    0x11, 0x00, 0x07, 0xb4, 0x23, 0xfe, 0xf8, 0xe6, 0xbf, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xef, 0x74, 0x29, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x0f, 0x29, 0x0d, 0x52, 0xed, 0x51, 0xed, 0x51,
+    0x0d, 0x52, 0x4e, 0x39, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x66, 0x9b, 0x8a, 0xfe, 0x7f, 0xe7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xff, 0x37, 0x63, 0x11, 0x00,
+    0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x0a, 0x62, 0x13, 0xff, 0xbf, 0xe7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0x9f, 0xef, 0xff, 0xff, 0x79, 0x8c, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x50, 0x10, 0x99, 0xd6, 0xff, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xf7, 0xff, 0xff, 0x3b, 0x9d, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x31, 0x00, 0x5d, 0xc6, 0xff, 0xff, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0x9f, 0xef, 0xff, 0xff, 0x7b, 0xa5, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x7d, 0xc6, 0xff, 0xff,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xff, 0x5b, 0xa5, 0x31, 0x00,
+    0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x94, 0x31, 0x39, 0x84, 0x3e, 0xdf, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0x9f, 0xef, 0xff, 0xff, 0x39, 0x7c, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x13, 0x21, 0x3b, 0xa5, 0xbf, 0xef, 0xff, 0xff, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xbf, 0xef, 0x3d, 0xbe, 0x79, 0x84,
+    0x17, 0x5b, 0x13, 0x21, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x35, 0x42, 0x3e, 0xdf, 0xff, 0xff,
+    0xbf, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef,
+    0xbf, 0xef, 0x9f, 0xef, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 0x1a, 0x9d, 0x53, 0x21,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x15, 0x3a, 0x9f, 0xef, 0xdf, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x7f, 0xef,
+    0x7f, 0xef, 0x9f, 0xef, 0xff, 0xf7, 0x7f, 0xe7, 0xd6, 0x5a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xd2, 0x18, 0x1e, 0xdf, 0xdf, 0xf7, 0x9f, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x7f, 0xe7, 0x9f, 0xef,
+    0xff, 0xf7, 0x17, 0x5b, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xba, 0x94,
+    0xff, 0xff, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x7f, 0xe7, 0x7f, 0xe7, 0xbf, 0xef, 0xb4, 0x31, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x13, 0x21, 0x7f, 0xe7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x5f, 0xe7, 0xdf, 0xf7, 0xfc, 0xb5, 0x31, 0x00, 0x31, 0x00, 0x11, 0x00, 0x97, 0x6b, 0xff, 0xff,
+    0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0xdf, 0xef, 0x75, 0x4a,
+    0x11, 0x00, 0x11, 0x00, 0x5b, 0xa5, 0xff, 0xff, 0x9f, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x5f, 0xe7, 0xdf, 0xf7, 0x1a, 0x9d, 0x11, 0x00, 0x11, 0x00, 0x3d, 0xbe, 0xff, 0xff,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x9f, 0xef, 0xbd, 0xce,
+    0x11, 0x00, 0x11, 0x00, 0x3d, 0xbe, 0xff, 0xff, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xe7, 0x11, 0x00, 0x11, 0x00, 0x3d, 0xbe, 0xff, 0xff,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x11, 0x00, 0x11, 0x00, 0x5b, 0xa5, 0xff, 0xff, 0x9f, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x5f, 0xe7, 0x9f, 0xe7, 0xfe, 0xd6, 0x31, 0x00, 0x11, 0x00, 0x97, 0x6b, 0xff, 0xff,
+    0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xdf, 0xbf, 0xef, 0xbc, 0xb5,
+    0x11, 0x00, 0x11, 0x00, 0x13, 0x21, 0x7f, 0xe7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x3f, 0xdf, 0xdf, 0xf7, 0x77, 0x6b, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xba, 0x94,
+    0xff, 0xff, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xdf, 0x7f, 0xe7, 0xde, 0xd6, 0xb2, 0x10,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xd2, 0x18, 0x1e, 0xdf, 0xdf, 0xf7, 0x9f, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xe7,
+    0x3f, 0xdf, 0xff, 0xff, 0x37, 0x63, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x15, 0x3a, 0x9f, 0xef, 0xdf, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x5f, 0xe7, 0x5f, 0xdf, 0x3f, 0xdf, 0xff, 0xff, 0x1a, 0x9d, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x35, 0x42, 0x3e, 0xdf, 0xff, 0xff,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xdf, 0x5f, 0xdf, 0x3f, 0xdf, 0x9f, 0xe7, 0xff, 0xff,
+    0x3a, 0x9d, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x13, 0x21, 0x3a, 0x9d, 0x9f, 0xef, 0xff, 0xff, 0xdf, 0xf7, 0xdf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xe7, 0x7f, 0xe7,
+    0xbf, 0xef, 0xdf, 0xf7, 0xfe, 0xd6, 0x57, 0x63, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xb4, 0x31, 0x79, 0x84, 0x5d, 0xc6, 0x3e, 0xdf, 0x7f, 0xe7, 0x7f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x1e, 0xdf, 0xdc, 0xb5, 0x97, 0x6b, 0xb2, 0x10, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+};
+
+const lv_image_dsc_t weather_02d_opaque = {
+    .header.w = 60,
+    .header.h = 60,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.stride = 120,
+    .data_size = 7200,
+    .data = weather_02d_opaque_map,
+};
@@ -0,0 +1,471 @@
+#include "lvgl.h"
+#include "esp_attr.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+/* Source: weather_02n.c | Size: 60x60 | Stride: 120 */
+/* Pre-blended on background 0x00008B | RGB565 little-endian */
+
+const uint8_t weather_02n_opaque_map[] __attribute__((aligned(4))) = {
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xf2, 0x10, 0xb5, 0x32, 0x58, 0x54,
+    0xdb, 0x75, 0x97, 0x43, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x13, 0x11,
+    0xd7, 0x4b, 0xba, 0x75, 0x5c, 0x86, 0x3c, 0x8e, 0x9d, 0x8e, 0x75, 0x32, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x16, 0x3b, 0xfb, 0x7d, 0x7d, 0x8e, 0x3b, 0x8e, 0x1b, 0x86, 0x1b, 0x86,
+    0x3c, 0x86, 0x93, 0x19, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x72, 0x00, 0x58, 0x54, 0x7d, 0x8e, 0x3b, 0x8e,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x7e, 0x53, 0x19, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x72, 0x00,
+    0xd9, 0x5c, 0x7d, 0x8e, 0xfb, 0x85, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x53, 0x19, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x92, 0x10, 0x76, 0x4a, 0x59, 0x84, 0x9b, 0xad, 0x3d, 0xbe, 0x7d, 0xc6,
+    0x3d, 0xbe, 0x9c, 0xad, 0x79, 0x8c, 0xd6, 0x52, 0xd2, 0x18, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x58, 0x54, 0x7d, 0x8e, 0xfb, 0x85, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x5c, 0x86, 0xb4, 0x21, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x33, 0x21, 0x99, 0x8c, 0x1e, 0xd7, 0xff, 0xf7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x3e, 0xdf, 0xfa, 0x94, 0x94, 0x29, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xd5, 0x32, 0x7d, 0x8e,
+    0xfb, 0x85, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x7d, 0x8e, 0x95, 0x32, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xd8, 0x73,
+    0x7f, 0xe7, 0xff, 0xff, 0xdf, 0xf7, 0x9f, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0x9f, 0xef, 0xdf, 0xf7, 0xff, 0xff, 0x9f, 0xef, 0x79, 0x8c,
+    0x72, 0x08, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0xd2, 0x10, 0xfb, 0x7d, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x7d, 0x8e, 0xd7, 0x4b, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0xb2, 0x10, 0xdc, 0xb5, 0xff, 0xff, 0xbf, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xff, 0xff, 0x5d, 0xc6, 0x33, 0x21, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x97, 0x43, 0x7d, 0x8e, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x3b, 0x8e, 0x79, 0x6d, 0x51, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0xd3, 0x18, 0x9d, 0xc6, 0xff, 0xff, 0x9f, 0xef,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef,
+    0xff, 0xff, 0x1e, 0xdf, 0x74, 0x29, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x92, 0x08, 0x9a, 0x75, 0x3b, 0x8e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x5c, 0x86, 0x14, 0x22, 0x52, 0x08,
+    0xd4, 0x31, 0xd6, 0x52, 0x17, 0x5b, 0xb6, 0x52, 0xb4, 0x31, 0x52, 0x08, 0x11, 0x00, 0x52, 0x08,
+    0x3d, 0xbe, 0xff, 0xff, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xf7, 0xde, 0xd6, 0xd2, 0x18,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x75, 0x2a, 0x5c, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0xfb, 0x7d, 0x5c, 0x96, 0x5c, 0xae, 0xbd, 0xce, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xef, 0xde, 0xd6, 0xf8, 0x7b, 0xfa, 0x9c, 0xff, 0xff, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xff, 0x9b, 0xad, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x17, 0x4c, 0x5c, 0x8e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xbd, 0xb6, 0x7f, 0xe7, 0xdf, 0xf7, 0xff, 0xf7,
+    0xbf, 0xf7, 0x9f, 0xf7, 0x9f, 0xef, 0x9f, 0xf7, 0xbf, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xf7,
+    0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xff,
+    0xf7, 0x5a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x19, 0x65, 0x3c, 0x8e, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0xfd, 0xbe,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xdf, 0xf7, 0xbe, 0xce, 0x52, 0x08, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xba, 0x75, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x3b, 0x86, 0x1b, 0x86, 0xdd, 0xb6, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef,
+    0xff, 0xff, 0xd6, 0x52, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xfa, 0x7d, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3b, 0x86, 0x1b, 0x86, 0x7c, 0x9e, 0x9f, 0xef, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xf7, 0xff, 0xff, 0x7b, 0xa5, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0xda, 0x75, 0x3b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1e, 0xcf, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xdf, 0xf7, 0x1e, 0xdf, 0x92, 0x10, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x59, 0x6d, 0x3b, 0x8e, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x5c, 0x96, 0x9f, 0xe7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xdf, 0xef, 0xb4, 0x31, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x58, 0x54, 0x5c, 0x8e, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3b, 0x86, 0x1b, 0x7e,
+    0xbd, 0xae, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0x9f, 0xf7, 0xff, 0xff, 0x96, 0x4a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xf5, 0x3a, 0x5c, 0x86, 0x1b, 0x86, 0x1b, 0x86,
+    0x1b, 0x86, 0x1b, 0x86, 0x3b, 0x8e, 0x1b, 0x86, 0xdd, 0xbe, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xff, 0x17, 0x5b, 0x11, 0x00,
+    0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x13, 0x11, 0xdb, 0x7d, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x1b, 0x86, 0x3b, 0x8e, 0xfb, 0x7d,
+    0xfd, 0xbe, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0x9f, 0xef, 0xff, 0xff, 0x17, 0x5b, 0x11, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x58, 0x54, 0x7c, 0x8e, 0x1b, 0x86,
+    0x3b, 0x86, 0x1b, 0x86, 0xfb, 0x7d, 0x1b, 0x86, 0xfe, 0xc6, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0x9f, 0xef, 0xff, 0xf7, 0x55, 0x42, 0x11, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x93, 0x19, 0x5c, 0x86, 0x1b, 0x86, 0xfb, 0x7d, 0x3b, 0x8e, 0xdd, 0xbe, 0x5f, 0xdf,
+    0x9f, 0xef, 0xbf, 0xef, 0xdf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0x9f, 0xef, 0xbf, 0xef, 0x96, 0x4a, 0xb2, 0x10, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0xf7, 0x4b, 0x5c, 0x86,
+    0x9c, 0xae, 0x7f, 0xe7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0x7f, 0xe7, 0x7f, 0xe7, 0x1e, 0xdf,
+    0xfc, 0xb5, 0xb8, 0x73, 0xd3, 0x18, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x71, 0x00, 0x7d, 0xae, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0x3e, 0xdf, 0x77, 0x6b,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x98, 0x6b, 0xdf, 0xf7,
+    0xbf, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x7f, 0xef, 0x7f, 0xe7, 0xbf, 0xef, 0xff, 0xff, 0x1a, 0x9d, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0xb4, 0x31, 0xdf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x7f, 0xef, 0x5f, 0xe7,
+    0xff, 0xff, 0xfa, 0x94, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x9c, 0xad, 0xff, 0xff, 0x9f, 0xef,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x5f, 0xe7, 0xff, 0xff, 0xf6, 0x5a, 0x11, 0x00,
+    0xb4, 0x31, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x7f, 0xe7, 0xbf, 0xef, 0xde, 0xce, 0x92, 0x10, 0x39, 0x84, 0xff, 0xff, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x5f, 0xe7, 0xdf, 0xf7, 0x37, 0x63,
+    0xdc, 0xb5, 0xff, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x5f, 0xe7, 0xbf, 0xef, 0x9c, 0xad, 0x7d, 0xc6, 0xdf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x9f, 0xef, 0xde, 0xd6,
+    0x9d, 0xc6, 0xdf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5d, 0xc6, 0xff, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xe7,
+    0x1b, 0x9d, 0xff, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x5f, 0xe7, 0x9f, 0xe7, 0xde, 0xce, 0x17, 0x5b, 0xff, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xdf, 0xbf, 0xef, 0x5b, 0xa5,
+    0x92, 0x10, 0xde, 0xd6, 0xdf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x5f, 0xdf, 0xdf, 0xef, 0xb6, 0x52, 0x11, 0x00, 0xb8, 0x6b, 0xff, 0xff, 0x9f, 0xef,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x3f, 0xdf, 0xbf, 0xef, 0x5d, 0xc6, 0x51, 0x08,
+    0x11, 0x00, 0x51, 0x08, 0x3d, 0xbe, 0xff, 0xff, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef,
+    0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xdf,
+    0x3f, 0xdf, 0xff, 0xf7, 0x55, 0x42, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x13, 0x21, 0xfe, 0xd6,
+    0xff, 0xff, 0x9f, 0xef, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x5f, 0xe7, 0x5f, 0xe7, 0x3f, 0xdf, 0x3f, 0xdf, 0xff, 0xff, 0x19, 0x7c, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x33, 0x21, 0x7d, 0xc6, 0xff, 0xff, 0xdf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xe7, 0x5f, 0xdf, 0x3f, 0xdf, 0x3f, 0xdf, 0xbf, 0xef, 0xff, 0xf7,
+    0x19, 0x7c, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x52, 0x08, 0x19, 0x7c, 0x3e, 0xdf, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xf7, 0xbf, 0xf7, 0xbf, 0xf7,
+    0xbf, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef,
+    0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x9f, 0xe7,
+    0xbf, 0xef, 0xdf, 0xef, 0x5d, 0xc6, 0x75, 0x4a, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x13, 0x19, 0xb8, 0x73,
+    0xdc, 0xb5, 0xfe, 0xd6, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7, 0x7f, 0xe7,
+    0x7f, 0xe7, 0x7f, 0xe7, 0x5f, 0xe7, 0xbe, 0xce, 0x5b, 0xa5, 0xd6, 0x52, 0x31, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+};
+
+const lv_image_dsc_t weather_02n_opaque = {
+    .header.w = 60,
+    .header.h = 60,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.stride = 120,
+    .data_size = 7200,
+    .data = weather_02n_opaque_map,
+};
@@ -0,0 +1,471 @@
+#include "lvgl.h"
+#include "esp_attr.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+/* Source: weather_50.c | Size: 60x60 | Stride: 120 */
+/* Pre-blended on background 0x00008B | RGB565 little-endian */
+
+const uint8_t weather_50_opaque_map[] __attribute__((aligned(4))) = {
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x92, 0x10, 0xd8, 0x94, 0xbc, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xce, 0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6,
+    0x39, 0xc6, 0x39, 0xc6, 0x77, 0x8c, 0x92, 0x10, 0xb8, 0x94, 0x3d, 0xe7, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x59, 0xc6,
+    0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0xbb, 0xd6, 0x56, 0x8c,
+    0xdb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce,
+    0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce,
+    0x5a, 0xce, 0x5a, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6,
+    0x39, 0xc6, 0x39, 0xc6, 0x19, 0xbe, 0x39, 0xc6, 0x3a, 0xc6, 0xfc, 0xde, 0x9b, 0xce, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xce, 0x9b, 0xce, 0x9b, 0xce, 0x9b, 0xce, 0x9a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xc6, 0x5a, 0xc6,
+    0x5a, 0xc6, 0x5a, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6,
+    0x39, 0xc6, 0x19, 0xc6, 0x19, 0xbe, 0x19, 0xbe, 0x19, 0xbe, 0xf8, 0xbd, 0x59, 0xc6, 0x98, 0xad,
+    0x75, 0x4a, 0xdc, 0xd6, 0x5d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7,
+    0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7,
+    0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7,
+    0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7,
+    0x1d, 0xe7, 0x1d, 0xdf, 0x1d, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde,
+    0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xdc, 0xde, 0xdc, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0x9b, 0xce,
+    0x9a, 0xce, 0x9a, 0xce, 0x19, 0xbe, 0x34, 0x42, 0x11, 0x00, 0x33, 0x21, 0x16, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x35, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x63,
+    0x15, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x5b, 0x15, 0x5b, 0x15, 0x5b, 0x15, 0x5b, 0xf5, 0x5a,
+    0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a,
+    0xf5, 0x5a, 0xf5, 0x5a, 0xf4, 0x5a, 0xd4, 0x5a, 0xf5, 0x5a, 0xd5, 0x5a, 0x12, 0x21, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x31, 0x00, 0x94, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31,
+    0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31,
+    0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31,
+    0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31,
+    0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31,
+    0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31,
+    0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31,
+    0x93, 0x31, 0x73, 0x29, 0x31, 0x00, 0x11, 0x00, 0x73, 0x29, 0xda, 0xb5, 0x1c, 0xdf, 0xfc, 0xde,
+    0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf,
+    0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf,
+    0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf,
+    0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde, 0xfc, 0xde,
+    0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xdc, 0xde, 0xdc, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6,
+    0xdb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x9a, 0xce, 0x58, 0xad, 0x53, 0x29,
+    0xb9, 0xb5, 0x3d, 0xe7, 0x9b, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0x9b, 0xd6, 0x9b, 0xce, 0x9b, 0xce, 0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xc6, 0x5a, 0xc6,
+    0x5a, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6,
+    0x39, 0xc6, 0x19, 0xc6, 0x9a, 0xce, 0x37, 0xa5, 0xdb, 0xd6, 0x9b, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6,
+    0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x18, 0xbe, 0x39, 0xc6,
+    0xb9, 0xb5, 0x3d, 0xe7, 0x9b, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xce,
+    0x9b, 0xce, 0x9b, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x5a, 0xc6, 0x5a, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x39, 0xc6,
+    0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x19, 0xc6, 0x19, 0xc6, 0x19, 0xbe,
+    0x19, 0xbe, 0x18, 0xbe, 0x7a, 0xce, 0x17, 0xa5, 0x73, 0x29, 0xda, 0xb5, 0x1c, 0xdf, 0xfc, 0xde,
+    0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf,
+    0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf,
+    0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde,
+    0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xdc, 0xde, 0xdc, 0xde, 0xdc, 0xd6, 0xdb, 0xd6,
+    0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce, 0x59, 0xc6, 0x5a, 0xce, 0x38, 0xa5, 0x52, 0x21,
+    0x11, 0x00, 0x31, 0x00, 0x94, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31,
+    0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31,
+    0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31,
+    0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0xb3, 0x31, 0x93, 0x31,
+    0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31,
+    0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31, 0x93, 0x31,
+    0x93, 0x31, 0x93, 0x31, 0x93, 0x29, 0x93, 0x29, 0x93, 0x29, 0x93, 0x29, 0x93, 0x29, 0x73, 0x29,
+    0x93, 0x29, 0x73, 0x29, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0x31, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x33, 0x21, 0x16, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x36, 0x63,
+    0x36, 0x63, 0x36, 0x63, 0x36, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x63,
+    0x15, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x63, 0x15, 0x5b, 0x15, 0x5b, 0x15, 0x5b, 0x15, 0x5b,
+    0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0xf5, 0x5a, 0x32, 0x21, 0x11, 0x00,
+    0x75, 0x4a, 0xdc, 0xd6, 0x5d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7,
+    0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7,
+    0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7,
+    0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7,
+    0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x1d, 0xe7, 0x1d, 0xdf,
+    0x1d, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde,
+    0xfc, 0xde, 0xdc, 0xde, 0xdc, 0xd6, 0xdc, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0x5a, 0xc6, 0x34, 0x42, 0x3a, 0xc6, 0xfc, 0xde, 0x9b, 0xce, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xce, 0x9b, 0xce, 0x9b, 0xce,
+    0x9b, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce,
+    0x5a, 0xce, 0x5a, 0xc6, 0x5a, 0xc6, 0x5a, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6,
+    0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x19, 0xc6, 0x19, 0xc6, 0x19, 0xbe, 0x59, 0xc6, 0xb8, 0xb5,
+    0xdb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0x9b, 0xce, 0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce,
+    0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce,
+    0x5a, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6,
+    0x39, 0xc6, 0x39, 0xc6, 0x19, 0xbe, 0x39, 0xc6, 0xb8, 0x94, 0x3d, 0xe7, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0x9b, 0xd6, 0x9b, 0xce,
+    0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x39, 0xc6,
+    0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x18, 0xbe, 0x9a, 0xce, 0x36, 0x84,
+    0x92, 0x10, 0xd8, 0x94, 0xbc, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6,
+    0x9b, 0xd6, 0x9b, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce,
+    0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6,
+    0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x19, 0xc6,
+    0x18, 0xbe, 0x19, 0xbe, 0x56, 0x84, 0x92, 0x10, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+    0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00,
+};
+
+const lv_image_dsc_t weather_50_opaque = {
+    .header.w = 60,
+    .header.h = 60,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.stride = 120,
+    .data_size = 7200,
+    .data = weather_50_opaque_map,
+};
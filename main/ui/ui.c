@@ -4,6 +4,8 @@
 #include "ui.h"
 #include "ui_events.h"
 #include "ui_internal.h"
+#include "ui_styles.h"
+#include "ui_subjects.h"
 #include "t_display_s3.h"
 
 
@@ -13,6 +15,13 @@ static const char *TAG = "UI";
 // UI Global Variables
 QueueHandle_t ui_queue = NULL;
 
+// Built once on first use, then switched with lv_screen_load()
+static lv_obj_t *connecting_screen = NULL;
+static lv_obj_t *connecting_label = NULL;
+
+// Set when a weather refresh still has to reach the subjects
+static bool s_weather_pending = false;
+
 // Initialize UI Queue
 void ui_init_queue(void)
 {
@@ -53,42 +62,74 @@ void update_ui(void)
             show_connecting_message(msg.payload.wpa_data.ssid);
             break;
 
+        case UI_CMD_SET_ROTATION:
+            // The panel now scans the other way: redraw everything in the new orientation
+            lcd_set_rotation(msg.payload.rotation == 180 ? LCD_ROTATION_180 : LCD_ROTATION_0);
+            lv_obj_invalidate(lv_screen_active());
+            break;
+
+        case UI_CMD_WEATHER_UPDATED:
+            s_weather_pending = true;
+            break;
+
         default:
             break;
         }
     }
+    if (s_weather_pending)
+    {
+        // Retried on the next call if the weather data is busy
+        s_weather_pending = !ui_subjects_publish_weather();
+    }
     if (s_show_clock_mode)
     {
         tick_clock();
     }
 }
 
+static void apply_screen_style(lv_obj_t *scr)
+{
+    ui_styles_init();
+    lv_obj_add_style(scr, &style_screen, 0);
+}
+
+lv_obj_t *create_screen(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    apply_screen_style(scr);
+    return scr;
+}
+
 void ui_init(void)
 {
-    /*Change the active screen's background color*/
-    lv_obj_set_style_bg_color(lv_screen_active(), lv_color_hex(0x003a57), LV_PART_MAIN);
+    /*The display's default screen is the boot screen*/
+    apply_screen_style(lv_screen_active());
 
     /*Create a white label, set its text and align it to the center*/
     lv_obj_t *label_status = lv_label_create(lv_screen_active());
     lv_label_set_text(label_status, "Booting...");
-    lv_obj_set_style_text_color(lv_screen_active(), lv_color_hex(0xffffff), LV_PART_MAIN);
     lv_obj_align(label_status, LV_ALIGN_CENTER, 0, 0);
 }
 
 void show_connecting_message(const char *ssid)
 {
-    // 1. Clear the screen
-    lv_obj_clean(lv_screen_active());
-
-    // 2. Create the label
-    lv_obj_t *label_status = lv_label_create(lv_screen_active());
+    // 1. Build the screen on first use
+    if (connecting_screen == NULL)
+    {
+        connecting_screen = create_screen();
+        connecting_label = lv_label_create(connecting_screen);
+        lv_obj_add_style(connecting_label, &style_value_label, 0);
+        lv_obj_align(connecting_label, LV_ALIGN_CENTER, 0, 0);
+    }
 
-    // 3. Set the text
-    lv_label_set_text_fmt(label_status, "Connecting to\n%s...", ssid);
+    // 2. Update the text only
+    lv_label_set_text_fmt(connecting_label, "Connecting to\n%s...", ssid);
 
-    // 4. Style the text
-    lv_obj_set_style_text_color(label_status, lv_color_white(), 0); // White text
-    lv_obj_align(label_status, LV_ALIGN_CENTER, 0, 0);
+    // 3. Show it
+    if (lv_screen_active() != connecting_screen)
+    {
+        lv_screen_load(connecting_screen);
+    }
 }
 
 
@@ -47,6 +47,30 @@ void ui_show_clock(void)
     }
 }
 
+void ui_set_rotation(uint16_t degrees)
+{
+    if (ui_queue != NULL)
+    {
+        ui_msg_t msg;
+        msg.cmd = UI_CMD_SET_ROTATION;
+        msg.payload.rotation = degrees;
+
+        xQueueSend(ui_queue, &msg, pdMS_TO_TICKS(10));
+    }
+}
+
+void ui_weather_updated(void)
+{
+    if (ui_queue != NULL)
+    {
+        ui_msg_t msg;
+        msg.cmd = UI_CMD_WEATHER_UPDATED;
+        msg.payload.url[0] = 0; // Not used
+
+        xQueueSend(ui_queue, &msg, pdMS_TO_TICKS(10));
+    }
+}
+
 void ui_show_connecting(const char *ssid)
 {
     if (ui_queue != NULL)
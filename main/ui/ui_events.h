@@ -10,7 +10,9 @@ typedef enum
     UI_CMD_SHOW_AP_QR,     // Display AP QR Code
     UI_CMD_SHOW_CONFIG_QR, // Display Configuration QR Code
     UI_CMD_SHOW_CLOCK,     // Display main screen (connected)
-    UI_CMD_WIFI_CONNECTING // Display "Connecting..." screen
+    UI_CMD_WIFI_CONNECTING, // Display "Connecting..." screen
+    UI_CMD_SET_ROTATION,    // Flip the panel orientation
+    UI_CMD_WEATHER_UPDATED  // New weather data: publish it to the UI subjects
 } ui_cmd_t;
 
 
@@ -23,6 +25,7 @@ typedef struct
     {
         wpa_info_t wpa_data; // SSID and PSK for Wi-Fi
         char url[128]; // Buffer for Configuration URL
+        uint16_t rotation; // Panel rotation in degrees (0 or 180)
     } payload;
 
 } ui_msg_t;
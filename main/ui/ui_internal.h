@@ -1,5 +1,9 @@
 #pragma once
 #include <esp_lvgl_port.h>
+#include "typedefs.h"
+
+// New screen with the common background and text colour
+lv_obj_t *create_screen(void);
 
 void show_connecting_message(const char *ssid);
 
@@ -8,12 +12,12 @@ void show_config_qrcode(const char *url);
 void show_qrcode(lv_obj_t **qr_code_obj_ptr, lv_obj_t **label_status_ptr);
 
 void setup_clock_screen(void);
+void build_clock_screen(lv_obj_t *scr);
 void setup_clock_panel(lv_obj_t *parent);
 void setup_weather_panel(lv_obj_t *parent);
 void setup_precipitation_panel(lv_obj_t *parent);
 
 void tick_clock(void);
-void update_weather_display(void);
 
 
 extern bool s_show_clock_mode;
@@ -24,10 +28,18 @@ extern lv_obj_t *label_weekday;
 extern lv_obj_t *label_date;
 
 extern lv_obj_t *precipitation_chart;
-extern lv_chart_series_t *precipitation_series;
 
 extern lv_obj_t *right_label;
 
+extern lv_obj_t *label_hhmm;
+extern lv_obj_t *label_ss;
+
 extern lv_obj_t *temp_label;
 extern lv_obj_t *feels_label;
+extern lv_obj_t *pressure_label;
+extern lv_obj_t *humidity_label;
+extern lv_obj_t *dew_label;
+extern lv_obj_t *uvi_label;
+extern lv_obj_t *ws_label;
+extern lv_obj_t *wd_label;
 extern lv_obj_t *icon_img;
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include <string.h>
+#include "esp_log.h"
+#include "ui_layout.h"
+
+static const char *TAG = "UI_LAYOUT";
+
+#define SAMPLE_MAX_LEN 32
+#define MAX_SAMPLES 16
+
+// Copy sample with every digit replaced by the widest digit of font
+static void widest_text(const lv_font_t *font, const char *sample, char *out, size_t max_len)
+{
+    char widest = '0';
+    uint16_t widest_w = 0;
+    for (char c = '0'; c <= '9'; c++)
+    {
+        uint16_t w = lv_font_get_glyph_width(font, c, 0);
+        if (w > widest_w)
+        {
+            widest_w = w;
+            widest = c;
+        }
+    }
+
+    size_t i = 0;
+    for (; sample[i] != '\0' && i < max_len - 1; i++)
+    {
+        out[i] = (sample[i] >= '0' && sample[i] <= '9') ? widest : sample[i];
+    }
+    out[i] = '\0';
+}
+
+// Text alignment that keeps a label where its layout placed it when the text gets shorter
+static lv_text_align_t placed_text_align(lv_obj_t *label)
+{
+    lv_obj_t *parent = lv_obj_get_parent(label);
+    uint32_t layout = lv_obj_get_style_layout(parent, LV_PART_MAIN);
+
+    if (layout == LV_LAYOUT_GRID)
+    {
+        lv_grid_align_t align = lv_obj_get_style_grid_cell_x_align(label, LV_PART_MAIN);
+        return align == LV_GRID_ALIGN_START ? LV_TEXT_ALIGN_LEFT
+               : align == LV_GRID_ALIGN_END ? LV_TEXT_ALIGN_RIGHT
+                                            : LV_TEXT_ALIGN_CENTER;
+    }
+    if (layout == LV_LAYOUT_FLEX)
+    {
+        // Horizontal placement: cross axis in a column, main axis in a row
+        bool column = lv_obj_get_style_flex_flow(parent, LV_PART_MAIN) & LV_FLEX_COLUMN;
+        lv_flex_align_t align = column ? lv_obj_get_style_flex_cross_place(parent, LV_PART_MAIN)
+                                       : lv_obj_get_style_flex_main_place(parent, LV_PART_MAIN);
+        return align == LV_FLEX_ALIGN_START ? LV_TEXT_ALIGN_LEFT
+               : align == LV_FLEX_ALIGN_END ? LV_TEXT_ALIGN_RIGHT
+                                            : LV_TEXT_ALIGN_CENTER;
+    }
+    return lv_obj_get_style_text_align(label, LV_PART_MAIN);
+}
+
+// Pins the children of parent (recursively), then turns the parent's layout off
+static uint32_t freeze_children(lv_obj_t *parent)
+{
+    uint32_t frozen = 0;
+    uint32_t count = lv_obj_get_child_count(parent);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        lv_obj_t *child = lv_obj_get_child(parent, i);
+        int32_t x = lv_obj_get_x(child);
+        int32_t y = lv_obj_get_y(child);
+        int32_t w = lv_obj_get_width(child);
+        int32_t h = lv_obj_get_height(child);
+
+        if (lv_obj_check_type(child, &lv_label_class))
+        {
+            lv_obj_set_style_text_align(child, placed_text_align(child), 0);
+            lv_label_set_long_mode(child, LV_LABEL_LONG_CLIP);
+        }
+
+        frozen += freeze_children(child);
+
+        lv_obj_set_align(child, LV_ALIGN_TOP_LEFT);
+        lv_obj_set_pos(child, x, y);
+        lv_obj_set_size(child, w, h);
+        lv_obj_remove_flag(child, LV_OBJ_FLAG_SCROLLABLE);
+        frozen++;
+    }
+
+    if (lv_obj_get_style_layout(parent, LV_PART_MAIN) != LV_LAYOUT_NONE)
+    {
+        lv_obj_set_layout(parent, LV_LAYOUT_NONE);
+    }
+    return frozen;
+}
+
+void ui_freeze_layout(lv_obj_t *root, const ui_label_sample_t *samples, size_t count)
+{
+    char *saved[MAX_SAMPLES];
+    char text[SAMPLE_MAX_LEN];
+
+    if (count > MAX_SAMPLES)
+    {
+        ESP_LOGW(TAG, "Only the first %d label samples are used", MAX_SAMPLES);
+        count = MAX_SAMPLES;
+    }
+
+    // Lay out once with the widest text each label can show
+    for (size_t i = 0; i < count; i++)
+    {
+        saved[i] = lv_strdup(lv_label_get_text(samples[i].label));
+        widest_text(lv_obj_get_style_text_font(samples[i].label, LV_PART_MAIN), samples[i].sample, text, sizeof(text));
+        lv_label_set_text(samples[i].label, text);
+    }
+    lv_obj_update_layout(root);
+
+    uint32_t frozen = freeze_children(root);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        lv_label_set_text(samples[i].label, saved[i]);
+        lv_free(saved[i]);
+    }
+
+    ESP_LOGI(TAG, "Fixed geometry for %lu objects", (unsigned long)frozen);
+}
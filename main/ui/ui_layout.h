@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stddef.h>
+#include <esp_lvgl_port.h>
+
+// Text a label must have room for. Digits stand for any digit: they are
+// replaced by the widest digit of the label's font.
+typedef struct
+{
+    lv_obj_t *label;
+    const char *sample;
+} ui_label_sample_t;
+
+/**
+ * @brief Pin every object under root to its current layout result.
+ *        The layout runs once with each label showing its sample text, then
+ *        all positions and sizes become fixed and the layouts are turned off.
+ *        Label texts are restored and keep the alignment the layout gave them.
+ *
+ * @param root    Screen or container to freeze (its own position is kept)
+ * @param samples Labels whose text changes at runtime
+ * @param count   Number of entries in samples
+ */
+void ui_freeze_layout(lv_obj_t *root, const ui_label_sample_t *samples, size_t count);
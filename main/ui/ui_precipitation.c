@@ -1,97 +1,126 @@
 #include <esp_lvgl_port.h>
-#include <string.h>
 #include "ui_internal.h"
-#include "openweather_service.h"
+#include "ui_styles.h"
+#include "ui_subjects.h"
 
 lv_obj_t *precipitation_chart = NULL;
-lv_chart_series_t *precipitation_series = NULL;
 
 
-static const int HEAVY_RAIN_THRESHOLD = 60;  // mm/h
-static const int MEDIUM_RAIN_THRESHOLD = 30; // mm/h
-static const int LIGHT_RAIN_THRESHOLD = 10;  // mm/h
+// Chart geometry: 1px gap between bars, dashed division lines
+#define BAR_GAP 1
+#define HOR_DIV_LINES 4
+#define VER_DIV_LINES 7
 
-static void chart_draw_event_cb(lv_event_t *e);
+static const uint32_t bar_palette[PRECIP_INTENSITY_COUNT] = {
+    [PRECIP_LIGHT] = 0x00BFFF,   // Light blue for low precipitation
+    [PRECIP_MEDIUM] = 0x1E90FF,  // Medium blue for moderate precipitation
+    [PRECIP_HEAVY] = 0x0000FF,   // Dark blue for high precipitation
+    [PRECIP_EXTREME] = 0xFF0000, // Red for very high precipitation
+};
+
+static void precipitation_draw_event_cb(lv_event_t *e);
+
+// A new series was published: redraw the bars from it
+static void precipitation_observer_cb(lv_observer_t *observer, lv_subject_t *subject)
+{
+    LV_UNUSED(subject);
+    lv_obj_invalidate(lv_observer_get_target_obj(observer));
+}
 
 void setup_precipitation_panel(lv_obj_t *parent)
 {
     // Bottom container (Graph/precipitation)
     lv_obj_t *bottom_cont = lv_obj_create(parent);
     lv_obj_set_grid_cell(bottom_cont, LV_GRID_ALIGN_STRETCH, 0, 2, LV_GRID_ALIGN_STRETCH, 1, 1);
-    lv_obj_set_style_bg_opa(bottom_cont, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(bottom_cont, 1, 0);
-    lv_obj_set_style_border_side(bottom_cont, LV_BORDER_SIDE_TOP, 0);
-    lv_obj_set_style_border_color(bottom_cont, lv_color_hex(0x404040), 0);
-    lv_obj_set_style_radius(bottom_cont, 0, 0);
-    lv_obj_set_style_pad_all(bottom_cont, 0, 0);
+    lv_obj_add_style(bottom_cont, &style_panel, 0);
+    lv_obj_add_style(bottom_cont, &style_divider_top, 0);
     lv_obj_set_scrollbar_mode(bottom_cont, LV_SCROLLBAR_MODE_OFF);
 
-    // Precipitation bar chart (60 colunas)
-    precipitation_chart = lv_chart_create(bottom_cont);
+    // Precipitation bars (60 columns), drawn in a single pass by precipitation_draw_event_cb
+    precipitation_chart = lv_obj_create(bottom_cont);
+    lv_obj_remove_flag(precipitation_chart, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
     lv_obj_set_size(precipitation_chart, 300, 40);
     lv_obj_center(precipitation_chart);
-    lv_obj_set_style_bg_opa(precipitation_chart, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(precipitation_chart, 0, 0);
-    lv_obj_set_style_pad_all(precipitation_chart, 0, 0);
+    lv_obj_add_style(precipitation_chart, &style_panel, 0);
     lv_obj_set_style_pad_right(precipitation_chart, 1, 0);
     lv_obj_set_style_pad_bottom(precipitation_chart, 1, 0);
 
-    lv_chart_set_type(precipitation_chart, LV_CHART_TYPE_BAR);
-    lv_chart_set_point_count(precipitation_chart, NUM_MINUTELY);
-    lv_chart_set_range(precipitation_chart, LV_CHART_AXIS_PRIMARY_Y, 0, HEAVY_RAIN_THRESHOLD);
-    lv_chart_set_div_line_count(precipitation_chart, 0, 0);
-
-    // Configuração crítica para barras espaçadas
-    lv_obj_set_style_pad_column(precipitation_chart, 1, LV_PART_MAIN);
-    lv_obj_set_style_line_color(precipitation_chart, lv_color_hex(0x606060), LV_PART_MAIN);
-
-    lv_obj_set_style_line_dash_width(precipitation_chart, 2, LV_PART_MAIN);
-    lv_obj_set_style_line_dash_gap(precipitation_chart, 2, LV_PART_MAIN);
-    lv_chart_set_div_line_count(precipitation_chart, 4, 7);
-
-    // Adiciona uma série
-    precipitation_series = lv_chart_add_series(precipitation_chart, lv_color_hex(0x00BFFF), LV_CHART_AXIS_PRIMARY_Y);
-
-    lv_obj_add_event_cb(precipitation_chart, chart_draw_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
-    lv_obj_add_flag(precipitation_chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
-
-    lv_chart_set_all_values(precipitation_chart, precipitation_series, 0);
-
-    lv_chart_refresh(precipitation_chart);
+    lv_obj_add_event_cb(precipitation_chart, precipitation_draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_subject_add_observer_obj(&subject_precipitation, precipitation_observer_cb, precipitation_chart, NULL);
 }
 
-static void chart_draw_event_cb(lv_event_t *e)
+static void precipitation_draw_event_cb(lv_event_t *e)
 {
-    lv_draw_task_t *draw_task = lv_event_get_draw_task(e);
-    lv_draw_dsc_base_t *base_dsc = (lv_draw_dsc_base_t *)lv_draw_task_get_draw_dsc(draw_task);
+    lv_obj_t *obj = lv_event_get_target_obj(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    const MinutelyPrecipitationDisplay *bars = lv_subject_get_pointer(&subject_precipitation);
+
+    lv_area_t content;
+    lv_obj_get_content_coords(obj, &content);
+    int32_t w = lv_area_get_width(&content);
+    int32_t h = lv_area_get_height(&content);
+
+    // Dashed division lines (drawn first so the bars cover them)
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = lv_color_hex(0x606060);
+    line_dsc.width = 1;
+    line_dsc.dash_width = 2;
+    line_dsc.dash_gap = 2;
+
+    for (int i = 0; i < HOR_DIV_LINES; i++)
+    {
+        int32_t y = content.y1 + ((h - 1) * i) / (HOR_DIV_LINES - 1);
+        line_dsc.p1.x = content.x1;
+        line_dsc.p1.y = y;
+        line_dsc.p2.x = content.x2;
+        line_dsc.p2.y = y;
+        lv_draw_line(layer, &line_dsc);
+    }
 
-    if (base_dsc->part != LV_PART_ITEMS)
+    for (int i = 0; i < VER_DIV_LINES; i++)
     {
-        return;
+        int32_t x = content.x1 + ((w - 1) * i) / (VER_DIV_LINES - 1);
+        line_dsc.p1.x = x;
+        line_dsc.p1.y = content.y1;
+        line_dsc.p2.x = x;
+        line_dsc.p2.y = content.y2;
+        lv_draw_line(layer, &line_dsc);
     }
 
-    lv_draw_fill_dsc_t *fill_dsc = lv_draw_task_get_fill_dsc(draw_task);
-    if (fill_dsc)
+    // Bars: one fill per non-empty column, colour taken from the precomputed intensity
+    int32_t bar_w = (w - (NUM_MINUTELY - 1) * BAR_GAP) / NUM_MINUTELY;
+    if (bar_w < 1)
     {
-        lv_obj_t *chart = lv_event_get_target_obj(e);
-        int32_t *y_array = lv_chart_get_series_y_array(chart, lv_chart_get_series_next(chart, NULL));
-        int32_t v = y_array[base_dsc->id2];
+        bar_w = 1;
+    }
 
-        if (v <= LIGHT_RAIN_THRESHOLD)
-        {
-            fill_dsc->color = lv_color_hex(0x00BFFF); // Azul claro para baixa precipitação
-        }
-        else if (v <= MEDIUM_RAIN_THRESHOLD)
-        {
-            fill_dsc->color = lv_color_hex(0x1E90FF); // Azul médio para precipitação moderada
-        }
-        else if (v <= HEAVY_RAIN_THRESHOLD)
+    lv_draw_fill_dsc_t fill_dsc;
+    lv_draw_fill_dsc_init(&fill_dsc);
+    fill_dsc.radius = 0;
+    fill_dsc.opa = LV_OPA_COVER;
+
+    lv_area_t bar;
+    bar.y2 = content.y2;
+    for (int i = 0; i < NUM_MINUTELY; i++)
+    {
+        int32_t level = bars->level[i];
+        if (level <= 0)
         {
-            fill_dsc->color = lv_color_hex(0x0000FF); // Azul escuro para alta precipitação
+            continue;
         }
-        else
+
+        int32_t bar_h = (level * h) / PRECIP_LEVEL_MAX;
+        if (bar_h < 1)
         {
-            fill_dsc->color = lv_color_hex(0xFF0000); // Vermelho intenso para precipitação muito alta
+            bar_h = 1;
         }
+
+        bar.x1 = content.x1 + i * (bar_w + BAR_GAP);
+        bar.x2 = bar.x1 + bar_w - 1;
+        bar.y1 = content.y2 - bar_h + 1;
+
+        fill_dsc.color = lv_color_hex(bar_palette[bars->intensity[i]]);
+        lv_draw_fill(layer, &fill_dsc, &bar);
     }
 }
@@ -1,7 +1,12 @@
 #include <esp_lvgl_port.h>
 #include <string.h>
 #include "ui_internal.h"
+#include "ui_styles.h"
 
+// Built once on first use, then switched with lv_screen_load()
+static lv_obj_t *qr_screen = NULL;
+static lv_obj_t *qr_code = NULL;
+static lv_obj_t *qr_label = NULL;
 
 void show_AP_qrcode(const char *ssid, const char *password)
 {
@@ -24,13 +29,6 @@ void show_AP_qrcode(const char *ssid, const char *password)
 
     // Set text with line breaks (\n)
     lv_label_set_text_fmt(label_status, "Scan to config,\nor enter:\n\nSSID: %s\nPSK: %s", ssid, password);
-    // Text Styling
-    lv_obj_set_style_text_color(label_status, lv_color_white(), 0); // White text
-
-    // Set max width so text doesn't overflow if SSID is long
-    // 320 (total width) - 10 (left margin) - 120 (QR) - 15 (spacing) = ~175px available
-    lv_obj_set_width(label_status, 169);
-    lv_label_set_long_mode(label_status, LV_LABEL_LONG_WRAP); // Wrap line if too long
 
     // The Alignment Trick:
     // Align text "OUTSIDE, TO THE RIGHT" (OUT_RIGHT) of the QR Code object
@@ -52,13 +50,6 @@ void show_config_qrcode(const char *url)
 
     // Set text with line breaks (\n)
     lv_label_set_text_fmt(label_status, "Scan to config,\nor browse to:\n%s", url);
-    // Text Styling
-    lv_obj_set_style_text_color(label_status, lv_color_white(), 0); // White text
-
-    // Set max width so text doesn't overflow if SSID is long
-    // 320 (total width) - 10 (left margin) - 120 (QR) - 15 (spacing) = ~175px available
-    lv_obj_set_width(label_status, 169);
-    lv_label_set_long_mode(label_status, LV_LABEL_LONG_WRAP); // Wrap line if too long
 
     // The Alignment Trick:
     // Align text "OUTSIDE, TO THE RIGHT" (OUT_RIGHT) of the QR Code object
@@ -66,30 +57,47 @@ void show_config_qrcode(const char *url)
     lv_obj_align_to(label_status, qr_code_obj, LV_ALIGN_OUT_RIGHT_MID, 15, 0);
 }
 
-// Helper function to create/update QR Code
+// Helper function returning the QR code screen objects (built once) and showing the screen
 void show_qrcode(lv_obj_t **qr_code_obj_ptr, lv_obj_t **label_status_ptr)
 {
-    // 1. Clear the screen
-    lv_obj_clean(lv_screen_active());
-
-    // --- LEFT SIDE: QR CODE ---
-
-    // The display has 170px height.
-    // Using 120px leaves 25px margin on top and bottom.
-    lv_coord_t qr_size = 120;
-
-    *qr_code_obj_ptr = lv_qrcode_create(lv_screen_active());
-    lv_qrcode_set_size(*qr_code_obj_ptr, qr_size);
-    lv_qrcode_set_light_color(*qr_code_obj_ptr, lv_color_white());
-    lv_qrcode_set_dark_color(*qr_code_obj_ptr, lv_color_black());
-    // Trick: Add a thick white border to create the "Quiet Zone"
-    // This REALLY helps the phone read the QR code on a dark background
-    lv_obj_set_style_border_color(*qr_code_obj_ptr, lv_color_white(), 0);
-    lv_obj_set_style_border_width(*qr_code_obj_ptr, 5, 0);
-    // Align to CENTER-LEFT, with 10px margin from screen edge (x=10, y=0)
-    lv_obj_align(*qr_code_obj_ptr, LV_ALIGN_LEFT_MID, 10, 0);
+    if (qr_screen == NULL)
+    {
+        qr_screen = create_screen();
+
+        // --- LEFT SIDE: QR CODE ---
+
+        // The display has 170px height.
+        // Using 120px leaves 25px margin on top and bottom.
+        lv_coord_t qr_size = 120;
+
+        qr_code = lv_qrcode_create(qr_screen);
+        lv_qrcode_set_size(qr_code, qr_size);
+        lv_qrcode_set_light_color(qr_code, lv_color_white());
+        lv_qrcode_set_dark_color(qr_code, lv_color_black());
+        // Trick: Add a thick white border to create the "Quiet Zone"
+        // This REALLY helps the phone read the QR code on a dark background
+        lv_obj_set_style_border_color(qr_code, lv_color_white(), 0);
+        lv_obj_set_style_border_width(qr_code, 5, 0);
+        // Align to CENTER-LEFT, with 10px margin from screen edge (x=10, y=0)
+        lv_obj_align(qr_code, LV_ALIGN_LEFT_MID, 10, 0);
+
+        // --- RIGHT SIDE: TEXT ---
+
+        qr_label = lv_label_create(qr_screen);
+        // Text Styling
+        lv_obj_add_style(qr_label, &style_value_label, 0);
+
+        // Set max width so text doesn't overflow if SSID is long
+        // 320 (total width) - 10 (left margin) - 120 (QR) - 15 (spacing) = ~175px available
+        lv_obj_set_width(qr_label, 169);
+        lv_label_set_long_mode(qr_label, LV_LABEL_LONG_WRAP); // Wrap line if too long
+    }
 
-    // --- RIGHT SIDE: TEXT ---
+    if (lv_screen_active() != qr_screen)
+    {
+        lv_screen_load(qr_screen);
+    }
 
-    *label_status_ptr = lv_label_create(lv_screen_active());
+    *qr_code_obj_ptr = qr_code;
+    *label_status_ptr = qr_label;
 }
\ No newline at end of file
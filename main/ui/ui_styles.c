@@ -0,0 +1,102 @@
+#include <stdbool.h>
+#include "ui_styles.h"
+#include "declares.h"
+#include "weather_utils.h"
+
+// Background shared by the boot, connecting and QR code screens
+#define SCREEN_BG_COLOR 0x003a57
+#define DASHBOARD_BG_COLOR 0x101010
+#define DIVIDER_COLOR 0x404040
+
+lv_style_t style_screen;
+lv_style_t style_dashboard;
+lv_style_t style_panel;
+lv_style_t style_grid;
+lv_style_t style_divider_right;
+lv_style_t style_divider_top;
+lv_style_t style_icon_tile;
+lv_style_t style_value_label;
+lv_style_t style_temp_label;
+lv_style_t style_clock_hhmm;
+lv_style_t style_clock_ss;
+lv_style_t style_weekday;
+lv_style_t style_date;
+lv_style_t style_temperature[TEMPERATURE_BAND_COUNT];
+
+static bool s_initialized = false;
+
+static void init_divider(lv_style_t *style, lv_border_side_t side)
+{
+    lv_style_init(style);
+    lv_style_set_border_width(style, 1);
+    lv_style_set_border_side(style, side);
+    lv_style_set_border_color(style, lv_color_hex(DIVIDER_COLOR));
+}
+
+void ui_styles_init(void)
+{
+    if (s_initialized)
+    {
+        return;
+    }
+    s_initialized = true;
+
+    lv_style_init(&style_screen);
+    lv_style_set_bg_color(&style_screen, lv_color_hex(SCREEN_BG_COLOR));
+    lv_style_set_text_color(&style_screen, lv_color_white());
+
+    lv_style_init(&style_dashboard);
+    lv_style_set_bg_color(&style_dashboard, lv_color_hex(DASHBOARD_BG_COLOR));
+    lv_style_set_border_width(&style_dashboard, 0);
+    lv_style_set_pad_all(&style_dashboard, 0);
+
+    lv_style_init(&style_panel);
+    lv_style_set_bg_opa(&style_panel, LV_OPA_TRANSP);
+    lv_style_set_border_width(&style_panel, 0);
+    lv_style_set_radius(&style_panel, 0);
+    lv_style_set_pad_all(&style_panel, 0);
+
+    lv_style_init(&style_grid);
+    lv_style_set_layout(&style_grid, LV_LAYOUT_GRID);
+    lv_style_set_pad_row(&style_grid, 0);
+    lv_style_set_pad_column(&style_grid, 0);
+
+    init_divider(&style_divider_right, LV_BORDER_SIDE_RIGHT);
+    init_divider(&style_divider_top, LV_BORDER_SIDE_TOP);
+
+    lv_style_init(&style_icon_tile);
+    lv_style_set_bg_color(&style_icon_tile, lv_color_hex(WEATHER_ICON_BG_COLOR));
+    lv_style_set_border_width(&style_icon_tile, 0);
+    lv_style_set_radius(&style_icon_tile, 0);
+
+    lv_style_init(&style_value_label);
+    lv_style_set_text_color(&style_value_label, lv_color_white());
+
+    // Fonts are set with lv_style_set_text_font() directly so that
+    // tools/assetsubset can see which labels use them
+    lv_style_init(&style_temp_label);
+    lv_style_set_text_font(&style_temp_label, &barlow_condensed_sb28px);
+    lv_style_set_text_color(&style_temp_label, lv_color_white());
+
+    lv_style_init(&style_clock_hhmm);
+    lv_style_set_text_font(&style_clock_hhmm, &barlow_condensed_sb32px);
+    lv_style_set_text_color(&style_clock_hhmm, lv_color_white());
+
+    lv_style_init(&style_clock_ss);
+    lv_style_set_text_font(&style_clock_ss, &barlow_condensed_sb24px);
+    lv_style_set_text_color(&style_clock_ss, lv_color_white());
+
+    lv_style_init(&style_weekday);
+    lv_style_set_text_font(&style_weekday, &montserrat_sb14px);
+    lv_style_set_text_color(&style_weekday, lv_color_hex(0xFFA500));
+
+    lv_style_init(&style_date);
+    lv_style_set_text_font(&style_date, &lv_font_montserrat_14);
+    lv_style_set_text_color(&style_date, lv_color_hex(0xD3D3D3));
+
+    for (int band = 0; band < TEMPERATURE_BAND_COUNT; band++)
+    {
+        lv_style_init(&style_temperature[band]);
+        lv_style_set_text_color(&style_temperature[band], lv_color_hex(get_temperature_band_color(band)));
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <esp_lvgl_port.h>
+#include "weather_utils.h"
+
+// Shared styles, initialized once by ui_styles_init() and attached with
+// lv_obj_add_style(). Objects only keep local styles for their own geometry.
+
+extern lv_style_t style_screen;        // Boot/connecting/QR screens: background and white text
+extern lv_style_t style_dashboard;     // Clock screen root container
+extern lv_style_t style_panel;         // Transparent container without border or padding
+extern lv_style_t style_grid;          // Grid layout without gaps between cells
+extern lv_style_t style_divider_right; // 1px separator on the right edge
+extern lv_style_t style_divider_top;   // 1px separator on the top edge
+extern lv_style_t style_icon_tile;     // Solid tile behind the weather icon
+extern lv_style_t style_value_label;   // White text in the default font
+extern lv_style_t style_temp_label;    // Large temperature
+extern lv_style_t style_clock_hhmm;    // Hours and minutes
+extern lv_style_t style_clock_ss;      // Seconds
+extern lv_style_t style_weekday;
+extern lv_style_t style_date;
+extern lv_style_t style_temperature[TEMPERATURE_BAND_COUNT]; // Text colour per temperature band
+
+/**
+ * @brief Initialize the shared styles. Safe to call more than once.
+ */
+void ui_styles_init(void);
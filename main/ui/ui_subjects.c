@@ -0,0 +1,104 @@
+#include <math.h>
+#include <string.h>
+#include "ui_subjects.h"
+#include "openweather_service.h"
+#include "weather_utils.h"
+
+lv_subject_t subject_temperature;
+lv_subject_t subject_feels_like;
+lv_subject_t subject_pressure;
+lv_subject_t subject_humidity;
+lv_subject_t subject_dew_point;
+lv_subject_t subject_uvi;
+lv_subject_t subject_wind_speed;
+lv_subject_t subject_wind_degree;
+lv_subject_t subject_weather_icon;
+lv_subject_t subject_precipitation;
+
+static bool s_initialized = false;
+static uint32_t s_published_generation = 0;
+
+// Series drawn by the precipitation chart, owned by the LVGL side
+static MinutelyPrecipitationDisplay s_precipitation;
+
+void ui_subjects_init(void)
+{
+    if (s_initialized)
+    {
+        return;
+    }
+    s_initialized = true;
+
+    lv_subject_init_int(&subject_temperature, 0);
+    lv_subject_init_int(&subject_feels_like, 0);
+    lv_subject_init_int(&subject_pressure, 0);
+    lv_subject_init_int(&subject_humidity, 0);
+    lv_subject_init_int(&subject_dew_point, 0);
+    lv_subject_init_int(&subject_uvi, 0);
+    lv_subject_init_int(&subject_wind_speed, 0);
+    lv_subject_init_int(&subject_wind_degree, 0);
+    lv_subject_init_pointer(&subject_weather_icon, (void *)get_weather_icon(WEATHER_ICON_CLEAR_DAY));
+    lv_subject_init_pointer(&subject_precipitation, &s_precipitation);
+}
+
+static int32_t to_tenths(float value)
+{
+    return (int32_t)lroundf(value * 10.0f);
+}
+
+static void set_int(lv_subject_t *subject, int32_t value)
+{
+    if (lv_subject_get_int(subject) != value)
+    {
+        lv_subject_set_int(subject, value);
+    }
+}
+
+bool ui_subjects_publish_weather(void)
+{
+    ui_subjects_init();
+
+    if (!openweather_lock(50))
+    {
+        return false;
+    }
+
+    uint32_t generation = openweather_get_generation();
+    CurrentWeather *data = openweather_get_current_data();
+    if (generation == s_published_generation || data == NULL)
+    {
+        openweather_unlock();
+        return true;
+    }
+
+    // Take a snapshot so the observers run without the weather lock
+    CurrentWeather current = *data;
+    const MinutelyPrecipitationDisplay *display = openweather_get_minutely_display();
+    bool precipitation_changed = memcmp(&s_precipitation, display, sizeof(s_precipitation)) != 0;
+    if (precipitation_changed)
+    {
+        memcpy(&s_precipitation, display, sizeof(s_precipitation));
+    }
+    s_published_generation = generation;
+    openweather_unlock();
+
+    set_int(&subject_temperature, to_tenths(current.temperature));
+    set_int(&subject_feels_like, to_tenths(current.feelsLike));
+    set_int(&subject_pressure, current.atmospheric.pressure);
+    set_int(&subject_humidity, current.atmospheric.humidity);
+    set_int(&subject_dew_point, to_tenths(current.atmospheric.dewPoint));
+    set_int(&subject_uvi, to_tenths(current.atmospheric.uvi));
+    set_int(&subject_wind_speed, to_tenths(current.wind.speed));
+    set_int(&subject_wind_degree, current.wind.degree);
+
+    const lv_image_dsc_t *icon = get_weather_icon(current.weather.iconId);
+    if (lv_subject_get_pointer(&subject_weather_icon) != icon)
+    {
+        lv_subject_set_pointer(&subject_weather_icon, (void *)icon);
+    }
+    if (precipitation_changed)
+    {
+        lv_subject_notify(&subject_precipitation);
+    }
+    return true;
+}
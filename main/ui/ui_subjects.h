@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdbool.h>
+#include <esp_lvgl_port.h>
+
+// Weather values shown on the clock screen, published as LVGL subjects.
+// Widgets bind to them once; ui_subjects_publish_weather() notifies only the
+// subjects whose value changed. Use them with the LVGL lock held.
+
+extern lv_subject_t subject_temperature;   // int, 0.1 °C
+extern lv_subject_t subject_feels_like;    // int, 0.1 °C
+extern lv_subject_t subject_pressure;      // int, hPa
+extern lv_subject_t subject_humidity;      // int, %
+extern lv_subject_t subject_dew_point;     // int, 0.1 °C
+extern lv_subject_t subject_uvi;           // int, 0.1 UV index
+extern lv_subject_t subject_wind_speed;    // int, 0.1 m/s
+extern lv_subject_t subject_wind_degree;   // int, degrees
+extern lv_subject_t subject_weather_icon;  // pointer, const lv_image_dsc_t *
+extern lv_subject_t subject_precipitation; // pointer, const MinutelyPrecipitationDisplay *
+
+/**
+ * @brief Initialize the subjects. Safe to call more than once.
+ */
+void ui_subjects_init(void);
+
+/**
+ * @brief Copy the latest weather refresh into the subjects.
+ *        Does nothing when that refresh is already published.
+ * @return false if the weather data could not be locked; call again later.
+ */
+bool ui_subjects_publish_weather(void);
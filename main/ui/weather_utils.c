@@ -1,87 +1,81 @@
 #include "weather_utils.h"
-#include <string.h>
 #include "declares.h" // O arquivo gerado pelo Python
 
 
-int get_temperature_color(float temperature)
+// Colour of each band; a temperature belongs to the first band whose upper bound it does not exceed
+static const int temperature_band_colors[TEMPERATURE_BAND_COUNT] = {
+    0x00BFFF, // Blue, up to 0 °C
+    0x7FFFD4, // Aquamarine, up to 15 °C
+    0xFFFF00, // Yellow, up to 25 °C
+    0xFFA500, // Orange, up to 35 °C
+    0xFF0000, // Red, above
+};
+static const float temperature_band_max[TEMPERATURE_BAND_COUNT - 1] = {0.0f, 15.0f, 25.0f, 35.0f};
+
+int get_temperature_band(float temperature)
 {
-    if (temperature <= 0.0f) {
-        return 0x00BFFF; // Blue
-    } else if (temperature <= 15.0f) {
-        return 0x7FFFD4; // Aquamarine
-    } else if (temperature <= 25.0f) {
-        return 0xFFFF00; // Yellow
-    } else if (temperature <= 35.0f) {
-        return 0xFFA500; // Orange
-    } else {
-        return 0xFF0000; // Red
+    for (int band = 0; band < TEMPERATURE_BAND_COUNT - 1; band++) {
+        if (temperature <= temperature_band_max[band]) {
+            return band;
+        }
     }
+    return TEMPERATURE_BAND_COUNT - 1;
 }
 
-// Definimos uma estrutura para nossa tabela de mapeamento
-typedef struct {
-    const char *code;            // O código da API (ex: "01d")
-    const lv_image_dsc_t *img;   // O ponteiro para a imagem gerada
-} weather_map_t;
+int get_temperature_band_color(int band)
+{
+    if (band < 0 || band >= TEMPERATURE_BAND_COUNT) {
+        band = TEMPERATURE_BAND_COUNT - 1;
+    }
+    return temperature_band_colors[band];
+}
 
-// A Tabela de Consulta
-// Mapeia diretamente o texto da API para a variável gerada
-static const weather_map_t icon_map[] = {
-    // Céu Limpo
-    {"01d", &weather_01d},
-    {"01n", &weather_01n},
-    
-    // Poucas Nuvens
-    {"02d", &weather_02d},
-    {"02n", &weather_02n},
-    
-    // Nuvens Dispersas
-    {"03d", &weather_03},
-    {"03n", &weather_03},
-    
-    // Nublado (Broken Clouds)
-    {"04d", &weather_04},
-    {"04n", &weather_04},
-    
-    // Chuva de Banho (Shower Rain)
-    {"09d", &weather_09},
-    {"09n", &weather_09},
-    
-    // Chuva (Rain)
-    {"10d", &weather_10d},
-    {"10n", &weather_10n},
-    
-    // Tempestade
-    {"11d", &weather_11d},
-    {"11n", &weather_11n},
-    
-    // Neve
-    {"13d", &weather_13},
-    {"13n", &weather_13},
-    
-    // Névoa (Mist)
-    {"50d", &weather_50},
-    {"50n", &weather_50},
-    
-    // Fim da lista (sentinela)
-    {NULL, NULL} 
-};
+int get_temperature_color(float temperature)
+{
+    return temperature_band_colors[get_temperature_band(temperature)];
+}
 
-// Imagem de fallback caso venha um código estranho ou erro
-// (Certifique-se de ter um unknown.svg na pasta e gerado pelo script)
-// Se não tiver, aponte para &weather_01d provisoriamente
-#define FALLBACK_ICON &weather_na
+// Icons drawn on a matching tile colour use the pre-blended opaque variants,
+// which LVGL can copy straight into the draw buffer without alpha blending.
+#if WEATHER_ICON_BG_COLOR == WEATHER_ICON_OPAQUE_BG
+#define WEATHER_ICON(name) (&name##_opaque)
+#else
+#define WEATHER_ICON(name) (&name)
+#endif
 
-const lv_image_dsc_t* get_weather_icon(const char* code) {
-    if (code == NULL) return FALLBACK_ICON;
+// Image for each WeatherIcon, indexed directly by the value resolved at parse time
+static const lv_image_dsc_t *const icon_map[WEATHER_ICON_COUNT] = {
+    [WEATHER_ICON_NA] = WEATHER_ICON(weather_na),
 
-    // Percorre a tabela procurando o código
-    for (int i = 0; icon_map[i].code != NULL; i++) {
-        if (strcmp(code, icon_map[i].code) == 0) {
-            return icon_map[i].img; // Encontrou!
-        }
-    }
+    // Clear sky
+    [WEATHER_ICON_CLEAR_DAY] = WEATHER_ICON(weather_01d),
+    [WEATHER_ICON_CLEAR_NIGHT] = WEATHER_ICON(weather_01n),
+
+    // Few clouds
+    [WEATHER_ICON_FEW_CLOUDS_DAY] = WEATHER_ICON(weather_02d),
+    [WEATHER_ICON_FEW_CLOUDS_NIGHT] = WEATHER_ICON(weather_02n),
+
+    // Scattered / broken clouds
+    [WEATHER_ICON_SCATTERED_CLOUDS] = WEATHER_ICON(weather_03),
+    [WEATHER_ICON_BROKEN_CLOUDS] = WEATHER_ICON(weather_04),
+
+    // Shower rain / rain
+    [WEATHER_ICON_SHOWER_RAIN] = WEATHER_ICON(weather_09),
+    [WEATHER_ICON_RAIN_DAY] = WEATHER_ICON(weather_10d),
+    [WEATHER_ICON_RAIN_NIGHT] = WEATHER_ICON(weather_10n),
 
-    // Se varreu tudo e não achou
-    return FALLBACK_ICON;
-}
\ No newline at end of file
+    // Thunderstorm
+    [WEATHER_ICON_THUNDERSTORM_DAY] = WEATHER_ICON(weather_11d),
+    [WEATHER_ICON_THUNDERSTORM_NIGHT] = WEATHER_ICON(weather_11n),
+
+    // Snow / mist
+    [WEATHER_ICON_SNOW] = WEATHER_ICON(weather_13),
+    [WEATHER_ICON_MIST] = WEATHER_ICON(weather_50),
+};
+
+const lv_image_dsc_t *get_weather_icon(WeatherIcon icon) {
+    if ((unsigned)icon >= WEATHER_ICON_COUNT) {
+        return icon_map[WEATHER_ICON_NA];
+    }
+    return icon_map[icon];
+}
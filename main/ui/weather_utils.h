@@ -1,13 +1,33 @@
 #pragma once
 #include "lvgl.h"
+#include "typedefs.h"
+
+// Background of the weather icon tile. The *_opaque icons are only used when
+// this matches the colour they were pre-blended on (WEATHER_ICON_OPAQUE_BG).
+#define WEATHER_ICON_BG_COLOR 0x00008B
 
 /**
- * Converte o código da OpenWeatherMap (ex: "01d") para o descritor de imagem LVGL.
- * @param code A string do código do ícone (ex: "01d", "10n").
- * @return Ponteiro para a imagem correspondente ou uma imagem padrão se não encontrado.
+ * Returns the LVGL image for an icon resolved by the OpenWeather parser.
+ * @param icon Icon identifier stored in WeatherCondition.iconId.
+ * @return Pointer to the matching image, or the "not available" image if out of range.
  */
-const lv_image_dsc_t* get_weather_icon(const char* code);
+const lv_image_dsc_t *get_weather_icon(WeatherIcon icon);
 
+// Temperature colour bands, coldest first
+#define TEMPERATURE_BAND_COUNT 5
 
+/**
+ * Returns the colour band of a temperature (0 = coldest).
+ */
+int get_temperature_band(float temperature);
+
+/**
+ * Returns the RGB colour (0xRRGGBB) of a band from get_temperature_band().
+ */
+int get_temperature_band_color(int band);
+
+/**
+ * Returns the RGB colour (0xRRGGBB) used to show a temperature.
+ */
 int get_temperature_color(float temperature);
 
@@ -1,33 +1,70 @@
+#include <string.h>
 #include "typedefs.h"
 #include "web_api.h"
 #include "esp_log.h"
 #include "nvs_storage.h"
 #include "wifi_scan.h"
+#include "frame_profiler.h"
+#include "web_asset_cache.h"
+#include "web_weather.h"
+#include "ui.h"
 #include "cJSON.h"
+#include "json_writer.h"
+
+// --- STREAMED JSON ---
+
+// json_sink_t sending each filled writer buffer as one HTTP chunk
+static esp_err_t httpd_chunk_sink(void *ctx, const char *data, size_t len) {
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, data, len);
+}
+
+// Stream a JSON body written by write_json, using only the writer's buffer whatever its length.
+// Headers must be set before: the first chunk sends them.
+static esp_err_t send_json(httpd_req_t *req, void (*write_json)(json_writer_t *w)) {
+    json_writer_t w;
+    json_writer_init(&w, httpd_chunk_sink, req);
+
+    httpd_resp_set_type(req, "application/json");
+    write_json(&w);
+    esp_err_t err = json_writer_finish(&w);
+    if (err != ESP_OK) {
+        ESP_LOGW("SERVER", "%s: client gone mid-response (%s)", req->uri, esp_err_to_name(err));
+        return err;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
 
 // --- API HANDLERS (Matches Svelte Fetch Calls) ---
 
-// GET /api/scan -> Returns available Wi-Fi networks
+// GET /api/scan[?refresh=1] -> Returns the cached Wi-Fi networks without waiting for a scan.
+// refresh, or missing/expired results, start a new scan in the background; poll again
+// while X-Scan-In-Progress is true.
 esp_err_t api_scan_get_handler(httpd_req_t *req) {
-    // Allocate a sufficiently large buffer for JSON response
-    char *json_response = heap_caps_malloc(3192, MALLOC_CAP_8BIT);
-    wifi_scan_ssids_json(json_response, 3192);
-    
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, json_response, HTTPD_RESP_USE_STRLEN);
-    heap_caps_free(json_response);
-    return ESP_OK;
+    char query[32];
+    char refresh[8];
+    bool force = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+                 httpd_query_key_value(query, "refresh", refresh, sizeof(refresh)) == ESP_OK &&
+                 strcmp(refresh, "0") != 0;
+
+    // Start the scan before the headers, so X-Scan-In-Progress reports it
+    int32_t age_s = wifi_scan_age_s();
+    if (force || age_s < 0 || age_s >= WIFI_SCAN_TTL_S) {
+        wifi_scan_start();
+    }
+
+    char age[12];
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    httpd_resp_set_hdr(req, "X-Scan-In-Progress", wifi_scan_in_progress() ? "true" : "false");
+    if (age_s >= 0) {
+        snprintf(age, sizeof(age), "%ld", (long)age_s);
+        httpd_resp_set_hdr(req, "Age", age);
+    }
+    return send_json(req, wifi_scan_write_json);
 }
 
 // GET /api/config -> Returns current settings to populate the form
 esp_err_t api_config_get_handler(httpd_req_t *req) {
-
-    char json_response[1024];
-    get_config_from_nvs(json_response, sizeof(json_response));
-
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, json_response, HTTPD_RESP_USE_STRLEN);
-    return ESP_OK;
+    return send_json(req, write_config_from_nvs);
 }
 
 
@@ -59,9 +96,63 @@ esp_err_t api_save_post_handler(httpd_req_t *req) {
     //  Save settings from JSON to NVS
     nvs_save_config_from_json(root);
 
+    // Orientation takes effect immediately, without a reboot
+    cJSON *rotation = cJSON_GetObjectItem(root, "displayRotation");
+    if (cJSON_IsNumber(rotation) && (rotation->valueint == 0 || rotation->valueint == 180)) {
+        ui_set_rotation((uint16_t)rotation->valueint);
+    }
+
     // Clean up
     cJSON_Delete(root);
     
     httpd_resp_send(req, "{\"status\":\"saved\"}", HTTPD_RESP_USE_STRLEN);
     return ESP_OK;
 }
+
+// GET /api/perf -> LVGL frame profiling aggregates and recent samples
+esp_err_t api_perf_get_handler(httpd_req_t *req) {
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return send_json(req, frame_profiler_write_json);
+}
+
+// GET /api/cache -> Web asset cache hit/miss counters, for sizing its budget
+esp_err_t api_cache_get_handler(httpd_req_t *req) {
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return send_json(req, web_asset_cache_write_json);
+}
+
+// GET /api/weather[?include=hourly,daily] -> Current and minutely weather (plus the
+// requested forecasts), serialized once per weather refresh and shared by all clients
+esp_err_t api_weather_get_handler(httpd_req_t *req) {
+    uint8_t sections = 0;
+    char query[64];
+    char include[32];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "include", include, sizeof(include)) == ESP_OK) {
+        if (strstr(include, "hourly")) sections |= WEB_WEATHER_HOURLY;
+        if (strstr(include, "daily")) sections |= WEB_WEATHER_DAILY;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    const web_weather_json_t *json = web_weather_acquire(sections);
+    if (json == NULL) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "10");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+        httpd_resp_send(req, "{\"error\":\"no weather data yet\"}", HTTPD_RESP_USE_STRLEN);
+        return ESP_OK;
+    }
+
+    // Revalidate every time: a 304 costs no serialization and no body
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    httpd_resp_set_hdr(req, "ETag", json->etag);
+    esp_err_t ret;
+    if (http_etag_matches(req, json->etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        ret = httpd_resp_send(req, NULL, 0);
+    } else {
+        ret = httpd_resp_send(req, json->data, json->len);
+    }
+    web_weather_release(json);
+    return ret;
+}
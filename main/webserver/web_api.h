@@ -5,3 +5,9 @@
 esp_err_t api_scan_get_handler(httpd_req_t *req);
 esp_err_t api_config_get_handler(httpd_req_t *req);
 esp_err_t api_save_post_handler(httpd_req_t *req);
+esp_err_t api_perf_get_handler(httpd_req_t *req);
+esp_err_t api_cache_get_handler(httpd_req_t *req);
+esp_err_t api_weather_get_handler(httpd_req_t *req);
+
+// Shared with the file handler in web_server.c
+bool http_etag_matches(httpd_req_t *req, const char *etag);
@@ -0,0 +1,305 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "web_assets.h"
+#include "web_asset_cache.h"
+
+static const char *TAG = "WEB_CACHE";
+
+#ifndef CONFIG_WEATHER_WEB_CACHE_KB
+#define CONFIG_WEATHER_WEB_CACHE_KB 0 // No PSRAM
+#endif
+#define CACHE_BUDGET ((size_t)CONFIG_WEATHER_WEB_CACHE_KB * 1024)
+
+// Larger files are streamed as before, so one bundle cannot flush everything else
+#define CACHE_MAX_ENTRY (CACHE_BUDGET / 4)
+
+// One PSRAM allocation per entry: this header, the body, then the NUL-terminated path
+typedef struct cache_entry
+{
+    struct cache_entry *prev; // Towards the most recently used
+    struct cache_entry *next; // Towards the least recently used
+    uint32_t refs;            // Requests still sending the body
+    bool linked;              // In the list; an unlinked entry is freed on its last release
+    size_t size;
+    char etag[WEB_ASSET_ETAG_LEN];
+    char *path;
+    uint8_t data[];
+} cache_entry_t;
+
+static SemaphoreHandle_t s_mutex = NULL;
+static portMUX_TYPE s_init_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static cache_entry_t *s_head = NULL; // Most recently used
+static cache_entry_t *s_tail = NULL; // Least recently used
+static web_asset_cache_stats_t s_stats = {.budget = CACHE_BUDGET};
+
+static bool cache_lock(void)
+{
+    if (s_mutex == NULL)
+    {
+        SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+        if (mutex == NULL)
+        {
+            return false;
+        }
+        taskENTER_CRITICAL(&s_init_lock);
+        if (s_mutex == NULL)
+        {
+            s_mutex = mutex;
+            mutex = NULL;
+        }
+        taskEXIT_CRITICAL(&s_init_lock);
+        if (mutex)
+        {
+            vSemaphoreDelete(mutex);
+        }
+    }
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    return true;
+}
+
+static void cache_unlock(void)
+{
+    xSemaphoreGive(s_mutex);
+}
+
+static void list_push_front(cache_entry_t *e)
+{
+    e->prev = NULL;
+    e->next = s_head;
+    if (s_head)
+    {
+        s_head->prev = e;
+    }
+    s_head = e;
+    if (s_tail == NULL)
+    {
+        s_tail = e;
+    }
+    e->linked = true;
+    s_stats.entries++;
+    s_stats.bytes += e->size;
+}
+
+static void list_remove(cache_entry_t *e)
+{
+    if (e->prev)
+        e->prev->next = e->next;
+    else
+        s_head = e->next;
+    if (e->next)
+        e->next->prev = e->prev;
+    else
+        s_tail = e->prev;
+    e->prev = e->next = NULL;
+    e->linked = false;
+    s_stats.entries--;
+    s_stats.bytes -= e->size;
+}
+
+// Unlink an entry; it is freed now, or by the last request still sending it
+static void drop_entry(cache_entry_t *e)
+{
+    list_remove(e);
+    s_stats.evictions++;
+    if (e->refs == 0)
+    {
+        heap_caps_free(e);
+    }
+}
+
+static cache_entry_t *find_entry(const char *path)
+{
+    for (cache_entry_t *e = s_head; e; e = e->next)
+    {
+        if (strcmp(e->path, path) == 0)
+        {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+// Evict unused entries from the LRU end until size more bytes fit
+static bool make_room(size_t size)
+{
+    cache_entry_t *e = s_tail;
+    while (s_stats.bytes + size > CACHE_BUDGET && e)
+    {
+        cache_entry_t *prev = e->prev;
+        if (e->refs == 0)
+        {
+            drop_entry(e);
+        }
+        e = prev;
+    }
+    return s_stats.bytes + size <= CACHE_BUDGET;
+}
+
+// Lookup under the lock: a current entry moves to the front, a stale one is dropped
+static cache_entry_t *acquire_entry(const char *path, const char *etag, size_t size)
+{
+    cache_entry_t *e = find_entry(path);
+    if (e == NULL)
+    {
+        return NULL;
+    }
+    if (e->size != size || strcmp(e->etag, etag) != 0)
+    {
+        drop_entry(e);
+        return NULL;
+    }
+    if (e != s_head)
+    {
+        list_remove(e);
+        list_push_front(e);
+    }
+    e->refs++;
+    return e;
+}
+
+static cache_entry_t *read_entry(const char *path, const char *etag, size_t size)
+{
+    size_t path_len = strlen(path) + 1;
+    cache_entry_t *e = heap_caps_malloc(sizeof(*e) + size + path_len, MALLOC_CAP_SPIRAM);
+    if (e == NULL)
+    {
+        ESP_LOGW(TAG, "No PSRAM for %s (%u bytes)", path, (unsigned)size);
+        return NULL;
+    }
+
+    FILE *fd = fopen(path, "r");
+    size_t read = fd ? fread(e->data, 1, size, fd) : 0;
+    if (fd)
+    {
+        fclose(fd);
+    }
+    if (read != size)
+    {
+        ESP_LOGW(TAG, "Short read of %s (%u of %u bytes)", path, (unsigned)read, (unsigned)size);
+        heap_caps_free(e);
+        return NULL;
+    }
+
+    memset(e, 0, sizeof(*e));
+    e->refs = 1;
+    e->size = size;
+    snprintf(e->etag, sizeof(e->etag), "%s", etag);
+    e->path = (char *)e->data + size;
+    memcpy(e->path, path, path_len);
+    return e;
+}
+
+const uint8_t *web_asset_cache_get(const char *path, const char *etag, size_t size)
+{
+    // Without an ETag a replaced file of the same size would look current
+    if (CACHE_BUDGET == 0 || etag[0] == '\0' || !cache_lock())
+    {
+        return NULL;
+    }
+    cache_entry_t *e = acquire_entry(path, etag, size);
+    if (e)
+    {
+        s_stats.hits++;
+        cache_unlock();
+        return e->data;
+    }
+    s_stats.misses++;
+    cache_unlock();
+
+    if (size == 0 || size > CACHE_MAX_ENTRY)
+    {
+        return NULL;
+    }
+
+    // Read without the lock so hits on other files are not held up by LittleFS
+    cache_entry_t *loaded = read_entry(path, etag, size);
+    if (loaded == NULL)
+    {
+        return NULL;
+    }
+
+    cache_lock();
+    e = acquire_entry(path, etag, size);
+    if (e)
+    {
+        // Another request cached it meanwhile
+        heap_caps_free(loaded);
+    }
+    else
+    {
+        e = loaded;
+        // Every entry is being sent: serve this body once without keeping it
+        if (make_room(size))
+        {
+            list_push_front(e);
+        }
+    }
+    cache_unlock();
+    return e->data;
+}
+
+void web_asset_cache_release(const uint8_t *data)
+{
+    if (data == NULL)
+    {
+        return;
+    }
+    cache_entry_t *e = (cache_entry_t *)(data - offsetof(cache_entry_t, data));
+
+    cache_lock();
+    e->refs--;
+    bool orphaned = e->refs == 0 && !e->linked;
+    cache_unlock();
+
+    if (orphaned)
+    {
+        heap_caps_free(e);
+    }
+}
+
+void web_asset_cache_clear(void)
+{
+    if (!cache_lock())
+    {
+        return;
+    }
+    while (s_head)
+    {
+        drop_entry(s_head);
+    }
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.budget = CACHE_BUDGET;
+    cache_unlock();
+}
+
+void web_asset_cache_get_stats(web_asset_cache_stats_t *stats)
+{
+    bool locked = cache_lock();
+    *stats = s_stats;
+    if (locked)
+    {
+        cache_unlock();
+    }
+}
+
+void web_asset_cache_write_json(json_writer_t *w)
+{
+    web_asset_cache_stats_t stats;
+    web_asset_cache_get_stats(&stats);
+
+    json_writer_begin_object(w, NULL);
+    json_writer_int(w, "hits", stats.hits);
+    json_writer_int(w, "misses", stats.misses);
+    json_writer_int(w, "evictions", stats.evictions);
+    json_writer_int(w, "entries", stats.entries);
+    json_writer_int(w, "bytes", stats.bytes);
+    json_writer_int(w, "budget", stats.budget);
+    json_writer_end_object(w);
+}
@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "web_assets.h"
+
+static const char *TAG = "WEB_ASSETS";
+
+#define MANIFEST_LINE_LEN 512
+#define MANIFEST_FIELDS 6 // path, type, size, hash, gzip size, brotli size
+#define HASH_HEX_LEN 16
+
+// Bundle layout written by write_bundle() in tools/webassets/prepare_assets.py.
+// Offsets count from the start of the image; 0 means the variant does not exist.
+#define BUNDLE_MAGIC "WTAB"
+#define BUNDLE_VERSION 1
+
+typedef struct
+{
+    char magic[4];
+    uint16_t version;
+    uint16_t count;
+    uint32_t total_size;
+} bundle_header_t;
+
+typedef struct
+{
+    uint32_t path; // NUL-terminated
+    uint32_t type; // NUL-terminated
+    uint32_t offset[WEB_ASSET_VARIANT_COUNT];
+    uint32_t size[WEB_ASSET_VARIANT_COUNT];
+    char hash[HASH_HEX_LEN];
+} bundle_entry_t;
+
+_Static_assert(sizeof(bundle_header_t) == 12, "bundle header layout");
+_Static_assert(sizeof(bundle_entry_t) == 48, "bundle entry layout");
+
+static web_asset_t *s_assets = NULL;
+static size_t s_asset_count = 0;
+
+// Open addressing with linear probing; the size is a power of two
+static const web_asset_t **s_table = NULL;
+static size_t s_table_size = 0;
+
+// Each representation needs its own strong ETag
+static const char *const etag_suffix[WEB_ASSET_VARIANT_COUNT] = {
+    [WEB_ASSET_IDENTITY] = "",
+    [WEB_ASSET_GZIP] = "-gz",
+    [WEB_ASSET_BR] = "-br",
+};
+
+static esp_partition_mmap_handle_t s_bundle_map;
+
+static void set_etags(web_asset_t *asset, const char *hash)
+{
+    for (int v = 0; v < WEB_ASSET_VARIANT_COUNT; v++)
+    {
+        if (v == WEB_ASSET_IDENTITY || asset->size[v] > 0)
+        {
+            snprintf(asset->etag[v], WEB_ASSET_ETAG_LEN, "\"%.*s%s\"", HASH_HEX_LEN, hash, etag_suffix[v]);
+        }
+    }
+}
+
+static uint32_t path_hash(const char *path)
+{
+    // FNV-1a 32
+    uint32_t h = 2166136261u;
+    for (; *path; path++)
+    {
+        h ^= (uint8_t)*path;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// One manifest line: "path<TAB>type<TAB>size<TAB>hash<TAB>gzip size<TAB>brotli size"
+static bool parse_line(char *line, web_asset_t *asset)
+{
+    char *fields[MANIFEST_FIELDS];
+    char *save = NULL;
+    int n = 0;
+
+    for (char *tok = strtok_r(line, "\t\r\n", &save); tok && n < MANIFEST_FIELDS; tok = strtok_r(NULL, "\t\r\n", &save))
+    {
+        fields[n++] = tok;
+    }
+    if (n != MANIFEST_FIELDS || strlen(fields[3]) != HASH_HEX_LEN)
+    {
+        return false;
+    }
+
+    memset(asset, 0, sizeof(*asset));
+    asset->size[WEB_ASSET_IDENTITY] = strtoul(fields[2], NULL, 10);
+    asset->size[WEB_ASSET_GZIP] = strtoul(fields[4], NULL, 10);
+    asset->size[WEB_ASSET_BR] = strtoul(fields[5], NULL, 10);
+    set_etags(asset, fields[3]);
+
+    asset->path = strdup(fields[0]);
+    asset->type = strdup(fields[1]);
+    if (asset->path == NULL || asset->type == NULL)
+    {
+        free((void *)asset->path);
+        free((void *)asset->type);
+        return false;
+    }
+    return true;
+}
+
+static bool build_table(void)
+{
+    s_table_size = 16;
+    while (s_table_size < s_asset_count * 2)
+    {
+        s_table_size *= 2;
+    }
+    s_table = calloc(s_table_size, sizeof(*s_table));
+    if (s_table == NULL)
+    {
+        return false;
+    }
+
+    size_t mask = s_table_size - 1;
+    for (size_t a = 0; a < s_asset_count; a++)
+    {
+        size_t i = path_hash(s_assets[a].path) & mask;
+        while (s_table[i])
+        {
+            i = (i + 1) & mask;
+        }
+        s_table[i] = &s_assets[a];
+    }
+    return true;
+}
+
+esp_err_t web_assets_load(const char *mount_point)
+{
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s", mount_point, WEB_ASSETS_MANIFEST);
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+    {
+        ESP_LOGW(TAG, "No %s, files are looked up with stat()", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    char line[MANIFEST_LINE_LEN];
+    size_t capacity = 0;
+    esp_err_t err = ESP_OK;
+
+    while (fgets(line, sizeof(line), f))
+    {
+        if (line[0] == '#' || line[0] == '\n')
+        {
+            continue;
+        }
+        if (s_asset_count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 32;
+            web_asset_t *grown = realloc(s_assets, capacity * sizeof(*s_assets));
+            if (grown == NULL)
+            {
+                err = ESP_ERR_NO_MEM;
+                break;
+            }
+            s_assets = grown;
+        }
+        if (parse_line(line, &s_assets[s_asset_count]))
+        {
+            s_asset_count++;
+        }
+        else
+        {
+            ESP_LOGW(TAG, "Skipping malformed manifest entry %u", (unsigned)(s_asset_count + 1));
+        }
+    }
+    fclose(f);
+
+    if (err == ESP_OK && !build_table())
+    {
+        err = ESP_ERR_NO_MEM;
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Out of memory loading the asset manifest");
+        for (size_t a = 0; a < s_asset_count; a++)
+        {
+            free((void *)s_assets[a].path);
+            free((void *)s_assets[a].type);
+        }
+        free(s_assets);
+        s_assets = NULL;
+        s_asset_count = 0;
+        return err;
+    }
+
+    ESP_LOGI(TAG, "Loaded %u assets (table of %u slots)", (unsigned)s_asset_count, (unsigned)s_table_size);
+    return ESP_OK;
+}
+
+// True if the entry's strings and data lie inside the image
+static bool bundle_entry_valid(const uint8_t *base, uint32_t total, const bundle_entry_t *e)
+{
+    if (e->path >= total || e->type >= total || memchr(base + e->path, '\0', total - e->path) == NULL ||
+        memchr(base + e->type, '\0', total - e->type) == NULL || e->offset[WEB_ASSET_IDENTITY] == 0)
+    {
+        return false;
+    }
+    for (int v = 0; v < WEB_ASSET_VARIANT_COUNT; v++)
+    {
+        if (e->offset[v] > total || e->size[v] > total - e->offset[v])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+esp_err_t web_assets_map_bundle(const char *partition_label)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partition_label);
+    if (part == NULL)
+    {
+        ESP_LOGW(TAG, "No \"%s\" partition", partition_label);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    bundle_header_t header;
+    esp_err_t err = esp_partition_read(part, 0, &header, sizeof(header));
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+    if (memcmp(header.magic, BUNDLE_MAGIC, sizeof(header.magic)) != 0 || header.version != BUNDLE_VERSION ||
+        header.total_size > part->size || header.total_size < sizeof(header) + header.count * sizeof(bundle_entry_t))
+    {
+        ESP_LOGW(TAG, "Partition \"%s\" holds no asset bundle", partition_label);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    const void *map;
+    err = esp_partition_mmap(part, 0, header.total_size, ESP_PARTITION_MMAP_DATA, &map, &s_bundle_map);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to map the asset bundle: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    const uint8_t *base = map;
+    const bundle_entry_t *entries = (const bundle_entry_t *)(base + sizeof(header));
+    s_assets = calloc(header.count ? header.count : 1, sizeof(*s_assets));
+    if (s_assets == NULL)
+    {
+        esp_partition_munmap(s_bundle_map);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Paths, types and contents stay in flash; only the index lives in RAM
+    for (uint16_t i = 0; i < header.count; i++)
+    {
+        const bundle_entry_t *e = &entries[i];
+        if (!bundle_entry_valid(base, header.total_size, e))
+        {
+            ESP_LOGW(TAG, "Skipping malformed bundle entry %u", (unsigned)i);
+            continue;
+        }
+        web_asset_t *asset = &s_assets[s_asset_count++];
+        asset->path = (const char *)base + e->path;
+        asset->type = (const char *)base + e->type;
+        for (int v = 0; v < WEB_ASSET_VARIANT_COUNT; v++)
+        {
+            if (e->offset[v] != 0)
+            {
+                asset->size[v] = e->size[v];
+                asset->data[v] = base + e->offset[v];
+            }
+        }
+        set_etags(asset, e->hash);
+    }
+
+    if (!build_table())
+    {
+        free(s_assets);
+        s_assets = NULL;
+        s_asset_count = 0;
+        esp_partition_munmap(s_bundle_map);
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Mapped %u assets (%lu bytes) from partition \"%s\"", (unsigned)s_asset_count,
+             (unsigned long)header.total_size, partition_label);
+    return ESP_OK;
+}
+
+bool web_assets_loaded(void)
+{
+    return s_table != NULL;
+}
+
+const web_asset_t *web_assets_find(const char *path)
+{
+    if (s_table == NULL)
+    {
+        return NULL;
+    }
+
+    size_t mask = s_table_size - 1;
+    for (size_t i = path_hash(path) & mask; s_table[i]; i = (i + 1) & mask)
+    {
+        if (strcmp(s_table[i]->path, path) == 0)
+        {
+            return s_table[i];
+        }
+    }
+    return NULL;
+}
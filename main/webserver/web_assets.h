@@ -0,0 +1,55 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+// Manifest written next to the web apps by tools/webassets/prepare_assets.py
+#define WEB_ASSETS_MANIFEST "assets.manifest"
+
+// Partition holding the read-only asset bundle (prepare_assets.py --bundle)
+#define WEB_ASSETS_PARTITION "assets"
+
+// Quoted 64-bit content hash plus an encoding suffix: "0123456789abcdef-br"
+#define WEB_ASSET_ETAG_LEN 24
+
+// Representations of one asset: the file itself and its precompressed siblings
+typedef enum
+{
+    WEB_ASSET_IDENTITY,
+    WEB_ASSET_GZIP, // <path>.gz
+    WEB_ASSET_BR,   // <path>.br
+    WEB_ASSET_VARIANT_COUNT
+} web_asset_variant_t;
+
+typedef struct
+{
+    const char *path;                                       // Relative to the mount point
+    const char *type;                                       // MIME type
+    uint32_t size[WEB_ASSET_VARIANT_COUNT];                 // 0 when a sibling does not exist
+    char etag[WEB_ASSET_VARIANT_COUNT][WEB_ASSET_ETAG_LEN]; // Strong ETag per representation, "" if unknown
+    const uint8_t *data[WEB_ASSET_VARIANT_COUNT];           // Memory-mapped contents, NULL when read from LittleFS
+} web_asset_t;
+
+/**
+ * @brief Load the asset manifest from the mount point into a hash table.
+ *        Called once before the server starts; the table is read-only afterwards.
+ * @return ESP_ERR_NOT_FOUND if the image has no manifest (files are then served with stat()).
+ */
+esp_err_t web_assets_load(const char *mount_point);
+
+/**
+ * @brief Map the read-only asset bundle in the given partition and index it.
+ *        Its files are then sent straight from flash (web_asset_t.data).
+ * @return ESP_ERR_NOT_FOUND if the partition is missing or holds no bundle.
+ */
+esp_err_t web_assets_map_bundle(const char *partition_label);
+
+/**
+ * @brief True once a manifest or bundle is loaded: paths missing from it do not exist.
+ */
+bool web_assets_loaded(void);
+
+/**
+ * @brief Look up an asset by its path relative to the mount point ("config/index.html").
+ */
+const web_asset_t *web_assets_find(const char *path);
@@ -0,0 +1,316 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "openweather_service.h"
+#include "json_writer.h"
+#include "web_weather.h"
+#include "web_events.h"
+
+static const char *TAG = "WEB_EVENTS";
+
+#ifndef CONFIG_WEATHER_WEB_EVENTS_HEARTBEAT_S
+#define CONFIG_WEATHER_WEB_EVENTS_HEARTBEAT_S 0
+#endif
+
+// Browsers reconnect after this long when the stream drops
+#define RECONNECT_MS 5000
+
+// Open streams, only touched on the HTTP server task (handler, close_fn and queued work)
+static int s_subscribers[WEB_EVENTS_MAX_SUBSCRIBERS];
+static volatile int s_subscriber_count = 0;
+static httpd_handle_t s_server = NULL;
+
+// Last values pushed, only touched by web_events_weather_updated()
+static CurrentWeather s_last_current;
+static MinutelyForecast s_last_minutely[NUM_MINUTELY];
+static uint32_t s_last_generation = 0;
+
+// One event, framed as an HTTP chunk, written to every subscriber by push_work()
+typedef struct
+{
+    size_t len;
+    char data[];
+} event_frame_t;
+
+// --- SUBSCRIBERS ---
+
+static bool add_subscriber(int fd)
+{
+    for (int i = 0; i < WEB_EVENTS_MAX_SUBSCRIBERS; i++)
+    {
+        if (s_subscribers[i] < 0)
+        {
+            s_subscribers[i] = fd;
+            s_subscriber_count++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void remove_subscriber(int fd)
+{
+    for (int i = 0; i < WEB_EVENTS_MAX_SUBSCRIBERS; i++)
+    {
+        if (s_subscribers[i] == fd)
+        {
+            s_subscribers[i] = -1;
+            s_subscriber_count--;
+            ESP_LOGI(TAG, "Subscriber on socket %d left (%d open)", fd, s_subscriber_count);
+        }
+    }
+}
+
+void web_events_session_closed(httpd_handle_t hd, int sockfd)
+{
+    remove_subscriber(sockfd);
+    close(sockfd);
+}
+
+// --- PUSH ---
+
+// Runs on the HTTP server task, so it never races the handler or the close callback.
+// A subscriber that cannot take the whole event right away is dropped rather than
+// stalling the server; the browser reconnects and gets the full document.
+static void push_work(void *arg)
+{
+    event_frame_t *frame = (event_frame_t *)arg;
+    for (int i = 0; i < WEB_EVENTS_MAX_SUBSCRIBERS; i++)
+    {
+        int fd = s_subscribers[i];
+        if (fd < 0)
+        {
+            continue;
+        }
+        int sent = httpd_socket_send(s_server, fd, frame->data, frame->len, MSG_DONTWAIT);
+        if (sent != (int)frame->len)
+        {
+            ESP_LOGW(TAG, "Dropping slow subscriber on socket %d", fd);
+            s_subscribers[i] = -1;
+            s_subscriber_count--;
+            httpd_sess_trigger_close(s_server, fd);
+        }
+    }
+    heap_caps_free(frame);
+}
+
+// Frame "event: <name>\ndata: <json>\n\n" as one HTTP chunk and queue it for every subscriber
+static void queue_event(const char *name, const char *json, size_t json_len)
+{
+    if (s_server == NULL || s_subscriber_count == 0)
+    {
+        return;
+    }
+
+    char head[48];
+    int head_len = snprintf(head, sizeof(head), "event: %s\ndata: ", name);
+    size_t body_len = head_len + json_len + 2;
+
+    event_frame_t *frame = heap_caps_malloc(sizeof(*frame) + body_len + 16, MALLOC_CAP_8BIT);
+    if (frame == NULL)
+    {
+        ESP_LOGE(TAG, "No memory for a %s event", name);
+        return;
+    }
+    int len = snprintf(frame->data, 16, "%x\r\n", (unsigned)body_len);
+    memcpy(frame->data + len, head, head_len);
+    len += head_len;
+    memcpy(frame->data + len, json, json_len);
+    len += json_len;
+    memcpy(frame->data + len, "\n\n\r\n", 4);
+    frame->len = len + 4;
+
+    if (httpd_queue_work(s_server, push_work, frame) != ESP_OK)
+    {
+        heap_caps_free(frame);
+    }
+}
+
+// --- DELTAS ---
+
+static bool changed_scaled(float now, float before, float scale)
+{
+    return lroundf(now * scale) != lroundf(before * scale);
+}
+
+#define DELTA_INT(w, key, now, before, full)  \
+    do                                        \
+    {                                         \
+        if ((full) || (now) != (before))      \
+            json_writer_int(w, key, now);     \
+    } while (0)
+
+#define DELTA_TENTHS(w, key, now, before, full)              \
+    do                                                       \
+    {                                                        \
+        if ((full) || changed_scaled(now, before, 10.0f))    \
+            json_writer_float(w, key, now, 1);               \
+    } while (0)
+
+// Values that differ from the last push (all of them on the first one)
+static void write_delta(json_writer_t *w, uint32_t generation, const CurrentWeather *now,
+                        const MinutelyForecast *minutely, bool full)
+{
+    const CurrentWeather *before = &s_last_current;
+
+    json_writer_begin_object(w, NULL);
+    json_writer_int(w, "generation", generation);
+
+    json_writer_begin_object(w, "current");
+    DELTA_INT(w, "dt", now->timestamp, before->timestamp, full);
+    DELTA_INT(w, "sunrise", now->sunrise, before->sunrise, full);
+    DELTA_INT(w, "sunset", now->sunset, before->sunset, full);
+    DELTA_TENTHS(w, "temp", now->temperature, before->temperature, full);
+    DELTA_TENTHS(w, "feelsLike", now->feelsLike, before->feelsLike, full);
+    DELTA_INT(w, "pressure", now->atmospheric.pressure, before->atmospheric.pressure, full);
+    DELTA_INT(w, "humidity", now->atmospheric.humidity, before->atmospheric.humidity, full);
+    DELTA_TENTHS(w, "dewPoint", now->atmospheric.dewPoint, before->atmospheric.dewPoint, full);
+    DELTA_TENTHS(w, "uvi", now->atmospheric.uvi, before->atmospheric.uvi, full);
+    DELTA_INT(w, "clouds", now->atmospheric.clouds, before->atmospheric.clouds, full);
+    DELTA_INT(w, "visibility", now->atmospheric.visibility, before->atmospheric.visibility, full);
+    DELTA_TENTHS(w, "windSpeed", now->wind.speed, before->wind.speed, full);
+    DELTA_INT(w, "windDeg", now->wind.degree, before->wind.degree, full);
+    DELTA_TENTHS(w, "windGust", now->wind.gust, before->wind.gust, full);
+    if (full || memcmp(&now->weather, &before->weather, sizeof(now->weather)) != 0)
+    {
+        json_writer_begin_object(w, "weather");
+        json_writer_int(w, "id", now->weather.id);
+        json_writer_string(w, "main", now->weather.main);
+        json_writer_string(w, "description", now->weather.description);
+        json_writer_string(w, "icon", now->weather.icon);
+        json_writer_end_object(w);
+    }
+    json_writer_end_object(w);
+
+    // The series moves with every refresh, so it is sent whole when anything in it changed
+    if (full || memcmp(minutely, s_last_minutely, sizeof(s_last_minutely)) != 0)
+    {
+        json_writer_begin_array(w, "minutely");
+        for (int i = 0; i < NUM_MINUTELY; i++)
+        {
+            if (minutely[i].timestamp == 0)
+                continue;
+            json_writer_begin_object(w, NULL);
+            json_writer_int(w, "dt", minutely[i].timestamp);
+            json_writer_float(w, "precipitation", minutely[i].precipitation, 2);
+            json_writer_end_object(w);
+        }
+        json_writer_end_array(w);
+    }
+
+    json_writer_end_object(w);
+}
+
+void web_events_weather_updated(void)
+{
+    // Copy what the delta needs; the lock is not held while serializing
+    static MinutelyForecast minutely[NUM_MINUTELY];
+    CurrentWeather current;
+    if (!openweather_lock(100))
+    {
+        return;
+    }
+    const OpenWeatherData *data = openweather_get_data();
+    uint32_t generation = openweather_get_generation();
+    current = data->current;
+    memcpy(minutely, data->minutely, sizeof(minutely));
+    openweather_unlock();
+
+    if (generation == s_last_generation)
+    {
+        return;
+    }
+
+    json_buffer_t buffer = {0};
+    json_writer_t w;
+    json_writer_init(&w, json_buffer_sink, &buffer);
+    write_delta(&w, generation, &current, minutely, s_last_generation == 0);
+    if (json_writer_finish(&w) == ESP_OK)
+    {
+        queue_event("delta", buffer.data, buffer.len);
+    }
+    heap_caps_free(buffer.data);
+
+    s_last_current = current;
+    memcpy(s_last_minutely, minutely, sizeof(s_last_minutely));
+    s_last_generation = generation;
+}
+
+static void heartbeat_cb(void *arg)
+{
+    char json[32];
+    int len = snprintf(json, sizeof(json), "{\"time\":%lld}", (long long)time(NULL));
+    queue_event("tick", json, len);
+}
+
+// --- HANDLER ---
+
+esp_err_t web_events_get_handler(httpd_req_t *req)
+{
+    int fd = httpd_req_to_sockfd(req);
+    if (s_subscriber_count >= WEB_EVENTS_MAX_SUBSCRIBERS)
+    {
+        ESP_LOGW(TAG, "Subscriber limit reached, refusing socket %d", fd);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "30");
+        httpd_resp_send(req, NULL, 0);
+        return ESP_OK;
+    }
+
+    httpd_resp_set_type(req, "text/event-stream");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+    // The first chunk sends the headers; the stream then stays open and the
+    // queued events are written to the socket as further chunks
+    char retry[24];
+    snprintf(retry, sizeof(retry), "retry: %d\n\n", RECONNECT_MS);
+    esp_err_t err = httpd_resp_send_chunk(req, retry, HTTPD_RESP_USE_STRLEN);
+
+    // Current state, from the document shared with /api/weather
+    const web_weather_json_t *json = web_weather_acquire(0);
+    if (err == ESP_OK && json)
+    {
+        err = httpd_resp_send_chunk(req, "event: weather\ndata: ", HTTPD_RESP_USE_STRLEN);
+        if (err == ESP_OK)
+            err = httpd_resp_send_chunk(req, json->data, json->len);
+        if (err == ESP_OK)
+            err = httpd_resp_send_chunk(req, "\n\n", 2);
+    }
+    web_weather_release(json);
+
+    if (err != ESP_OK || !add_subscriber(fd))
+    {
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "Subscriber on socket %d joined (%d open)", fd, s_subscriber_count);
+    return ESP_OK;
+}
+
+void web_events_init(httpd_handle_t server)
+{
+    for (int i = 0; i < WEB_EVENTS_MAX_SUBSCRIBERS; i++)
+    {
+        s_subscribers[i] = -1;
+    }
+    s_server = server;
+
+    if (CONFIG_WEATHER_WEB_EVENTS_HEARTBEAT_S > 0)
+    {
+        const esp_timer_create_args_t timer_args = {
+            .callback = heartbeat_cb,
+            .name = "sse_heartbeat",
+        };
+        esp_timer_handle_t timer;
+        if (esp_timer_create(&timer_args, &timer) == ESP_OK)
+        {
+            esp_timer_start_periodic(timer, (uint64_t)CONFIG_WEATHER_WEB_EVENTS_HEARTBEAT_S * 1000000);
+        }
+    }
+}
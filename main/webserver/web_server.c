@@ -1,15 +1,48 @@
 #include "web_server.h"
 #include "web_api.h"
+#include "web_assets.h"
+#include "web_asset_cache.h"
+#include "web_events.h"
+#include "web_workers.h"
 #include "esp_log.h"
 #include "esp_http_server.h"
+#if !CONFIG_IDF_TARGET_LINUX
 #include "esp_littlefs.h"
 #include "esp_vfs.h"
+#endif
 #include "nvs_storage.h"
 #include "cJSON.h"
+#include <stdlib.h>
+#include <strings.h>
 #include <sys/stat.h>
 
 static const char *TAG = "WEB_SERVER";
-#define MOUNT_POINT "/littlefs"
+#ifndef MOUNT_POINT
+#define MOUNT_POINT "/littlefs" // Host builds (tools/web_bench/server) serve a directory instead
+#endif
+#ifndef HTTP_PORT
+#define HTTP_PORT 80
+#endif
+#define FILEPATH_MAX 600
+
+// --- SOCKET BUDGET ---
+// Event streams and busy workers each hold a socket for as long as they run. When
+// every socket is taken, LRU purge closes the least recently used one, and event
+// streams never receive after their request, so they would go first. Size the
+// server so page loads (a browser opens several connections) fit beside them.
+#define PAGE_LOAD_SOCKETS 4
+#if CONFIG_WEATHER_WEB_EVENTS
+#define EVENT_SOCKETS WEB_EVENTS_MAX_SUBSCRIBERS
+#else
+#define EVENT_SOCKETS 0
+#endif
+#define HTTPD_MAX_SOCKETS (EVENT_SOCKETS + CONFIG_WEATHER_WEB_WORKERS + PAGE_LOAD_SOCKETS)
+
+// esp_http_server keeps 3 lwIP sockets for itself; the OpenWeather client and SNTP need 2 more
+#ifdef CONFIG_LWIP_MAX_SOCKETS
+_Static_assert(HTTPD_MAX_SOCKETS + 3 + 2 <= CONFIG_LWIP_MAX_SOCKETS,
+               "Raise CONFIG_LWIP_MAX_SOCKETS for the web server socket budget");
+#endif
 
 // --- HELPER: PATH ROUTING LOGIC ---
 // This is the brain that maps URLs to LittleFS folders
@@ -42,9 +75,9 @@ void resolve_filepath(char *filepath, size_t max_len, const char *uri)
     }
 }
 
-// --- HELPER 1: SET CONTENT TYPE ---
-// Sets the MIME type based on the file extension
-static void set_content_type_from_file(httpd_req_t *req, const char *filepath)
+// --- HELPER 1: CONTENT TYPE ---
+// MIME type based on the file extension
+static const char *content_type_from_file(const char *filepath)
 {
     const char *type = "text/plain"; // Default
     const char *ext = strrchr(filepath, '.');
@@ -66,10 +99,175 @@ static void set_content_type_from_file(httpd_req_t *req, const char *filepath)
         else if (strcmp(ext, ".svg") == 0)
             type = "image/svg+xml";
     }
-    httpd_resp_set_type(req, type);
+    return type;
+}
+
+// --- HELPER 2: CONTENT ENCODING ---
+// tools/webassets/prepare_assets.py writes file.gz (and optionally file.br) next to
+// text assets. Clients that accept the encoding get the smaller sibling.
+typedef struct
+{
+    web_asset_variant_t variant;
+    const char *name;   // Content-Encoding token
+    const char *suffix; // Sibling file suffix
+} content_encoding_t;
+
+// In order of preference
+static const content_encoding_t content_encodings[] = {
+    {WEB_ASSET_BR, "br", ".br"},
+    {WEB_ASSET_GZIP, "gzip", ".gz"},
+};
+
+static bool is_compressible_type(const char *type)
+{
+    return strncmp(type, "text/", 5) == 0 || strcmp(type, "application/javascript") == 0 ||
+           strcmp(type, "application/json") == 0 || strcmp(type, "image/svg+xml") == 0 ||
+           strcmp(type, "image/x-icon") == 0;
+}
+
+// True if the Accept-Encoding value lists coding without q=0
+static bool accepts_encoding(const char *accept, const char *coding)
+{
+    size_t len = strlen(coding);
+    const char *p = accept;
+
+    while (*p)
+    {
+        while (*p == ' ' || *p == ',')
+            p++;
+        const char *token = p;
+        while (*p && *p != ',' && *p != ';' && *p != ' ')
+            p++;
+        bool match = (size_t)(p - token) == len && strncasecmp(token, coding, len) == 0;
+
+        // Parameters up to the next coding; only q matters
+        float q = 1.0f;
+        while (*p && *p != ',')
+        {
+            if (*p == ';')
+            {
+                p++;
+                while (*p == ' ')
+                    p++;
+                if ((p[0] == 'q' || p[0] == 'Q') && p[1] == '=')
+                {
+                    q = strtof(p + 2, NULL);
+                }
+                continue;
+            }
+            p++;
+        }
+        if (match)
+        {
+            return q > 0.0f;
+        }
+    }
+    return false;
+}
+
+// The best precompressed sibling of asset the client accepts, or NULL to send the file as is
+static const content_encoding_t *select_encoding(httpd_req_t *req, const web_asset_t *asset)
+{
+    char accept[128] = "";
+    if (httpd_req_get_hdr_value_len(req, "Accept-Encoding") == 0)
+    {
+        return NULL;
+    }
+    // A truncated value is still parsed up to where it was cut
+    httpd_req_get_hdr_value_str(req, "Accept-Encoding", accept, sizeof(accept));
+
+    for (size_t i = 0; i < sizeof(content_encodings) / sizeof(content_encodings[0]); i++)
+    {
+        const content_encoding_t *encoding = &content_encodings[i];
+        if (asset->size[encoding->variant] > 0 && accepts_encoding(accept, encoding->name))
+        {
+            return encoding;
+        }
+    }
+    return NULL;
+}
+
+// --- HELPER 3: ASSET LOOKUP ---
+// ETag from the modification time and size, so a replaced file is not served from the
+// cache. Left empty (no ETag, not cached) when the filesystem keeps no modification time.
+static void set_stat_etag(char *etag, const struct stat *st, const char *suffix)
+{
+    if (st->st_mtime != 0)
+    {
+        snprintf(etag, WEB_ASSET_ETAG_LEN, "\"%lx-%lx%s\"", (unsigned long)(uint32_t)st->st_mtime,
+                 (unsigned long)(uint32_t)st->st_size, suffix);
+    }
+}
+
+// Without a manifest in the image, describe the file (and its siblings) with stat()
+static bool describe_from_filesystem(const char *filepath, web_asset_t *asset)
+{
+    struct stat st;
+    memset(asset, 0, sizeof(*asset));
+    if (stat(filepath, &st) == -1)
+    {
+        return false;
+    }
+    asset->path = filepath;
+    asset->type = content_type_from_file(filepath);
+    asset->size[WEB_ASSET_IDENTITY] = st.st_size;
+    set_stat_etag(asset->etag[WEB_ASSET_IDENTITY], &st, "");
+
+    if (is_compressible_type(asset->type))
+    {
+        char sibling[FILEPATH_MAX + 4];
+        for (size_t i = 0; i < sizeof(content_encodings) / sizeof(content_encodings[0]); i++)
+        {
+            snprintf(sibling, sizeof(sibling), "%s%s", filepath, content_encodings[i].suffix);
+            if (stat(sibling, &st) == 0)
+            {
+                asset->size[content_encodings[i].variant] = st.st_size;
+                set_stat_etag(asset->etag[content_encodings[i].variant], &st, content_encodings[i].suffix);
+            }
+        }
+    }
+    return true;
 }
 
-// --- HELPER 2: STREAM FILE ---
+// True if If-None-Match lists etag. The header uses weak comparison, so W/ is ignored.
+bool http_etag_matches(httpd_req_t *req, const char *etag)
+{
+    char header[256];
+    if (etag[0] == '\0' || httpd_req_get_hdr_value_len(req, "If-None-Match") == 0)
+    {
+        return false;
+    }
+    // A list too long for the buffer just gets the full response
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", header, sizeof(header)) != ESP_OK)
+    {
+        return false;
+    }
+
+    size_t len = strlen(etag);
+    const char *p = header;
+    while (*p)
+    {
+        while (*p == ' ' || *p == ',')
+            p++;
+        if (*p == '*')
+        {
+            return true;
+        }
+        if (strncmp(p, "W/", 2) == 0)
+        {
+            p += 2;
+        }
+        if (strncmp(p, etag, len) == 0 && (p[len] == '\0' || p[len] == ',' || p[len] == ' '))
+        {
+            return true;
+        }
+        while (*p && *p != ',')
+            p++;
+    }
+    return false;
+}
+
+// --- HELPER 4: STREAM FILE ---
 // Reads the file in small chunks and sends it to the socket.
 // Uses stack buffer to avoid heap fragmentation (malloc).
 #define FILE_CHUNK_SIZE 1024
@@ -109,43 +307,55 @@ static esp_err_t stream_file_to_socket(httpd_req_t *req, FILE *fd)
 // Orchestrates the request
 static esp_err_t common_get_handler(httpd_req_t *req)
 {
-    char filepath[600];
+    char filepath[FILEPATH_MAX];
 
     // 1. Resolve which file the user wants (routing logic /c vs /)
     resolve_filepath(filepath, sizeof(filepath), req->uri);
 
-    // 2. Check if the file exists (stat)
-    struct stat st;
-    if (stat(filepath, &st) == -1)
+    // 2. Describe it: from the asset bundle or the build-time manifest without
+    //    touching the filesystem, or with stat() when neither exists
+    web_asset_t scanned;
+    const web_asset_t *asset = NULL;
+    if (web_assets_loaded())
+    {
+        asset = web_assets_find(filepath + strlen(MOUNT_POINT) + 1);
+    }
+    else if (describe_from_filesystem(filepath, &scanned))
+    {
+        asset = &scanned;
+    }
+    if (asset == NULL)
     {
         ESP_LOGW(TAG, "404 Not Found: %s", filepath);
         httpd_resp_send_404(req);
         return ESP_FAIL;
     }
 
-    // 3. Open the file
-    FILE *fd = fopen(filepath, "r");
-    if (!fd)
-    {
-        ESP_LOGE(TAG, "500 Failed to open: %s", filepath);
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
-    }
+    // 3. Pick a precompressed sibling the client accepts, or the file itself
+    const content_encoding_t *encoding = select_encoding(req, asset);
+    web_asset_variant_t variant = encoding ? encoding->variant : WEB_ASSET_IDENTITY;
+    const char *etag = asset->etag[variant];
 
     // 4. Set headers
-    set_content_type_from_file(req, filepath);
-
-    ESP_LOGI(TAG, ">>> Start Sending: %s (%ld bytes)", filepath, st.st_size);
+    httpd_resp_set_type(req, asset->type);
+    if (asset->size[WEB_ASSET_GZIP] > 0 || asset->size[WEB_ASSET_BR] > 0)
+    {
+        // Caches must key the response on Accept-Encoding, whichever variant is sent
+        httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+    }
+    if (etag[0] != '\0')
+    {
+        httpd_resp_set_hdr(req, "ETag", etag);
+    }
 
     // --- SMART CACHE LOGIC ---
 
-    // If it's the main file (index.html), NEVER cache.
-    // The browser needs to read it to discover new .js/.css files.
+    // If it's the main file (index.html), always revalidate.
+    // The browser needs to read it to discover new .js/.css files; with an ETag
+    // an unchanged copy costs a 304 instead of the whole file.
     if (strstr(filepath, "index.html"))
     {
-        httpd_resp_set_hdr(req, "Cache-Control", "no-cache, no-store, must-revalidate");
-        httpd_resp_set_hdr(req, "Pragma", "no-cache");
-        httpd_resp_set_hdr(req, "Expires", "0");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
     }
 
     else if (strstr(filepath, "_app/"))
@@ -155,10 +365,66 @@ static esp_err_t common_get_handler(httpd_req_t *req)
         httpd_resp_set_hdr(req, "Cache-Control", "max-age=31536000, immutable");
     }
 
-    // 5. Send the content (stream)
+    // 5. The client's copy is current: headers only
+    if (http_etag_matches(req, etag))
+    {
+        ESP_LOGI(TAG, "304 Not Modified: %s", filepath);
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    if (encoding)
+    {
+        httpd_resp_set_hdr(req, "Content-Encoding", encoding->name);
+    }
+
+    // 6. Bundled asset: send straight from memory-mapped flash in one response
+    if (asset->data[variant])
+    {
+        ESP_LOGI(TAG, ">>> Sending from flash: %s%s (%lu bytes)", asset->path, encoding ? encoding->suffix : "",
+                 (unsigned long)asset->size[variant]);
+        esp_err_t ret = httpd_resp_send(req, (const char *)asset->data[variant], asset->size[variant]);
+        if (ret != ESP_OK)
+        {
+            ESP_LOGE(TAG, "XXX Failed Sending: %s (Error: %d)", asset->path, ret);
+        }
+        return ret;
+    }
+
+    // 7. The file (or its sibling) from the PSRAM cache, read into it on a miss
+    if (encoding)
+    {
+        size_t len = strlen(filepath);
+        snprintf(filepath + len, sizeof(filepath) - len, "%s", encoding->suffix);
+    }
+    const uint8_t *cached = web_asset_cache_get(filepath, etag, asset->size[variant]);
+    if (cached)
+    {
+        ESP_LOGI(TAG, ">>> Sending from cache: %s (%lu bytes)", filepath, (unsigned long)asset->size[variant]);
+        esp_err_t ret = httpd_resp_send(req, (const char *)cached, asset->size[variant]);
+        web_asset_cache_release(cached);
+        if (ret != ESP_OK)
+        {
+            ESP_LOGE(TAG, "XXX Failed Sending: %s (Error: %d)", filepath, ret);
+        }
+        return ret;
+    }
+
+    // 8. Too large to cache (or no PSRAM): open the file
+    FILE *fd = fopen(filepath, "r");
+    if (!fd)
+    {
+        ESP_LOGE(TAG, "500 Failed to open: %s", filepath);
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    ESP_LOGI(TAG, ">>> Start Sending: %s (%lu bytes)", filepath, (unsigned long)asset->size[variant]);
+
+    // 9. Send the content (stream)
     esp_err_t ret = stream_file_to_socket(req, fd);
 
-    // 6. Cleanup
+    // 10. Cleanup
     fclose(fd);
 
     if (ret != ESP_OK)
@@ -169,10 +435,29 @@ static esp_err_t common_get_handler(httpd_req_t *req)
     return ret;
 }
 
+// --- WORKER DISPATCH ---
+// Handlers that can take long (streaming a file to a slow client, touching NVS or the
+// Wi-Fi driver) run on a worker, so the server task keeps accepting other requests.
+static esp_err_t files_get_handler(httpd_req_t *req)
+{
+    return web_workers_dispatch(req, common_get_handler);
+}
+
+static esp_err_t scan_get_handler(httpd_req_t *req)
+{
+    return web_workers_dispatch(req, api_scan_get_handler);
+}
+
+static esp_err_t save_post_handler(httpd_req_t *req)
+{
+    return web_workers_dispatch(req, api_save_post_handler);
+}
+
 // --- INITIALIZATION ---
 
 void web_server_init(void)
 {
+#if !CONFIG_IDF_TARGET_LINUX
     esp_vfs_littlefs_conf_t conf = {
         .base_path = MOUNT_POINT,
         .partition_label = "littlefs",
@@ -185,22 +470,41 @@ void web_server_init(void)
         ESP_LOGE(TAG, "Failed to mount LittleFS");
         return;
     }
+#endif
+
+    esp_err_t assets_err = ESP_ERR_NOT_FOUND;
+#if CONFIG_WEATHER_WEB_ASSETS_BUNDLE
+    // Web apps live in their own read-only partition; LittleFS only keeps mutable data
+    assets_err = web_assets_map_bundle(WEB_ASSETS_PARTITION);
+#endif
+    if (assets_err != ESP_OK)
+    {
+        // Without a manifest the file handler falls back to stat()
+        web_assets_load(MOUNT_POINT);
+    }
 
     httpd_handle_t server = NULL;
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.server_port = HTTP_PORT;
     config.uri_match_fn = httpd_uri_match_wildcard;
     config.max_uri_handlers = 10; // Increased just in case
     config.stack_size = 8192;
     config.send_wait_timeout = 60;
     config.recv_wait_timeout = 60;
+    config.max_open_sockets = HTTPD_MAX_SOCKETS;
     config.lru_purge_enable = true;
+#if CONFIG_WEATHER_WEB_EVENTS
+    // Event streams stay open after their handler returns; forget them when the socket closes
+    config.close_fn = web_events_session_closed;
+#endif
     ESP_LOGI(TAG, "Starting Web Server...");
     if (httpd_start(&server, &config) == ESP_OK)
     {
+        web_workers_start();
 
         // 1. API: Scan Networks
         httpd_uri_t uri_scan = {
-            .uri = "/api/scan", .method = HTTP_GET, .handler = api_scan_get_handler, .user_ctx = NULL};
+            .uri = "/api/scan", .method = HTTP_GET, .handler = scan_get_handler, .user_ctx = NULL};
         httpd_register_uri_handler(server, &uri_scan);
 
         // 2. API: Get Configuration
@@ -210,12 +514,37 @@ void web_server_init(void)
 
         // 3. API: Save Configuration
         httpd_uri_t uri_save = {
-            .uri = "/api/save", .method = HTTP_POST, .handler = api_save_post_handler, .user_ctx = NULL};
+            .uri = "/api/save", .method = HTTP_POST, .handler = save_post_handler, .user_ctx = NULL};
         httpd_register_uri_handler(server, &uri_save);
 
-        // 4. Files: Catch-All (Must be last)
+#if CONFIG_WEATHER_FRAME_PROFILER
+        // 4. API: Frame profiling
+        httpd_uri_t uri_perf = {
+            .uri = "/api/perf", .method = HTTP_GET, .handler = api_perf_get_handler, .user_ctx = NULL};
+        httpd_register_uri_handler(server, &uri_perf);
+#endif
+
+        // 5. API: Web asset cache counters
+        httpd_uri_t uri_cache = {
+            .uri = "/api/cache", .method = HTTP_GET, .handler = api_cache_get_handler, .user_ctx = NULL};
+        httpd_register_uri_handler(server, &uri_cache);
+
+        // 6. API: Weather snapshot
+        httpd_uri_t uri_weather = {
+            .uri = "/api/weather", .method = HTTP_GET, .handler = api_weather_get_handler, .user_ctx = NULL};
+        httpd_register_uri_handler(server, &uri_weather);
+
+#if CONFIG_WEATHER_WEB_EVENTS
+        // 7. API: Server-Sent Events (weather deltas and clock ticks)
+        httpd_uri_t uri_events = {
+            .uri = "/api/events", .method = HTTP_GET, .handler = web_events_get_handler, .user_ctx = NULL};
+        httpd_register_uri_handler(server, &uri_events);
+        web_events_init(server);
+#endif
+
+        // 8. Files: Catch-All (Must be last)
         httpd_uri_t uri_files = {
-            .uri = "/*", .method = HTTP_GET, .handler = common_get_handler, .user_ctx = NULL};
+            .uri = "/*", .method = HTTP_GET, .handler = files_get_handler, .user_ctx = NULL};
         httpd_register_uri_handler(server, &uri_files);
     }
 }
\ No newline at end of file
@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_random.h"
+#include "esp_log.h"
+#include "openweather_service.h"
+#include "json_writer.h"
+#include "web_weather.h"
+
+static const char *TAG = "WEB_WEATHER";
+
+#define SECTION_VARIANTS 4 // Every combination of WEB_WEATHER_HOURLY and WEB_WEATHER_DAILY
+
+// A serialized document, shared by the requests sending it
+typedef struct
+{
+    web_weather_json_t json;
+    uint32_t refs;
+    bool current; // Still in s_documents; a replaced document is freed on its last release
+} document_t;
+
+static SemaphoreHandle_t s_mutex = NULL;
+static portMUX_TYPE s_init_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Guarded by s_mutex
+static document_t *s_documents[SECTION_VARIANTS];
+static OpenWeatherData *s_snapshot = NULL; // Copy of the weather data the documents are built from
+static uint32_t s_snapshot_generation = 0;
+static uint32_t s_boot_id = 0; // Generations restart at every boot, ETags must not
+
+static bool weather_json_lock(void)
+{
+    if (s_mutex == NULL)
+    {
+        SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+        if (mutex == NULL)
+        {
+            return false;
+        }
+        taskENTER_CRITICAL(&s_init_lock);
+        if (s_mutex == NULL)
+        {
+            s_mutex = mutex;
+            mutex = NULL;
+        }
+        taskEXIT_CRITICAL(&s_init_lock);
+        if (mutex)
+        {
+            vSemaphoreDelete(mutex);
+        }
+    }
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    return true;
+}
+
+static void weather_json_unlock(void)
+{
+    xSemaphoreGive(s_mutex);
+}
+
+// --- SERIALIZATION ---
+
+static void write_condition(json_writer_t *w, const WeatherCondition *weather)
+{
+    json_writer_begin_object(w, "weather");
+    json_writer_int(w, "id", weather->id);
+    json_writer_string(w, "main", weather->main);
+    json_writer_string(w, "description", weather->description);
+    json_writer_string(w, "icon", weather->icon);
+    json_writer_end_object(w);
+}
+
+static void write_atmospheric(json_writer_t *w, const AtmosphericForecast *atmospheric)
+{
+    json_writer_int(w, "pressure", atmospheric->pressure);
+    json_writer_int(w, "humidity", atmospheric->humidity);
+    json_writer_float(w, "dewPoint", atmospheric->dewPoint, 1);
+    json_writer_float(w, "uvi", atmospheric->uvi, 1);
+    json_writer_int(w, "clouds", atmospheric->clouds);
+    json_writer_int(w, "visibility", atmospheric->visibility);
+}
+
+static void write_wind(json_writer_t *w, const WindForecast *wind)
+{
+    json_writer_float(w, "windSpeed", wind->speed, 1);
+    json_writer_int(w, "windDeg", wind->degree);
+    json_writer_float(w, "windGust", wind->gust, 1);
+}
+
+static void write_temperatures(json_writer_t *w, const char *key, const TemperatureForecast *t)
+{
+    json_writer_begin_object(w, key);
+    json_writer_float(w, "day", t->day, 1);
+    json_writer_float(w, "min", t->min, 1);
+    json_writer_float(w, "max", t->max, 1);
+    json_writer_float(w, "night", t->night, 1);
+    json_writer_float(w, "eve", t->eve, 1);
+    json_writer_float(w, "morn", t->morn, 1);
+    json_writer_end_object(w);
+}
+
+static void write_document(json_writer_t *w, const OpenWeatherData *data, uint32_t generation, uint8_t sections)
+{
+    json_writer_begin_object(w, NULL);
+    json_writer_int(w, "generation", generation);
+
+    json_writer_begin_object(w, "location");
+    json_writer_float(w, "lat", data->coord.latitude, 4);
+    json_writer_float(w, "lon", data->coord.longitude, 4);
+    json_writer_string(w, "timezone", data->coord.timezone);
+    json_writer_int(w, "timezoneOffset", data->coord.timezoneOffset);
+    json_writer_end_object(w);
+
+    const CurrentWeather *current = &data->current;
+    json_writer_begin_object(w, "current");
+    json_writer_int(w, "dt", current->timestamp);
+    json_writer_int(w, "sunrise", current->sunrise);
+    json_writer_int(w, "sunset", current->sunset);
+    json_writer_float(w, "temp", current->temperature, 1);
+    json_writer_float(w, "feelsLike", current->feelsLike, 1);
+    write_atmospheric(w, &current->atmospheric);
+    write_wind(w, &current->wind);
+    write_condition(w, &current->weather);
+    json_writer_end_object(w);
+
+    // Slots without a timestamp were missing from the OpenWeather response
+    json_writer_begin_array(w, "minutely");
+    for (int i = 0; i < NUM_MINUTELY; i++)
+    {
+        if (data->minutely[i].timestamp == 0)
+            continue;
+        json_writer_begin_object(w, NULL);
+        json_writer_int(w, "dt", data->minutely[i].timestamp);
+        json_writer_float(w, "precipitation", data->minutely[i].precipitation, 2);
+        json_writer_end_object(w);
+    }
+    json_writer_end_array(w);
+
+    if (sections & WEB_WEATHER_HOURLY)
+    {
+        json_writer_begin_array(w, "hourly");
+        for (int i = 0; i < NUM_HOURLY; i++)
+        {
+            const HourlyForecast *hour = &data->hourly[i];
+            if (hour->timestamp == 0)
+                continue;
+            json_writer_begin_object(w, NULL);
+            json_writer_int(w, "dt", hour->timestamp);
+            json_writer_float(w, "temp", hour->temperature, 1);
+            json_writer_float(w, "feelsLike", hour->feelsLike, 1);
+            write_atmospheric(w, &hour->atmospheric);
+            write_wind(w, &hour->wind);
+            json_writer_float(w, "pop", hour->pPrecipitation, 2);
+            write_condition(w, &hour->weather);
+            json_writer_end_object(w);
+        }
+        json_writer_end_array(w);
+    }
+
+    if (sections & WEB_WEATHER_DAILY)
+    {
+        json_writer_begin_array(w, "daily");
+        for (int i = 0; i < NUM_DAILY; i++)
+        {
+            const DailyForecast *day = &data->daily[i];
+            if (day->timestamp == 0)
+                continue;
+            json_writer_begin_object(w, NULL);
+            json_writer_int(w, "dt", day->timestamp);
+            write_temperatures(w, "temp", &day->temperature);
+            write_temperatures(w, "feelsLike", &day->feelsLike);
+            write_atmospheric(w, &day->atmospheric);
+            write_wind(w, &day->wind);
+            json_writer_float(w, "pop", day->pPrecipitation, 2);
+            json_writer_float(w, "rain", day->rainPrecipitation, 2);
+            json_writer_float(w, "snow", day->snowPrecipitation, 2);
+            write_condition(w, &day->weather);
+            json_writer_end_object(w);
+        }
+        json_writer_end_array(w);
+    }
+
+    json_writer_end_object(w);
+}
+
+// --- SNAPSHOT AND DOCUMENTS (s_mutex held) ---
+
+// Copy the weather data once per refresh; the weather lock is held only for the copy
+static bool update_snapshot(uint32_t generation)
+{
+    if (s_snapshot != NULL && s_snapshot_generation == generation)
+    {
+        return true;
+    }
+    if (s_snapshot == NULL)
+    {
+        s_snapshot = heap_caps_malloc(sizeof(*s_snapshot), MALLOC_CAP_SPIRAM);
+        if (s_snapshot == NULL)
+        {
+            s_snapshot = heap_caps_malloc(sizeof(*s_snapshot), MALLOC_CAP_8BIT);
+        }
+        if (s_snapshot == NULL)
+        {
+            ESP_LOGE(TAG, "No memory for the weather snapshot");
+            return false;
+        }
+    }
+
+    if (!openweather_lock(100))
+    {
+        ESP_LOGW(TAG, "Weather data busy");
+        return false;
+    }
+    memcpy(s_snapshot, openweather_get_data(), sizeof(*s_snapshot));
+    s_snapshot_generation = openweather_get_generation();
+    openweather_unlock();
+    return true;
+}
+
+static void free_document(document_t *doc)
+{
+    heap_caps_free(doc->json.data);
+    heap_caps_free(doc);
+}
+
+static document_t *build_document(uint8_t sections)
+{
+    document_t *doc = heap_caps_calloc(1, sizeof(*doc), MALLOC_CAP_8BIT);
+    if (doc == NULL)
+    {
+        return NULL;
+    }
+
+    json_buffer_t buffer = {0};
+    json_writer_t w;
+    json_writer_init(&w, json_buffer_sink, &buffer);
+    write_document(&w, s_snapshot, s_snapshot_generation, sections);
+    if (json_writer_finish(&w) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "No memory to serialize the weather data");
+        heap_caps_free(buffer.data);
+        heap_caps_free(doc);
+        return NULL;
+    }
+
+    if (s_boot_id == 0)
+    {
+        s_boot_id = esp_random();
+    }
+    doc->json.generation = s_snapshot_generation;
+    doc->json.sections = sections;
+    doc->json.data = buffer.data;
+    doc->json.len = buffer.len;
+    snprintf(doc->json.etag, sizeof(doc->json.etag), "\"%08lx-%lu-%u\"", (unsigned long)s_boot_id,
+             (unsigned long)s_snapshot_generation, (unsigned)sections);
+    ESP_LOGI(TAG, "Serialized generation %lu, sections 0x%x: %u bytes", (unsigned long)s_snapshot_generation,
+             (unsigned)sections, (unsigned)buffer.len);
+    return doc;
+}
+
+const web_weather_json_t *web_weather_acquire(uint8_t sections)
+{
+    sections &= SECTION_VARIANTS - 1;
+    uint32_t generation = openweather_get_generation();
+    if (generation == 0 || !weather_json_lock())
+    {
+        return NULL;
+    }
+
+    document_t *doc = s_documents[sections];
+    if (doc == NULL || doc->json.generation != generation)
+    {
+        document_t *fresh = update_snapshot(generation) ? build_document(sections) : NULL;
+        if (fresh)
+        {
+            if (doc)
+            {
+                doc->current = false;
+                if (doc->refs == 0)
+                {
+                    free_document(doc);
+                }
+            }
+            fresh->current = true;
+            s_documents[sections] = fresh;
+            doc = fresh;
+        }
+        // Otherwise keep answering with the previous refresh, if there is one
+    }
+    if (doc)
+    {
+        doc->refs++;
+    }
+    weather_json_unlock();
+    return doc ? &doc->json : NULL;
+}
+
+void web_weather_release(const web_weather_json_t *json)
+{
+    if (json == NULL)
+    {
+        return;
+    }
+    document_t *doc = (document_t *)json; // json is the first member
+
+    weather_json_lock();
+    doc->refs--;
+    bool orphaned = doc->refs == 0 && !doc->current;
+    weather_json_unlock();
+
+    if (orphaned)
+    {
+        free_document(doc);
+    }
+}
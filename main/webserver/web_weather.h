@@ -0,0 +1,29 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Optional sections of the /api/weather document (current and minutely are always included)
+#define WEB_WEATHER_HOURLY 0x01
+#define WEB_WEATHER_DAILY 0x02
+
+// "<boot id>-<generation>-<sections>", quoted
+#define WEB_WEATHER_ETAG_LEN 32
+
+typedef struct
+{
+    uint32_t generation; // openweather_get_generation() it was serialized from
+    uint8_t sections;    // WEB_WEATHER_* flags
+    size_t len;
+    char etag[WEB_WEATHER_ETAG_LEN];
+    char *data; // JSON, NUL-terminated
+} web_weather_json_t;
+
+/**
+ * @brief The weather document for the latest refresh. It is serialized on the first
+ *        request after each refresh and shared by every request until the next one.
+ *        The weather lock is only held while copying the data, never while serializing.
+ * @return NULL if there is no weather data yet (or no memory). Release it once sent.
+ */
+const web_weather_json_t *web_weather_acquire(uint8_t sections);
+
+void web_weather_release(const web_weather_json_t *json);
@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_idf_version.h"
+#include "esp_log.h"
+#include "web_workers.h"
+
+static const char *TAG = "WEB_WORKERS";
+
+#ifndef CONFIG_WEATHER_WEB_WORKERS
+#define CONFIG_WEATHER_WEB_WORKERS 0
+#endif
+#ifndef CONFIG_WEATHER_WEB_WORKER_STACK
+#define CONFIG_WEATHER_WEB_WORKER_STACK 6144
+#endif
+
+// httpd_req_async_handler_begin() is available from ESP-IDF 5.1
+#define WORKERS_SUPPORTED (CONFIG_WEATHER_WEB_WORKERS > 0 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0))
+
+#if WORKERS_SUPPORTED
+
+// Same priority as the server task, so streaming never starves it
+#define WORKER_PRIORITY (tskIDLE_PRIORITY + 5)
+
+typedef struct
+{
+    httpd_req_t *req; // Async copy, owned by the worker until completed
+    esp_err_t (*handler)(httpd_req_t *req);
+} web_job_t;
+
+static QueueHandle_t s_jobs = NULL;
+static TaskHandle_t s_workers[CONFIG_WEATHER_WEB_WORKERS];
+
+static bool on_worker(void)
+{
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    for (int i = 0; i < CONFIG_WEATHER_WEB_WORKERS; i++)
+    {
+        if (s_workers[i] == self)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void worker_task(void *arg)
+{
+    web_job_t job;
+    while (1)
+    {
+        if (xQueueReceive(s_jobs, &job, portMAX_DELAY) == pdTRUE)
+        {
+            // httpd closes a failed session itself only on the synchronous path. A
+            // keep-alive socket may hold an unread body or a half-sent response.
+            if (job.handler(job.req) != ESP_OK)
+            {
+                httpd_sess_trigger_close(job.req->handle, httpd_req_to_sockfd(job.req));
+            }
+            httpd_req_async_handler_complete(job.req);
+        }
+    }
+}
+
+void web_workers_start(void)
+{
+    s_jobs = xQueueCreate(WEB_WORKERS_QUEUE_LEN, sizeof(web_job_t));
+    if (s_jobs == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the job queue, handling requests on the server task");
+        return;
+    }
+
+    for (int i = 0; i < CONFIG_WEATHER_WEB_WORKERS; i++)
+    {
+        char name[16];
+        snprintf(name, sizeof(name), "httpd_worker%d", i);
+        if (xTaskCreate(worker_task, name, CONFIG_WEATHER_WEB_WORKER_STACK, NULL, WORKER_PRIORITY, &s_workers[i]) != pdPASS)
+        {
+            ESP_LOGE(TAG, "Failed to start %s", name);
+            s_workers[i] = NULL;
+        }
+    }
+    ESP_LOGI(TAG, "%d workers, %d bytes of stack each", CONFIG_WEATHER_WEB_WORKERS, CONFIG_WEATHER_WEB_WORKER_STACK);
+}
+
+esp_err_t web_workers_dispatch(httpd_req_t *req, esp_err_t (*handler)(httpd_req_t *req))
+{
+    if (s_jobs == NULL || on_worker())
+    {
+        return handler(req);
+    }
+
+    web_job_t job = {.handler = handler};
+    esp_err_t err = httpd_req_async_handler_begin(req, &job.req);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to detach %s: %s", req->uri, esp_err_to_name(err));
+        return handler(req);
+    }
+
+    // Bounded: a full queue means every worker is busy with a backlog already
+    if (xQueueSend(s_jobs, &job, 0) != pdTRUE)
+    {
+        ESP_LOGW(TAG, "Workers busy, rejecting %s", job.req->uri);
+        httpd_resp_set_status(job.req, "503 Service Unavailable");
+        httpd_resp_set_hdr(job.req, "Retry-After", "1");
+        httpd_resp_send(job.req, NULL, 0);
+        if (job.req->content_len > 0)
+        {
+            // The body was never read, it must not be parsed as the next request
+            httpd_sess_trigger_close(job.req->handle, httpd_req_to_sockfd(job.req));
+        }
+        httpd_req_async_handler_complete(job.req);
+    }
+    return ESP_OK;
+}
+
+#else
+
+void web_workers_start(void)
+{
+    ESP_LOGI(TAG, "No workers, handling requests on the server task");
+}
+
+esp_err_t web_workers_dispatch(httpd_req_t *req, esp_err_t (*handler)(httpd_req_t *req))
+{
+    return handler(req);
+}
+
+#endif
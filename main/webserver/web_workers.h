@@ -0,0 +1,18 @@
+#pragma once
+#include "esp_http_server.h"
+
+// Requests waiting for a free worker; further ones get 503
+#define WEB_WORKERS_QUEUE_LEN 6
+
+/**
+ * @brief Start CONFIG_WEATHER_WEB_WORKERS worker tasks for slow handlers.
+ *        Without workers, web_workers_dispatch() runs handlers on the server task.
+ */
+void web_workers_start(void);
+
+/**
+ * @brief Hand the request to a worker (httpd async request) so the server task is free
+ *        for other sockets while handler runs. Runs handler directly when called on a
+ *        worker or when there are no workers.
+ */
+esp_err_t web_workers_dispatch(httpd_req_t *req, esp_err_t (*handler)(httpd_req_t *req));
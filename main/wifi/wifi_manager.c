@@ -1,6 +1,7 @@
 #include <stddef.h>
 #include <string.h>
 #include "wifi_manager.h"
+#include "wifi_scan.h"
 #include "nvs_storage.h"
 #include "ntp_manager.h"
 #include "esp_wifi.h"
@@ -197,6 +198,9 @@ bool wifi_manager_start_softap(void)
 
     ui_show_AP_qr(softap_info.ssid, softap_info.psk);
 
+    // Have the network list ready by the time the config page asks for it
+    wifi_scan_start();
+
     return true;
 }
 
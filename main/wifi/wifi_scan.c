@@ -1,24 +1,136 @@
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
 #include "wifi_scan.h"
 #include "esp_wifi.h"
+#include "esp_event.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
 
 static const char *TAG_SCAN = "WIFI_SCAN";
 
-void wifi_scan_ssids_json(char *output, size_t max_len)
+typedef struct
 {
-    // 1. Check current mode
+    char ssid[33];
+    int8_t rssi;
+    uint8_t auth;
+} scan_result_t;
+
+// Written from the event loop task on WIFI_EVENT_SCAN_DONE, read by HTTP handlers
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static scan_result_t s_results[WIFI_SCAN_MAX_RESULTS];
+static uint16_t s_result_count = 0;
+static int64_t s_results_time_us = 0; // 0 until the first scan completes
+static bool s_scanning = false;
+static bool s_handler_registered = false;
+
+// Only one scan runs at a time, and both buffers are too large for the event loop stack
+static scan_result_t s_staging[WIFI_SCAN_MAX_RESULTS];
+
+static int compare_rssi(const void *a, const void *b)
+{
+    return ((const scan_result_t *)b)->rssi - ((const scan_result_t *)a)->rssi;
+}
+
+// Keep the strongest record of each SSID, hidden networks dropped, sorted by RSSI
+static uint16_t collect_results(const wifi_ap_record_t *records, uint16_t count, scan_result_t *out)
+{
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        const char *ssid = (const char *)records[i].ssid;
+        if (ssid[0] == '\0')
+        {
+            continue;
+        }
+
+        uint16_t j = 0;
+        while (j < n && strcmp(out[j].ssid, ssid) != 0)
+        {
+            j++;
+        }
+        if (j == n)
+        {
+            snprintf(out[n].ssid, sizeof(out[n].ssid), "%s", ssid);
+            out[n].rssi = records[i].rssi;
+            out[n].auth = records[i].authmode;
+            n++;
+        }
+        else if (records[i].rssi > out[j].rssi)
+        {
+            out[j].rssi = records[i].rssi;
+            out[j].auth = records[i].authmode;
+        }
+    }
+    qsort(out, n, sizeof(*out), compare_rssi);
+    return n;
+}
+
+static void scan_done_handler(void *arg, esp_event_base_t event_base, int32_t event_id, void *event_data)
+{
+    wifi_event_sta_scan_done_t *event = (wifi_event_sta_scan_done_t *)event_data;
+
+    uint16_t ap_num = WIFI_SCAN_MAX_RESULTS;
+    wifi_ap_record_t *records = heap_caps_malloc(ap_num * sizeof(*records), MALLOC_CAP_8BIT);
+
+    // Fetching the records frees the driver's list; it must be cleared explicitly otherwise
+    if (event->status != 0 || records == NULL || esp_wifi_scan_get_ap_records(&ap_num, records) != ESP_OK)
+    {
+        ESP_LOGE(TAG_SCAN, "Scan failed (status %lu)", (unsigned long)event->status);
+        esp_wifi_clear_ap_list();
+        heap_caps_free(records);
+        taskENTER_CRITICAL(&s_lock);
+        s_scanning = false;
+        taskEXIT_CRITICAL(&s_lock);
+        return;
+    }
+    uint16_t count = collect_results(records, ap_num, s_staging);
+    heap_caps_free(records);
+    ESP_LOGI(TAG_SCAN, "Found %d networks (%u access points)", count, (unsigned)event->number);
+
+    taskENTER_CRITICAL(&s_lock);
+    memcpy(s_results, s_staging, count * sizeof(s_staging[0]));
+    s_result_count = count;
+    s_results_time_us = esp_timer_get_time();
+    s_scanning = false;
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+bool wifi_scan_start(void)
+{
+    taskENTER_CRITICAL(&s_lock);
+    bool busy = s_scanning;
+    s_scanning = true;
+    taskEXIT_CRITICAL(&s_lock);
+    if (busy)
+    {
+        return true;
+    }
+
+    if (!s_handler_registered)
+    {
+        esp_err_t err = esp_event_handler_instance_register(WIFI_EVENT, WIFI_EVENT_SCAN_DONE, &scan_done_handler, NULL, NULL);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(TAG_SCAN, "Failed to register the scan handler: %s", esp_err_to_name(err));
+            taskENTER_CRITICAL(&s_lock);
+            s_scanning = false;
+            taskEXIT_CRITICAL(&s_lock);
+            return false;
+        }
+        s_handler_registered = true;
+    }
+
+    // A SoftAP-only device has to switch to APSTA to scan; it stays in APSTA afterwards
     wifi_mode_t current_mode;
     esp_wifi_get_mode(&current_mode);
-
-    // 2. If we are in AP-only mode, we MUST switch to APSTA to scan
-    if (current_mode == WIFI_MODE_AP) {
+    if (current_mode == WIFI_MODE_AP)
+    {
         ESP_LOGI(TAG_SCAN, "Switching to APSTA mode for scanning...");
         esp_wifi_set_mode(WIFI_MODE_APSTA);
-        // Small delay to let the mode switch settle
-        vTaskDelay(pdMS_TO_TICKS(100));
     }
 
-    // 3. Configure the scan
     wifi_scan_config_t scan_config = {
         .ssid = NULL,
         .bssid = NULL,
@@ -27,56 +139,58 @@ void wifi_scan_ssids_json(char *output, size_t max_len)
         .scan_type = WIFI_SCAN_TYPE_ACTIVE
     };
 
-    // 4. Start Scan (Blocking Mode)
-    // Note: This blocks the HTTP Task. Ensure your Watchdog timeout is high enough
-    ESP_LOGI(TAG_SCAN, "Starting Scan...");
-    esp_err_t err = esp_wifi_scan_start(&scan_config, true);
-    
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_SCAN, "Scan failed! Error: %s", esp_err_to_name(err));
-        // Return empty array on error
-        snprintf(output, max_len, "[]");
-        // Restore mode if we changed it
-        if (current_mode == WIFI_MODE_AP) esp_wifi_set_mode(WIFI_MODE_AP);
-        return;
+    // Non-blocking: the results arrive with WIFI_EVENT_SCAN_DONE
+    esp_err_t err = esp_wifi_scan_start(&scan_config, false);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG_SCAN, "Scan failed to start! Error: %s", esp_err_to_name(err));
+        taskENTER_CRITICAL(&s_lock);
+        s_scanning = false;
+        taskEXIT_CRITICAL(&s_lock);
+        return false;
     }
+    ESP_LOGI(TAG_SCAN, "Starting Scan...");
+    return true;
+}
 
-    // 5. Get Records
-    uint16_t ap_num = 32;
-    wifi_ap_record_t ap_records[32];
-    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&ap_num, ap_records));
-    
-    ESP_LOGI(TAG_SCAN, "Found %d networks", ap_num);
-
-    // 6. Build JSON
-    size_t offset = 0;
-    offset += snprintf(output + offset, max_len - offset, "[");
+bool wifi_scan_in_progress(void)
+{
+    taskENTER_CRITICAL(&s_lock);
+    bool scanning = s_scanning;
+    taskEXIT_CRITICAL(&s_lock);
+    return scanning;
+}
 
-    for (int i = 0; i < ap_num; i++)
+int32_t wifi_scan_age_s(void)
+{
+    taskENTER_CRITICAL(&s_lock);
+    int64_t time_us = s_results_time_us;
+    taskEXIT_CRITICAL(&s_lock);
+    if (time_us == 0)
     {
-        // Filter out empty SSIDs if necessary
-        if (strlen((char *)ap_records[i].ssid) > 0) {
-            // Check buffer limits to avoid overflow
-            if (max_len - offset < 100) break; 
-
-            offset += snprintf(output + offset, max_len - offset,
-                            "{\"ssid\":\"%s\",\"rssi\":%d,\"auth\":%d}%s",
-                            ap_records[i].ssid,
-                            ap_records[i].rssi,
-                            ap_records[i].authmode,
-                            (i == ap_num - 1) ? "" : ",");
-        }
-    }
-    
-    // Handle trailing comma if the last element was skipped or empty
-    if (output[offset-1] == ',') {
-        offset--; // Move back to overwrite the comma
+        return -1;
     }
+    return (int32_t)((esp_timer_get_time() - time_us) / 1000000);
+}
 
-    offset += snprintf(output + offset, max_len - offset, "]");
+void wifi_scan_write_json(json_writer_t *w)
+{
+    // 1. Take a copy of the cache, so the JSON is written without the lock
+    scan_result_t results[WIFI_SCAN_MAX_RESULTS];
+    taskENTER_CRITICAL(&s_lock);
+    uint16_t count = s_result_count;
+    memcpy(results, s_results, count * sizeof(results[0]));
+    taskEXIT_CRITICAL(&s_lock);
 
-    // 7. Restore Mode (Optional, usually fine to stay in APSTA)
-    // if (current_mode == WIFI_MODE_AP) {
-    //     esp_wifi_set_mode(WIFI_MODE_AP);
-    // }
-}
\ No newline at end of file
+    // 2. Write JSON
+    json_writer_begin_array(w, NULL);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        json_writer_begin_object(w, NULL);
+        json_writer_string(w, "ssid", results[i].ssid);
+        json_writer_int(w, "rssi", results[i].rssi);
+        json_writer_int(w, "auth", results[i].auth);
+        json_writer_end_object(w);
+    }
+    json_writer_end_array(w);
+}
@@ -0,0 +1,760 @@
+"""Subset the UI fonts and drop unused fonts/images from the firmware build.
+
+Scans the firmware sources for the fonts, glyphs and images the UI actually
+uses, then:
+
+  * rewrites each font in main/ui/fonts/ with only the glyphs its labels can
+    show (the clock needs digits and ':', not the whole alphabet),
+  * removes fonts/images nobody references from main/CMakeLists.txt and adds
+    back any that became referenced,
+  * keeps only the LVGL built-in Montserrat sizes that are referenced (plus
+    the default font) in sdkconfig.defaults,
+
+and prints the size of each asset. Unreferenced objects never reach the
+image (the linker drops unused sections), so the flash saving comes from the
+subset fonts; dropping the rest only stops compiling data nobody links.
+
+Glyphs come from the label text in the sources: string literals and printf
+formats passed to lv_label_set_text*() or lv_label_bind_text(), with recolor
+markup removed. Text the scanner cannot see, such as a runtime buffer or a
+label updated by a custom lv_subject_add_observer_obj() callback, needs a hint
+in a comment on the call line or the line above it:
+
+    // glyphs: "MondayTuesday..."
+
+A font shown by a label with unresolved text is left whole. Subsetting works
+on the generated C files themselves, so a font can only shrink; to add glyphs
+that are no longer in the file, regenerate it with lv_font_conv from the TTF
+(the command is in the file header) and run this script again.
+
+Usage (from anywhere in the repository):
+    python tools/assetsubset/subset_assets.py           # report only
+    python tools/assetsubset/subset_assets.py --write   # apply the changes
+    python tools/assetsubset/subset_assets.py --check   # exit 1 if out of date
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parents[2]
+MAIN_DIR = ROOT / "main"
+FONTS_DIR = MAIN_DIR / "ui" / "fonts"
+IMAGES_DIR = MAIN_DIR / "ui" / "images"
+CMAKE_FILE = MAIN_DIR / "CMakeLists.txt"
+SDKCONFIG_DEFAULTS = ROOT / "sdkconfig.defaults"
+LVGL_FONT_DIRS = [
+    ROOT / "managed_components" / "lvgl__lvgl" / "src" / "font",
+]
+
+# Runs of at least this many code points get a direct (FORMAT0) cmap; shorter
+# runs are collected into sparse cmaps
+FORMAT0_MIN_RUN = 8
+
+# sizeof() of the LVGL font structures, used for the flash estimate
+GLYPH_DSC_SIZE = 8
+CMAP_SIZE = 20
+
+FONT_SYMBOL_RE = re.compile(r"^const\s+lv_font_t\s+(\w+)\s*=", re.M)
+IMAGE_SYMBOL_RE = re.compile(r"^const\s+lv_image_dsc_t\s+(\w+)\s*=", re.M)
+IMAGE_DATA_SIZE_RE = re.compile(r"\.data_size\s*=\s*(\d+)")
+BUILTIN_FONT_RE = re.compile(r"\blv_font_montserrat_(\d+)\b")
+SDK_FONT_RE = re.compile(r"^CONFIG_LV_FONT_MONTSERRAT_(\d+)=y\s*$", re.M)
+SDK_DEFAULT_FONT_RE = re.compile(r"^CONFIG_LV_FONT_DEFAULT_MONTSERRAT_(\d+)=y", re.M)
+DEFAULT_FONT_SIZE = 14
+
+DEFINE_RE = re.compile(r"^\s*#\s*define\s+(\w+)(\([^)]*\))?\s*(.*)$")
+DIRECTIVE_RE = re.compile(r"^\s*#\s*(\w+)\s*(.*)$")
+REF_RE = re.compile(r"&\s*(\w+)")
+HINT_RE = re.compile(r"glyphs:\s*\"((?:[^\"\\]|\\.)*)\"")
+
+SET_FONT_RE = re.compile(r"lv_obj_set_style_text_font\s*\(\s*(\w+)\s*,\s*&\s*(\w+)")
+STYLE_FONT_RE = re.compile(r"lv_style_set_text_font\s*\(\s*&\s*(\w+)\s*,\s*&\s*(\w+)")
+ADD_STYLE_RE = re.compile(r"lv_obj_add_style\s*\(\s*(\w+)\s*,\s*&\s*(\w+)")
+RECOLOR_RE = re.compile(r"lv_label_set_recolor\s*\(\s*(\w+)\s*,\s*true")
+SET_TEXT_RE = re.compile(r"lv_label_set_text(_fmt|_static)?\s*\(\s*(\w+)\s*,\s*")
+BIND_TEXT_RE = re.compile(r"lv_label_bind_text\s*\(\s*(\w+)\s*,\s*&?\s*\w+\s*,\s*")
+OBSERVER_RE = re.compile(r"lv_subject_add_observer_obj\s*\(\s*&?\s*\w+\s*,\s*\w+\s*,\s*(\w+)\s*,")
+STRING_RE = re.compile(r"\"((?:[^\"\\\n]|\\.)*)\"\s*")
+FORMAT_RE = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(?:hh|h|ll|l|z|j|t|L)?([diouxXfFeEgGcsp%])")
+
+DIGITS = set("0123456789")
+
+
+class Unknown(Exception):
+    """A preprocessor condition that cannot be evaluated from the sources."""
+
+
+# --- Source scanning -------------------------------------------------------
+
+
+def strip_comments(text):
+    """Blank out comments, keeping string literals and line numbers intact."""
+    out = []
+    i, n = 0, len(text)
+    while i < n:
+        c = text[i]
+        if c in "\"'":
+            j = i + 1
+            while j < n and text[j] != c and text[j] != "\n":
+                j += 2 if text[j] == "\\" else 1
+            out.append(text[i:j + 1])
+            i = j + 1
+        elif text.startswith("//", i):
+            j = text.find("\n", i)
+            j = n if j < 0 else j
+            out.append(" " * (j - i))
+            i = j
+        elif text.startswith("/*", i):
+            j = text.find("*/", i + 2)
+            j = n if j < 0 else j + 2
+            out.append(re.sub(r"[^\n]", " ", text[i:j]))
+            i = j
+        else:
+            out.append(c)
+            i += 1
+    return "".join(out)
+
+
+def eval_condition(expr, defines):
+    """Evaluate a #if expression; raise Unknown if it depends on unknown macros."""
+    def defined(match):
+        name = match.group(1)
+        if name in defines:
+            return "1"
+        raise Unknown(name)
+
+    expr = re.sub(r"\bdefined\s*\(?\s*(\w+)\s*\)?", defined, expr)
+
+    def substitute(match):
+        token = match.group(0)
+        if token[0].isdigit():
+            return re.sub(r"[uUlL]+$", "", token)
+        value = defines.get(token)
+        if value is None or not re.fullmatch(r"\(?-?(0[xX][0-9a-fA-F]+|\d+)[uUlL]*\)?", value):
+            raise Unknown(token)
+        return re.sub(r"[uUlL]+", "", value)
+
+    expr = re.sub(r"\b(0[xX][0-9a-fA-F]+|\d+)[uUlL]*\b|\b[A-Za-z_]\w*\b", substitute, expr)
+    expr = expr.replace("&&", " and ").replace("||", " or ")
+    expr = re.sub(r"!(?!=)", " not ", expr)
+    try:
+        return bool(eval(expr, {"__builtins__": {}}))
+    except Exception as exc:
+        raise Unknown(expr) from exc
+
+
+def active_text(text, defines):
+    """Blank out lines in #if branches that are known to be inactive.
+
+    Branches whose condition cannot be evaluated stay in, so the scan errs on
+    the side of keeping assets.
+    """
+    lines = text.split("\n")
+    stack = []  # per #if level: [state of this branch, some branch was true, some was unknown]
+    for idx, line in enumerate(lines):
+        m = DIRECTIVE_RE.match(line)
+        directive = m.group(1) if m else None
+        if directive in ("if", "ifdef", "ifndef", "elif", "else", "endif"):
+            arg = m.group(2).strip()
+            if directive in ("if", "ifdef", "ifndef"):
+                try:
+                    if directive == "if":
+                        state = eval_condition(arg, defines)
+                    else:
+                        state = (arg in defines) == (directive == "ifdef")
+                        if arg not in defines and arg.startswith("CONFIG_"):
+                            raise Unknown(arg)
+                except Unknown:
+                    state = None
+                stack.append([state, state is True, state is None])
+            elif stack:
+                level = stack[-1]
+                if level[1]:
+                    state = False
+                elif directive == "else":
+                    state = None if level[2] else True
+                else:
+                    try:
+                        state = eval_condition(arg, defines)
+                    except Unknown:
+                        state = None
+                    if level[2] and state is True:
+                        state = None
+                if directive == "endif":
+                    stack.pop()
+                    continue
+                level[0] = state
+                level[1] |= state is True
+                level[2] |= state is None
+            continue
+        if any(level[0] is False for level in stack):
+            lines[idx] = ""
+    return "\n".join(lines)
+
+
+def source_files():
+    """Firmware sources that can reference UI assets (not the assets themselves)."""
+    files = []
+    for path in sorted(MAIN_DIR.rglob("*")):
+        if path.suffix not in (".c", ".h"):
+            continue
+        if FONTS_DIR in path.parents or IMAGES_DIR in path.parents:
+            continue
+        files.append(path)
+    return files
+
+
+def collect_defines(files):
+    defines = {}
+    for path in files:
+        for line in strip_comments(path.read_text(encoding="utf-8")).split("\n"):
+            m = DEFINE_RE.match(line)
+            if m and not m.group(2):
+                defines.setdefault(m.group(1), m.group(3).strip())
+    if SDKCONFIG_DEFAULTS.exists():
+        for m in re.finditer(r"^(CONFIG_\w+)=y\s*$", SDKCONFIG_DEFAULTS.read_text(), re.M):
+            defines.setdefault(m.group(1), "1")
+    return defines
+
+
+def decode_c_string(body):
+    def unescape(match):
+        esc = match.group(1)
+        simple = {"n": "\n", "t": "\t", "r": "\r", "\\": "\\", "\"": "\"", "'": "'", "0": "\0"}
+        if esc in simple:
+            return simple[esc]
+        if esc[0] == "x":
+            return chr(int(esc[1:], 16))
+        if esc[0] == "u":
+            return chr(int(esc[1:], 16))
+        return esc
+
+    return re.sub(r"\\(x[0-9a-fA-F]{1,2}|u[0-9a-fA-F]{4}|.)", unescape, body)
+
+
+def format_glyphs(text):
+    """Characters a printf format can produce, or None for %s/%c/%p."""
+    chars = set()
+    pos = 0
+    for m in FORMAT_RE.finditer(text):
+        chars.update(text[pos:m.start()])
+        pos = m.end()
+        flags, width, _, conv = m.groups()
+        if conv == "%":
+            chars.add("%")
+            continue
+        if conv in "csp":
+            return None
+        if width and "0" not in flags and "-" not in flags:
+            chars.add(" ")
+        if "+" in flags:
+            chars.add("+")
+        if " " in flags:
+            chars.add(" ")
+        if conv in "di":
+            chars |= DIGITS | {"-"}
+        elif conv == "u":
+            chars |= DIGITS
+        elif conv == "o":
+            chars |= set("01234567")
+        elif conv in "xX":
+            chars |= DIGITS | set("abcdef" if conv == "x" else "ABCDEF")
+        else:
+            chars |= DIGITS | {"-", "."}
+            if conv in "eEgG":
+                chars |= {conv.lower() if conv in "eg" else conv.upper(), "+"}
+    chars.update(text[pos:])
+    return chars
+
+
+def strip_recolor(text):
+    """Drop LVGL recolor markup: '#RRGGBB text#' shows only 'text'."""
+    return re.sub(r"#[^#\s]*\s", "", text).replace("#", "")
+
+
+class UiScan:
+    """Fonts, glyphs and images referenced by the firmware sources."""
+
+    def __init__(self, font_symbols, image_symbols):
+        self.font_symbols = font_symbols
+        self.image_symbols = image_symbols
+        self.fonts = set()
+        self.images = set()
+        self.builtin_fonts = set()
+        self.glyphs = {}  # font -> set of characters, or None when unresolved
+        self.unresolved = {}  # font -> first "file:line" with unresolved text
+
+    def run(self):
+        files = source_files()
+        defines = collect_defines(files)
+        sources = []
+        for path in files:
+            raw = path.read_text(encoding="utf-8")
+            code = active_text(strip_comments(raw), defines)
+            sources.append((path, raw.split("\n"), code))
+
+        macros = self._collect_macros(sources)
+        obj_fonts, recolor, texts = {}, set(), []
+        style_fonts, obj_styles = {}, []
+
+        for path, raw_lines, code in sources:
+            for m in REF_RE.finditer(code):
+                self._reference(m.group(1))
+            for m in BUILTIN_FONT_RE.finditer(code):
+                self.builtin_fonts.add(int(m.group(1)))
+            for name, (param, tokens) in macros.items():
+                for m in re.finditer(r"\b%s\s*\(\s*(\w+)\s*\)" % name, code):
+                    for token in tokens:
+                        self._reference(token.replace(param, m.group(1)).replace("##", ""))
+
+            for m in SET_FONT_RE.finditer(code):
+                obj_fonts.setdefault(m.group(1), set()).add(m.group(2))
+            for m in STYLE_FONT_RE.finditer(code):
+                style_fonts.setdefault(m.group(1), set()).add(m.group(2))
+            for m in ADD_STYLE_RE.finditer(code):
+                obj_styles.append((m.group(1), m.group(2)))
+            for m in RECOLOR_RE.finditer(code):
+                recolor.add(m.group(1))
+            for m in SET_TEXT_RE.finditer(code):
+                line = code.count("\n", 0, m.start())
+                texts.append((m.group(2), m.group(1) == "_fmt", self._literal(code, m.end()),
+                              self._hint(raw_lines, line), "%s:%d" % (path.relative_to(ROOT), line + 1)))
+            # Labels bound to a subject: the bind format, or a hint for a custom observer
+            for m in BIND_TEXT_RE.finditer(code):
+                line = code.count("\n", 0, m.start())
+                texts.append((m.group(1), True, self._literal(code, m.end()),
+                              self._hint(raw_lines, line), "%s:%d" % (path.relative_to(ROOT), line + 1)))
+            for m in OBSERVER_RE.finditer(code):
+                line = code.count("\n", 0, m.start())
+                texts.append((m.group(1), False, None,
+                              self._hint(raw_lines, line), "%s:%d" % (path.relative_to(ROOT), line + 1)))
+
+        for obj, style in obj_styles:
+            obj_fonts.setdefault(obj, set()).update(style_fonts.get(style, ()))
+
+        for obj, is_fmt, literal, hint, where in texts:
+            chars = set() if hint is None else set(hint)
+            if literal is not None:
+                text = strip_recolor(literal) if obj in recolor else literal
+                found = format_glyphs(text) if is_fmt else set(text)
+                if found is None and hint is None:
+                    chars = None
+                elif found is not None:
+                    chars |= found
+            elif hint is None:
+                chars = None
+            for font in obj_fonts.get(obj, ()):
+                self._add_glyphs(font, chars, where)
+
+        # A font applied to something whose text is never set is kept whole
+        for fonts in list(obj_fonts.values()) + list(style_fonts.values()):
+            for font in fonts:
+                if font in self.font_symbols and font not in self.glyphs:
+                    self._add_glyphs(font, None, "no lv_label_set_text*() found")
+
+    def _reference(self, name):
+        if name in self.font_symbols:
+            self.fonts.add(name)
+        elif name in self.image_symbols:
+            self.images.add(name)
+
+    def _add_glyphs(self, font, chars, where):
+        if font not in self.font_symbols:
+            return
+        if chars is None:
+            self.glyphs[font] = None
+            self.unresolved.setdefault(font, where)
+        elif self.glyphs.get(font, set()) is not None:
+            self.glyphs.setdefault(font, set()).update(chars)
+
+    @staticmethod
+    def _collect_macros(sources):
+        """Function-like macros that paste their argument into a symbol name."""
+        macros = {}
+        for _, _, code in sources:
+            for line in code.split("\n"):
+                m = DEFINE_RE.match(line)
+                if not m or not m.group(2) or "##" not in m.group(3):
+                    continue
+                params = [p.strip() for p in m.group(2)[1:-1].split(",")]
+                if len(params) != 1:
+                    continue
+                tokens = re.findall(r"\w*##\w*", m.group(3))
+                macros.setdefault(m.group(1), (params[0], set()))[1].update(tokens)
+        return macros
+
+    @staticmethod
+    def _literal(code, pos):
+        """Adjacent string literals starting at pos, or None if the text is not a literal."""
+        parts = []
+        while True:
+            m = STRING_RE.match(code, pos)
+            if not m:
+                break
+            parts.append(decode_c_string(m.group(1)))
+            pos = m.end()
+        return "".join(parts) if parts else None
+
+    @staticmethod
+    def _hint(raw_lines, line):
+        for idx in (line, line - 1):
+            if 0 <= idx < len(raw_lines):
+                m = HINT_RE.search(raw_lines[idx])
+                if m:
+                    return decode_c_string(m.group(1))
+        return None
+
+
+# --- Font files ------------------------------------------------------------
+
+BITMAP_RE = re.compile(r"(glyph_bitmap\[\][^=]*=\s*\{\n)(.*?)(\n\};)", re.S)
+GLYPH_RE = re.compile(r"/\* U\+([0-9A-F]+) \"(?:[^\"\\]|\\.)*\" \*/")
+DSC_ARRAY_RE = re.compile(r"(glyph_dsc\[\]\s*=\s*\{\n)(.*?)(\n\};)", re.S)
+DSC_RE = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                    r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}")
+CMAP_SECTION_RE = re.compile(r"( \*  CHARACTER MAPPING\n \*-+\*/\n)(.*?)(/\*Collect the unicode lists)", re.S)
+CMAPS_RE = re.compile(r"(cmaps\[\]\s*=\s*\n?\{\n)(.*?)(\n\};)", re.S)
+KERN_SECTION_RE = re.compile(r"/\*-+\n \*    KERNING\n \*-+\*/\n.*?(?=/\*-+\n \*  ALL CUSTOM DATA)", re.S)
+
+
+def array_re(name):
+    return re.compile(r"(%s\[\]\s*=\s*\n?\{\n)(.*?)(\n\};)" % name, re.S)
+
+
+def parse_numbers(body):
+    return [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", strip_comments(body))]
+
+
+def format_numbers(values, fmt=str, per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt(v) for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def glyph_comment(cp):
+    ch = chr(cp)
+    if ch in "\"\\":
+        ch = "\\" + ch
+    return "/* U+%04X \"%s\" */" % (cp, ch)
+
+
+def range_spec(codepoints):
+    """lv_font_conv --range argument for a set of code points."""
+    parts = []
+    for start, end in runs(codepoints):
+        parts.append(str(start) if start == end else "%d-%d" % (start, end))
+    return ",".join(parts)
+
+
+def runs(codepoints):
+    result = []
+    for cp in sorted(codepoints):
+        if result and cp == result[-1][1] + 1:
+            result[-1][1] = cp
+        else:
+            result.append([cp, cp])
+    return [tuple(r) for r in result]
+
+
+class FontFile:
+    """A font generated by lv_font_conv (--format lvgl, uncompressed)."""
+
+    def __init__(self, path):
+        self.path = path
+        self.text = path.read_text(encoding="utf-8")
+
+        body = BITMAP_RE.search(self.text).group(2)
+        marks = list(GLYPH_RE.finditer(body))
+        self.codepoints = [int(m.group(1), 16) for m in marks]
+        self.bitmaps = []
+        for i, m in enumerate(marks):
+            end = marks[i + 1].start() if i + 1 < len(marks) else len(body)
+            self.bitmaps.append([int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body[m.end():end])])
+
+        self.dsc = [tuple(int(v) for v in m.groups())
+                    for m in DSC_RE.finditer(DSC_ARRAY_RE.search(self.text).group(2))]
+        if len(self.dsc) != len(self.codepoints) + 1:
+            raise ValueError("%s: glyph_dsc does not match the bitmap comments" % path.name)
+
+        self.kerning = None
+        if "kern_pair_glyph_ids" in self.text:
+            raise ValueError("%s: pair kerning is not supported, regenerate with class kerning" % path.name)
+        if "kern_left_class_mapping" in self.text:
+            self.kerning = {
+                "left": parse_numbers(array_re("kern_left_class_mapping").search(self.text).group(2)),
+                "right": parse_numbers(array_re("kern_right_class_mapping").search(self.text).group(2)),
+                "values": parse_numbers(array_re("kern_class_values").search(self.text).group(2)),
+                "left_cnt": int(re.search(r"\.left_class_cnt\s*=\s*(\d+)", self.text).group(1)),
+                "right_cnt": int(re.search(r"\.right_class_cnt\s*=\s*(\d+)", self.text).group(1)),
+            }
+
+    def flash_bytes(self, text=None):
+        """Approximate .rodata taken by the font tables."""
+        text = self.text if text is None else text
+        size = len(re.findall(r"0x[0-9a-fA-F]+", BITMAP_RE.search(text).group(2)))
+        size += len(DSC_RE.findall(DSC_ARRAY_RE.search(text).group(2))) * GLYPH_DSC_SIZE
+        size += len(re.findall(r"\.range_start", CMAPS_RE.search(text).group(2))) * CMAP_SIZE
+        for m in re.finditer(r"unicode_list_\d+\[\]\s*=\s*\{(.*?)\};", text, re.S):
+            size += len(parse_numbers(m.group(1))) * 2
+        for name in ("kern_left_class_mapping", "kern_right_class_mapping", "kern_class_values"):
+            m = array_re(name).search(text)
+            if m:
+                size += len(parse_numbers(m.group(2)))
+        return size
+
+    def subset(self, wanted):
+        """Return the file text with only the glyphs in wanted (a set of code points)."""
+        keep = [i for i, cp in enumerate(self.codepoints) if cp in wanted]
+        cps = [self.codepoints[i] for i in keep]
+        text = self.text
+
+        # Bitmaps and descriptors, glyph ids renumbered from 1
+        chunks, dsc, offset = [], [self.dsc[0]], 0
+        for i in keep:
+            data = self.bitmaps[i]
+            chunk = "    " + glyph_comment(self.codepoints[i])
+            if data:
+                chunk += "\n" + format_numbers(data, hex)
+            chunks.append(chunk)
+            dsc.append((offset,) + self.dsc[i + 1][1:])
+            offset += len(data)
+        text = BITMAP_RE.sub(lambda m: m.group(1) + ",\n\n".join(chunks) + m.group(3), text, count=1)
+        text = self._join_empty_glyphs(text)
+
+        dsc_lines = ["    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}" % d
+                     for d in dsc]
+        dsc_lines[0] += " /* id = 0 reserved */"
+        text = DSC_ARRAY_RE.sub(lambda m: m.group(1) + ",\n".join(dsc_lines) + m.group(3), text, count=1)
+
+        # Character mapping: long runs map directly, the rest go in sparse lists
+        segments = []
+        for start, end in runs(cps):
+            if end - start + 1 >= FORMAT0_MIN_RUN or not segments or segments[-1][0] == "range":
+                segments.append(["range" if end - start + 1 >= FORMAT0_MIN_RUN else "sparse", [start, end]])
+            else:
+                segments[-1][1].extend([start, end])
+        lists, cmaps, glyph_id = [], [], 1
+        for kind, bounds in segments:
+            members = [cp for cp in cps if bounds[0] <= cp <= bounds[-1]]
+            start, length = members[0], members[-1] - members[0] + 1
+            if kind == "range" or length == len(members):
+                unicode_list, list_length, cmap_type = "NULL", 0, "FORMAT0_TINY"
+            else:
+                name = "unicode_list_%d" % len(cmaps)
+                lists.append("static const uint16_t %s[] = {\n%s\n};\n"
+                             % (name, format_numbers([cp - start for cp in members], hex)))
+                unicode_list, list_length, cmap_type = name, len(members), "SPARSE_TINY"
+            cmaps.append("    {\n"
+                         "        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                         "        .unicode_list = %s, .glyph_id_ofs_list = NULL, .list_length = %d, "
+                         ".type = LV_FONT_FMT_TXT_CMAP_%s\n"
+                         "    }" % (start, length, glyph_id, unicode_list, list_length, cmap_type))
+            glyph_id += len(members)
+        section = "\n\n\n" if not lists else "\n" + "\n".join(lists) + "\n\n"
+        text = CMAP_SECTION_RE.sub(lambda m: m.group(1) + section + m.group(3), text, count=1)
+        text = CMAPS_RE.sub(lambda m: m.group(1) + ",\n".join(cmaps) + m.group(3), text, count=1)
+        text = re.sub(r"\.cmap_num = \d+", ".cmap_num = %d" % len(cmaps), text, count=1)
+
+        text = self._subset_kerning(text, keep)
+        text = re.sub(r"--range \S+", "--range " + range_spec(cps), text, count=1)
+        return text
+
+    @staticmethod
+    def _join_empty_glyphs(text):
+        # Glyphs without bitmap data (space) are a bare comment, as lv_font_conv writes them
+        return re.sub(r"(/\* U\+[0-9A-F]+ \"(?:[^\"\\]|\\.)*\" \*/),\n", r"\1\n", text)
+
+    def _subset_kerning(self, text, keep):
+        if self.kerning is None:
+            return text
+        k = self.kerning
+        left = [k["left"][i + 1] for i in keep]
+        right = [k["right"][i + 1] for i in keep]
+        left_classes = sorted({c for c in left if c})
+        right_classes = sorted({c for c in right if c})
+        values = [k["values"][(l - 1) * k["right_cnt"] + (r - 1)] for l in left_classes for r in right_classes]
+
+        if not any(values):
+            text = KERN_SECTION_RE.sub("", text, count=1)
+            text = re.sub(r"\.kern_dsc = &kern_classes", ".kern_dsc = NULL", text, count=1)
+            text = re.sub(r"\.kern_scale = \d+", ".kern_scale = 0", text, count=1)
+            return re.sub(r"\.kern_classes = 1", ".kern_classes = 0", text, count=1)
+
+        left_map = {c: i + 1 for i, c in enumerate(left_classes)}
+        right_map = {c: i + 1 for i, c in enumerate(right_classes)}
+        arrays = {
+            "kern_left_class_mapping": [0] + [left_map.get(c, 0) for c in left],
+            "kern_right_class_mapping": [0] + [right_map.get(c, 0) for c in right],
+            "kern_class_values": values,
+        }
+        for name, data in arrays.items():
+            text = array_re(name).sub(lambda m: m.group(1) + format_numbers(data) + m.group(3), text, count=1)
+        text = re.sub(r"(\.left_class_cnt\s*=\s*)\d+", r"\g<1>%d" % len(left_classes), text, count=1)
+        return re.sub(r"(\.right_class_cnt\s*=\s*)\d+", r"\g<1>%d" % len(right_classes), text, count=1)
+
+
+# --- Build files -----------------------------------------------------------
+
+
+def asset_symbol(path, pattern):
+    m = pattern.search(path.read_text(encoding="utf-8"))
+    return m.group(1) if m else None
+
+
+def update_cmake(text, fonts, images):
+    """Rewrite the ui/fonts and ui/images entries of SRCS to the referenced set."""
+    asset_line = re.compile(r"^\s*\"ui/(fonts|images)/(\w+)\.c\"\s*$")
+    lines = text.split("\n")
+    idx = [i for i, line in enumerate(lines) if asset_line.match(line)]
+    if not idx:
+        return text
+    first, last = idx[0], idx[-1]
+    indent = re.match(r"^(\s*)", lines[first]).group(1)
+    listed = {"fonts": [], "images": []}
+    for line in lines[first:last + 1]:
+        m = asset_line.match(line)
+        if m:
+            listed[m.group(1)].append(m.group(2))
+
+    block = []
+    for kind, wanted in (("fonts", fonts), ("images", images)):
+        names = [n for n in listed[kind] if n in wanted] + sorted(set(wanted) - set(listed[kind]))
+        if block and names:
+            block.append("")
+        block.extend('%s"ui/%s/%s.c"' % (indent, kind, n) for n in names)
+    return "\n".join(lines[:first] + block + lines[last + 1:])
+
+
+def update_sdkconfig(text, sizes):
+    """Enable exactly the referenced built-in Montserrat sizes."""
+    out, present, last = [], set(), None
+    for line in text.split("\n"):
+        m = SDK_FONT_RE.match(line)
+        if m:
+            if int(m.group(1)) not in sizes:
+                continue
+            present.add(int(m.group(1)))
+            last = len(out)
+        out.append(line)
+    extra = ["CONFIG_LV_FONT_MONTSERRAT_%d=y" % s for s in sorted(set(sizes) - present)]
+    if last is None:
+        out[-1:-1] = extra
+    else:
+        out[last + 1:last + 1] = extra
+    return "\n".join(out)
+
+
+def builtin_font_bytes(size):
+    for folder in LVGL_FONT_DIRS:
+        path = folder / ("lv_font_montserrat_%d.c" % size)
+        if path.exists():
+            text = path.read_text(encoding="utf-8")
+            m = re.search(r"glyph_bitmap\[\][^=]*=\s*\{(.*?)\};", text, re.S)
+            dsc = len(re.findall(r"\{\.bitmap_index", text))
+            return (len(re.findall(r"0x[0-9a-fA-F]+", m.group(1))) if m else 0) + dsc * GLYPH_DSC_SIZE
+    return None
+
+
+# --- Main ------------------------------------------------------------------
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--write", action="store_true", help="rewrite fonts, CMakeLists.txt and sdkconfig.defaults")
+    parser.add_argument("--check", action="store_true", help="exit with status 1 if anything is out of date")
+    args = parser.parse_args()
+
+    font_files = {asset_symbol(p, FONT_SYMBOL_RE): p for p in sorted(FONTS_DIR.glob("*.c"))}
+    image_files = {asset_symbol(p, IMAGE_SYMBOL_RE): p for p in sorted(IMAGES_DIR.glob("*.c"))}
+    font_files.pop(None, None)
+    image_files.pop(None, None)
+
+    scan = UiScan(set(font_files), set(image_files))
+    scan.run()
+
+    cmake_text = CMAKE_FILE.read_text(encoding="utf-8")
+    compiled = set(re.findall(r"\"ui/(?:fonts|images)/(\w+)\.c\"", cmake_text))
+    changes, errors = {}, []
+    linked_before = linked_after = unlinked = 0
+
+    print("Fonts:")
+    for symbol, path in sorted(font_files.items()):
+        font = FontFile(path)
+        size = font.flash_bytes()
+        was_built = path.stem in compiled
+        if symbol not in scan.fonts:
+            print("  %-26s %7d B  unused%s" % (symbol, size, ", dropped from the build" if was_built else ""))
+            unlinked += size if was_built else 0
+            continue
+        wanted = scan.glyphs.get(symbol)
+        if wanted is None:
+            print("  %-26s %7d B  kept whole (%s)" % (symbol, size, scan.unresolved.get(symbol, "no label found")))
+            new_size = size
+        else:
+            cps = {ord(c) for c in wanted if ord(c) >= 0x20}
+            missing = sorted(cps - set(font.codepoints))
+            if missing:
+                errors.append("%s lacks %s; regenerate it with lv_font_conv --range %s"
+                              % (path.name, "".join(chr(c) for c in missing), range_spec(cps)))
+                new_size = size
+            else:
+                new_text = font.subset(cps)
+                new_size = font.flash_bytes(new_text)
+                if new_text != font.text:
+                    changes[path] = new_text
+                print("  %-26s %7d B -> %6d B  %d glyphs: %s" % (symbol, size, new_size, len(cps),
+                                                               "".join(sorted(chr(c) for c in cps))))
+        linked_before += size
+        linked_after += new_size
+
+    print("Images:")
+    for symbol, path in sorted(image_files.items()):
+        m = IMAGE_DATA_SIZE_RE.search(path.read_text(encoding="utf-8"))
+        size = int(m.group(1)) if m else 0
+        used, built = symbol in scan.images, path.stem in compiled
+        unlinked += size if built and not used else 0
+        if used != built:
+            print("  %-26s %7d B  %s" % (symbol, size, "added to the build" if used else "unused, dropped from the build"))
+
+    sdk_text = SDKCONFIG_DEFAULTS.read_text(encoding="utf-8")
+    default_size = SDK_DEFAULT_FONT_RE.search(sdk_text)
+    sizes = set(scan.builtin_fonts) | {int(default_size.group(1)) if default_size else DEFAULT_FONT_SIZE}
+    print("LVGL built-in fonts:")
+    for size in sorted(set(int(s) for s in SDK_FONT_RE.findall(sdk_text)) | sizes):
+        flash = builtin_font_bytes(size)
+        note = "kept" if size in sizes else "unused, disabled"
+        print("  lv_font_montserrat_%-7d %s  %s" % (size, "%7d B" % flash if flash is not None else "      ? B", note))
+        if flash is not None and size not in sizes:
+            unlinked += flash
+
+    new_cmake = update_cmake(cmake_text, {font_files[s].stem for s in scan.fonts},
+                             {image_files[s].stem for s in scan.images})
+    if new_cmake != cmake_text:
+        changes[CMAKE_FILE] = new_cmake
+    new_sdk = update_sdkconfig(sdk_text, sizes)
+    if new_sdk != sdk_text:
+        changes[SDKCONFIG_DEFAULTS] = new_sdk
+
+    print("Linked font data: %d B -> %d B (%d B of flash saved)"
+          % (linked_before, linked_after, linked_before - linked_after))
+    print("Unreferenced data no longer compiled: %d B" % unlinked)
+    for error in errors:
+        print("error: " + error, file=sys.stderr)
+
+    if args.write:
+        for path, text in changes.items():
+            path.write_text(text, encoding="utf-8")
+            print("Updated %s" % path.relative_to(ROOT))
+    elif changes:
+        print("Out of date: %s" % ", ".join(str(p.relative_to(ROOT)) for p in changes))
+
+    if errors:
+        return 2
+    return 1 if args.check and changes else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,156 @@
+#include <stdbool.h>
+#include <string.h>
+#include "fixtures.h"
+#include "openweather_service.h"
+#include "openweather_internal.h"
+
+static OpenWeatherData s_data;
+static uint32_t s_generation = 0;
+static time_t s_now = 0;
+
+static void set_condition(WeatherCondition *weather, int id, const char *main, const char *icon, WeatherIcon icon_id)
+{
+    weather->id = id;
+    strncpy(weather->main, main, sizeof(weather->main) - 1);
+    strncpy(weather->description, main, sizeof(weather->description) - 1);
+    strncpy(weather->icon, icon, sizeof(weather->icon) - 1);
+    weather->iconId = icon_id;
+}
+
+static void fill_clear_day(OpenWeatherData *data)
+{
+    CurrentWeather *c = &data->current;
+    c->temperature = 21.4f;
+    c->feelsLike = 20.9f;
+    c->atmospheric.pressure = 1018;
+    c->atmospheric.humidity = 48;
+    c->atmospheric.dewPoint = 9.8f;
+    c->atmospheric.uvi = 6.2f;
+    c->wind.speed = 3.1f;
+    c->wind.degree = 135;
+    set_condition(&c->weather, 800, "Clear", "01d", WEATHER_ICON_CLEAR_DAY);
+}
+
+static void fill_rain(OpenWeatherData *data)
+{
+    CurrentWeather *c = &data->current;
+    c->temperature = 14.2f;
+    c->feelsLike = 13.6f;
+    c->atmospheric.pressure = 1006;
+    c->atmospheric.humidity = 87;
+    c->atmospheric.dewPoint = 12.1f;
+    c->atmospheric.uvi = 0.8f;
+    c->wind.speed = 6.4f;
+    c->wind.degree = 250;
+    set_condition(&c->weather, 500, "Rain", "10d", WEATHER_ICON_RAIN_DAY);
+
+    // Dry first quarter, then a ramp up to ~12 mm/h
+    for (int i = 15; i < NUM_MINUTELY; i++)
+    {
+        data->minutely[i].precipitation = 0.25f * (float)(i - 14);
+    }
+}
+
+static void fill_storm_night(OpenWeatherData *data)
+{
+    CurrentWeather *c = &data->current;
+    c->temperature = 36.8f;
+    c->feelsLike = 41.3f;
+    c->atmospheric.pressure = 996;
+    c->atmospheric.humidity = 74;
+    c->atmospheric.dewPoint = 30.9f;
+    c->atmospheric.uvi = 0.0f;
+    c->wind.speed = 17.9f;
+    c->wind.degree = 315;
+    set_condition(&c->weather, 212, "Thunderstorm", "11n", WEATHER_ICON_THUNDERSTORM_NIGHT);
+
+    // Bursts crossing every intensity class
+    static const float bursts[] = {2.0f, 8.0f, 18.0f, 35.0f, 55.0f, 80.0f, 120.0f, 45.0f, 12.0f, 0.0f};
+    for (int i = 0; i < NUM_MINUTELY; i++)
+    {
+        data->minutely[i].precipitation = bursts[i % (sizeof(bursts) / sizeof(bursts[0]))];
+    }
+}
+
+void fixture_select(fixture_id_t id)
+{
+    memset(&s_data, 0, sizeof(s_data));
+
+    switch (id)
+    {
+    case FIXTURE_RAIN:
+        fill_rain(&s_data);
+        break;
+    case FIXTURE_STORM_NIGHT:
+        fill_storm_night(&s_data);
+        break;
+    case FIXTURE_CLEAR_DAY:
+    default:
+        fill_clear_day(&s_data);
+        break;
+    }
+
+    for (int i = 0; i < NUM_MINUTELY; i++)
+    {
+        s_data.minutely[i].timestamp = (int)s_now + i * 60;
+    }
+
+    // Same preparation as a real refresh in openweather_client.c
+    preprocessMinutelyPrecipitation(s_data.minutely, &s_data.minutelyDisplay);
+    s_generation++;
+}
+
+const char *fixture_name(fixture_id_t id)
+{
+    static const char *const names[FIXTURE_COUNT] = {
+        [FIXTURE_CLEAR_DAY] = "clear_day",
+        [FIXTURE_RAIN] = "rain",
+        [FIXTURE_STORM_NIGHT] = "storm_night",
+    };
+    return id < FIXTURE_COUNT ? names[id] : "unknown";
+}
+
+void fixture_set_time(time_t t)
+{
+    s_now = t;
+}
+
+time_t fixture_get_time(void)
+{
+    return s_now;
+}
+
+// time() used by ui_clock.c, redirected with -Wl,--wrap=time
+time_t __wrap_time(time_t *t)
+{
+    if (t)
+    {
+        *t = s_now;
+    }
+    return s_now;
+}
+
+// --- openweather_service.h, backed by the selected fixture ---
+
+// openweather_lock()/openweather_unlock() are left to the harness that links
+// this file: host_render is single-threaded, web_bench_server is not
+
+CurrentWeather *openweather_get_current_data()
+{
+    return s_generation ? &s_data.current : NULL;
+}
+
+const OpenWeatherData *openweather_get_data()
+{
+    return &s_data;
+}
+
+uint32_t openweather_get_generation()
+{
+    return s_generation;
+}
+
+const MinutelyPrecipitationDisplay *openweather_get_minutely_display()
+{
+    return &s_data.minutelyDisplay;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <time.h>
+#include "typedefs.h"
+
+// Weather snapshots the screens are rendered with
+typedef enum
+{
+    FIXTURE_CLEAR_DAY = 0, // Mild and dry
+    FIXTURE_RAIN,          // Light rain building up over the hour
+    FIXTURE_STORM_NIGHT,   // Hot night with extreme precipitation
+    FIXTURE_COUNT
+} fixture_id_t;
+
+/**
+ * @brief Make a fixture the data returned by the openweather_* service functions.
+ *        Each call counts as a new weather refresh.
+ */
+void fixture_select(fixture_id_t id);
+
+const char *fixture_name(fixture_id_t id);
+
+/**
+ * @brief Wall-clock time seen by the UI (time() is wrapped at link time).
+ */
+void fixture_set_time(time_t t);
+time_t fixture_get_time(void);
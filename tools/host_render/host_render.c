@@ -0,0 +1,396 @@
+/**
+ * Headless render harness: draws the firmware screens into a 320x170 RGB565
+ * framebuffer, dumps PNGs, compares pixel hashes with snapshots/ and reports
+ * the render time per frame.
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include "lvgl.h"
+#include "ui.h"
+#include "ui_internal.h"
+#include "fixtures.h"
+#include "openweather_service.h"
+#include "png_writer.h"
+
+#define HOR_RES 320
+#define VER_RES 170
+
+// Saturday 2025-06-14 13:37:42 UTC: two-digit fields everywhere
+#define FIXTURE_EPOCH 1749908262
+
+#ifndef HOST_RENDER_SNAPSHOT_DIR
+#define HOST_RENDER_SNAPSHOT_DIR "snapshots"
+#endif
+
+typedef struct
+{
+    const char *name;
+    void (*show)(void);
+    bool ticks; // Screen changes every second (clock)
+} scenario_t;
+
+typedef struct
+{
+    double avg_us;
+    double min_us;
+    double max_us;
+} timing_t;
+
+static uint16_t s_framebuffer[HOR_RES * VER_RES] __attribute__((aligned(64)));
+static lv_display_t *s_disp = NULL;
+static lv_obj_t *s_boot_screen = NULL;
+static uint32_t s_tick_ms = 0;
+
+// --- openweather_service.h: the scenarios and fixtures share one thread ---
+
+bool openweather_lock(int timeout)
+{
+    (void)timeout;
+    return true;
+}
+
+void openweather_unlock()
+{
+}
+
+// --- Scenarios ---
+
+static void show_boot(void)
+{
+    lv_screen_load(s_boot_screen);
+}
+
+static void show_connecting(void)
+{
+    show_connecting_message("HomeNetwork-5G");
+}
+
+static void show_ap_qr(void)
+{
+    show_AP_qrcode("Weather", "k3Xa9QmZ2pLw");
+}
+
+static void show_config_qr(void)
+{
+    show_config_qrcode("http://192.168.4.1/c");
+}
+
+static void show_clock_fixture(fixture_id_t id)
+{
+    fixture_select(id);
+    setup_clock_screen();
+    tick_clock();
+}
+
+static void show_clock_clear_day(void)
+{
+    show_clock_fixture(FIXTURE_CLEAR_DAY);
+}
+
+static void show_clock_rain(void)
+{
+    show_clock_fixture(FIXTURE_RAIN);
+}
+
+static void show_clock_storm_night(void)
+{
+    show_clock_fixture(FIXTURE_STORM_NIGHT);
+}
+
+static const scenario_t scenarios[] = {
+    {"boot", show_boot, false},
+    {"connecting", show_connecting, false},
+    {"qr_ap", show_ap_qr, false},
+    {"qr_config", show_config_qr, false},
+    {"clock_clear_day", show_clock_clear_day, true},
+    {"clock_rain", show_clock_rain, true},
+    {"clock_storm_night", show_clock_storm_night, true},
+};
+
+// --- LVGL display ---
+
+static uint32_t tick_cb(void)
+{
+    return s_tick_ms;
+}
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    // Direct mode: LVGL already rendered into s_framebuffer
+    (void)area;
+    (void)px_map;
+    lv_display_flush_ready(disp);
+}
+
+static void display_init(void)
+{
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+
+    s_disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(s_disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(s_disp, s_framebuffer, NULL, sizeof(s_framebuffer), LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_flush_cb(s_disp, flush_cb);
+}
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static double render_frame(void)
+{
+    double start = now_us();
+    lv_refr_now(s_disp);
+    return now_us() - start;
+}
+
+// Full-screen redraws of the current screen
+static timing_t time_full_frames(int frames)
+{
+    timing_t t = {0, 1e12, 0};
+    for (int i = 0; i < frames; i++)
+    {
+        lv_obj_invalidate(lv_screen_active());
+        double us = render_frame();
+        t.avg_us += us;
+        t.min_us = us < t.min_us ? us : t.min_us;
+        t.max_us = us > t.max_us ? us : t.max_us;
+    }
+    t.avg_us /= frames;
+    return t;
+}
+
+// The once-per-second update the clock screen does on the device
+static timing_t time_clock_ticks(int frames)
+{
+    timing_t t = {0, 1e12, 0};
+    time_t start = fixture_get_time();
+    for (int i = 0; i < frames; i++)
+    {
+        fixture_set_time(start + i + 1);
+        s_tick_ms += 1000;
+        tick_clock();
+        double us = render_frame();
+        t.avg_us += us;
+        t.min_us = us < t.min_us ? us : t.min_us;
+        t.max_us = us > t.max_us ? us : t.max_us;
+    }
+    t.avg_us /= frames;
+    fixture_set_time(start);
+    return t;
+}
+
+// --- Snapshots ---
+
+static uint64_t framebuffer_hash(void)
+{
+    // FNV-1a 64
+    const uint8_t *p = (const uint8_t *)s_framebuffer;
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < sizeof(s_framebuffer); i++)
+    {
+        h ^= p[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+static bool read_snapshot(const char *dir, const char *name, uint64_t *hash)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.hash", dir, name);
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+    {
+        return false;
+    }
+    unsigned long long value = 0;
+    bool ok = fscanf(f, "%llx", &value) == 1;
+    fclose(f);
+    *hash = value;
+    return ok;
+}
+
+static bool write_snapshot(const char *dir, const char *name, uint64_t hash)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.hash", dir, name);
+    FILE *f = fopen(path, "w");
+    if (f == NULL)
+    {
+        return false;
+    }
+    fprintf(f, "%016llx\n", (unsigned long long)hash);
+    return fclose(f) == 0;
+}
+
+static void make_dir(const char *dir)
+{
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST)
+    {
+        fprintf(stderr, "Cannot create %s: %s\n", dir, strerror(errno));
+        exit(2);
+    }
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [--out DIR] [--snapshots DIR] [--update] [--frames N] [scenario...]\n", prog);
+    printf("  --out DIR        write <scenario>.png into DIR\n");
+    printf("  --snapshots DIR  pixel hash directory (default: %s)\n", HOST_RENDER_SNAPSHOT_DIR);
+    printf("  --update         rewrite the snapshot hashes instead of comparing\n");
+    printf("  --frames N       frames per timing measurement (default: 50)\n");
+    printf("Scenarios:");
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+    {
+        printf(" %s", scenarios[i].name);
+    }
+    printf("\n");
+}
+
+static bool is_selected(const char *name, int argc, char **argv, int first)
+{
+    if (first >= argc)
+    {
+        return true;
+    }
+    for (int i = first; i < argc; i++)
+    {
+        if (strcmp(argv[i], name) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_dir = NULL;
+    const char *snapshot_dir = HOST_RENDER_SNAPSHOT_DIR;
+    bool update = false;
+    int frames = 50;
+
+    int arg = 1;
+    for (; arg < argc && strncmp(argv[arg], "--", 2) == 0; arg++)
+    {
+        if (strcmp(argv[arg], "--out") == 0 && arg + 1 < argc)
+        {
+            out_dir = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "--snapshots") == 0 && arg + 1 < argc)
+        {
+            snapshot_dir = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "--update") == 0)
+        {
+            update = true;
+        }
+        else if (strcmp(argv[arg], "--frames") == 0 && arg + 1 < argc)
+        {
+            frames = atoi(argv[++arg]);
+            frames = frames > 0 ? frames : 1;
+        }
+        else
+        {
+            usage(argv[0]);
+            return strcmp(argv[arg], "--help") == 0 ? 0 : 2;
+        }
+    }
+
+    // Fixed clock so the time labels (and hashes) are reproducible
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    fixture_set_time(FIXTURE_EPOCH);
+
+    display_init();
+    ui_init();
+    s_boot_screen = lv_screen_active();
+
+    if (out_dir)
+    {
+        make_dir(out_dir);
+    }
+    if (update)
+    {
+        make_dir(snapshot_dir);
+    }
+
+    int changed = 0;
+    int missing = 0;
+    printf("%-18s %-16s %-8s %10s %10s %10s %10s\n", "scenario", "hash", "snapshot", "full avg", "full min", "full max", "tick avg");
+
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+    {
+        const scenario_t *sc = &scenarios[i];
+        if (!is_selected(sc->name, argc, argv, arg))
+        {
+            continue;
+        }
+
+        sc->show();
+        lv_obj_invalidate(lv_screen_active());
+        render_frame();
+
+        uint64_t hash = framebuffer_hash();
+        const char *status;
+        uint64_t expected;
+        if (update)
+        {
+            status = write_snapshot(snapshot_dir, sc->name, hash) ? "written" : "ERROR";
+        }
+        else if (!read_snapshot(snapshot_dir, sc->name, &expected))
+        {
+            status = "MISSING";
+            missing++;
+        }
+        else if (expected == hash)
+        {
+            status = "ok";
+        }
+        else
+        {
+            status = "CHANGED";
+            changed++;
+        }
+
+        if (out_dir)
+        {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/%s.png", out_dir, sc->name);
+            if (!png_write_rgb565(path, s_framebuffer, HOR_RES, VER_RES))
+            {
+                fprintf(stderr, "Cannot write %s\n", path);
+            }
+        }
+
+        timing_t full = time_full_frames(frames);
+        char tick_avg[16] = "-";
+        if (sc->ticks)
+        {
+            timing_t tick = time_clock_ticks(frames);
+            snprintf(tick_avg, sizeof(tick_avg), "%.0f us", tick.avg_us);
+        }
+
+        printf("%-18s %016llx %-8s %7.0f us %7.0f us %7.0f us %10s\n", sc->name, (unsigned long long)hash, status,
+               full.avg_us, full.min_us, full.max_us, tick_avg);
+    }
+
+    if (missing)
+    {
+        printf("%d scenario(s) have no snapshot in %s (record them with --update and commit them)\n", missing,
+               snapshot_dir);
+    }
+    if (changed)
+    {
+        printf("%d scenario(s) differ from %s (inspect with --out, accept with --update)\n", changed, snapshot_dir);
+    }
+    return changed || missing ? 1 : 0;
+}
@@ -0,0 +1,35 @@
+/**
+ * LVGL configuration for the host render harness.
+ * Mirrors the LVGL settings in sdkconfig.defaults so frames match the device.
+ */
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH 16
+
+#define LV_USE_STDLIB_MALLOC  LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING  LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF LV_STDLIB_CLIB
+
+#define LV_USE_OS LV_OS_NONE
+#define LV_DEF_REFR_PERIOD 10
+#define LV_DRAW_SW_DRAW_UNIT_CNT 1
+
+#define LV_USE_FLOAT 1
+#define LV_USE_MATRIX 1
+#define LV_USE_OBSERVER 1
+
+#define LV_USE_QRCODE 1
+#define LV_USE_CHART 0
+
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_USE_FONT_COMPRESSED 1
+
+#define LV_USE_LOG 1
+#define LV_LOG_LEVEL LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF 1
+
+#define LV_USE_PERF_MONITOR 0
+#define LV_USE_SYSMON 0
+
+#endif /*LV_CONF_H*/
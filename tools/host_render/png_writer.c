@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "png_writer.h"
+
+// Deflate "stored" blocks hold at most 65535 bytes
+#define STORED_BLOCK_MAX 65535
+
+static uint32_t crc_table[256];
+
+static void crc_init(void)
+{
+    for (uint32_t n = 0; n < 256; n++)
+    {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++)
+        {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        crc = crc_table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void write_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t header[8];
+    put_u32(header, len);
+    memcpy(header + 4, type, 4);
+    fwrite(header, 1, 8, f);
+    if (len > 0)
+    {
+        fwrite(data, 1, len, f);
+    }
+
+    uint32_t crc = crc_update(0xFFFFFFFFu, (const uint8_t *)type, 4);
+    crc = crc_update(crc, data, len) ^ 0xFFFFFFFFu;
+    uint8_t trailer[4];
+    put_u32(trailer, crc);
+    fwrite(trailer, 1, 4, f);
+}
+
+bool png_write_rgb565(const char *path, const uint16_t *pixels, int width, int height)
+{
+    crc_init();
+
+    // Raw scanlines: filter byte 0 followed by RGB888
+    size_t row_bytes = 1 + (size_t)width * 3;
+    size_t raw_len = row_bytes * height;
+    uint8_t *raw = malloc(raw_len);
+    if (raw == NULL)
+    {
+        return false;
+    }
+    for (int y = 0; y < height; y++)
+    {
+        uint8_t *row = raw + y * row_bytes;
+        row[0] = 0;
+        for (int x = 0; x < width; x++)
+        {
+            uint16_t c = pixels[y * width + x];
+            uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+            row[1 + x * 3] = (uint8_t)((r << 3) | (r >> 2));
+            row[2 + x * 3] = (uint8_t)((g << 2) | (g >> 4));
+            row[3 + x * 3] = (uint8_t)((b << 3) | (b >> 2));
+        }
+    }
+
+    // zlib stream of stored blocks
+    size_t blocks = (raw_len + STORED_BLOCK_MAX - 1) / STORED_BLOCK_MAX;
+    size_t z_len = 2 + raw_len + blocks * 5 + 4;
+    uint8_t *z = malloc(z_len);
+    if (z == NULL)
+    {
+        free(raw);
+        return false;
+    }
+
+    size_t o = 0;
+    z[o++] = 0x78;
+    z[o++] = 0x01;
+    uint32_t a = 1, b = 0;
+    for (size_t pos = 0; pos < raw_len; pos += STORED_BLOCK_MAX)
+    {
+        size_t n = raw_len - pos < STORED_BLOCK_MAX ? raw_len - pos : STORED_BLOCK_MAX;
+        z[o++] = (pos + n == raw_len) ? 1 : 0;
+        z[o++] = (uint8_t)n;
+        z[o++] = (uint8_t)(n >> 8);
+        z[o++] = (uint8_t)~n;
+        z[o++] = (uint8_t)(~n >> 8);
+        memcpy(z + o, raw + pos, n);
+        o += n;
+        for (size_t i = 0; i < n; i++)
+        {
+            a = (a + raw[pos + i]) % 65521;
+            b = (b + a) % 65521;
+        }
+    }
+    put_u32(z + o, (b << 16) | a);
+    o += 4;
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        free(raw);
+        free(z);
+        return false;
+    }
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(signature, 1, sizeof(signature), f);
+
+    uint8_t ihdr[13];
+    put_u32(ihdr, (uint32_t)width);
+    put_u32(ihdr + 4, (uint32_t)height);
+    ihdr[8] = 8;  // bit depth
+    ihdr[9] = 2;  // colour type: RGB
+    ihdr[10] = 0; // deflate
+    ihdr[11] = 0; // adaptive filtering
+    ihdr[12] = 0; // no interlace
+    write_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+    write_chunk(f, "IDAT", z, (uint32_t)o);
+    write_chunk(f, "IEND", NULL, 0);
+
+    bool ok = fclose(f) == 0;
+    free(raw);
+    free(z);
+    return ok;
+}
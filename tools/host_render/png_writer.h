@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Write an RGB565 framebuffer as an 8-bit RGB PNG (uncompressed deflate).
+ * @return true on success
+ */
+bool png_write_rgb565(const char *path, const uint16_t *pixels, int width, int height);
@@ -0,0 +1,4 @@
+#pragma once
+
+// Only needed for the parser prototypes in openweather_internal.h
+typedef struct cJSON cJSON;
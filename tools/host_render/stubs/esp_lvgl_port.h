@@ -0,0 +1,16 @@
+#pragma once
+
+// Host stand-in for esp_lvgl_port: the harness drives LVGL from one thread
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+static inline bool lvgl_port_lock(uint32_t timeout_ms)
+{
+    (void)timeout_ms;
+    return true;
+}
+
+static inline void lvgl_port_unlock(void)
+{
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+// The harness calls the screen functions directly, so the UI queue stays empty
+typedef void *QueueHandle_t;
+
+static inline QueueHandle_t xQueueCreate(size_t length, size_t item_size)
+{
+    (void)length;
+    (void)item_size;
+    return NULL;
+}
+
+static inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    (void)queue;
+    (void)item;
+    (void)ticks;
+    return pdFALSE;
+}
+
+static inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    (void)queue;
+    (void)item;
+    (void)ticks;
+    return pdFALSE;
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// Firmware defaults from main/Kconfig.projbuild
+#define CONFIG_WEATHER_PRECIP_SCALE_SQRT 1
+#define CONFIG_WEATHER_PRECIP_FULL_SCALE_MM_H 60
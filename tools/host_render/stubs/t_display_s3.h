@@ -0,0 +1,12 @@
+#pragma once
+
+// Panel orientation is a hardware setting; the host framebuffer ignores it
+typedef enum {
+    LCD_ROTATION_0 = 0,
+    LCD_ROTATION_180 = 180,
+} lcd_rotation_t;
+
+static inline void lcd_set_rotation(lcd_rotation_t rotation)
+{
+    (void)rotation;
+}
@@ -6,26 +6,34 @@ from pathlib import Path
 import cairosvg
 from PIL import Image
 
+from opaque_icons import blend_to_rgb565, parse_color, render_opaque_c
+
 BASE_PATH = "https://github.com/basmilius/weather-icons/blob/dev/production/fill/svg-static/"
 
 WEATHER_ICON_SIZE=60
 
+# Must match WEATHER_ICON_BG_COLOR in main/ui/weather_utils.h. Entries with a
+# "background" key also get an opaque RGB565 <name>_opaque.c pre-blended on it.
+WEATHER_ICON_BACKGROUND = "0x00008B"
+# Set when the display path expects pre-swapped RGB565 (LVGL swap_bytes off).
+OPAQUE_SWAP_BYTES = False
+
 # Each entry includes a target render size for the final LVGL image.
 FILES = [
-    {"source": "clear-day.svg", "destination": "weather_01d.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "clear-night.svg", "destination": "weather_01n.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "partly-cloudy-day.svg", "destination": "weather_02d.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "partly-cloudy-night.svg", "destination": "weather_02n.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "cloudy.svg", "destination": "weather_03.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "overcast.svg", "destination": "weather_04.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "rain.svg", "destination": "weather_09.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "partly-cloudy-day-rain.svg", "destination": "weather_10d.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "partly-cloudy-night-rain.svg", "destination": "weather_10n.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "thunderstorms-day.svg", "destination": "weather_11d.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "thunderstorms-night.svg", "destination": "weather_11n.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "snow.svg", "destination": "weather_13.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "mist.svg", "destination": "weather_50.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
-    {"source": "not-available.svg", "destination": "weather_NA.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
+    {"source": "clear-day.svg", "destination": "weather_01d.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "clear-night.svg", "destination": "weather_01n.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "partly-cloudy-day.svg", "destination": "weather_02d.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "partly-cloudy-night.svg", "destination": "weather_02n.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "cloudy.svg", "destination": "weather_03.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "overcast.svg", "destination": "weather_04.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "rain.svg", "destination": "weather_09.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "partly-cloudy-day-rain.svg", "destination": "weather_10d.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "partly-cloudy-night-rain.svg", "destination": "weather_10n.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "thunderstorms-day.svg", "destination": "weather_11d.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "thunderstorms-night.svg", "destination": "weather_11n.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "snow.svg", "destination": "weather_13.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "mist.svg", "destination": "weather_50.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
+    {"source": "not-available.svg", "destination": "weather_NA.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE, "background": WEATHER_ICON_BACKGROUND},
     {"source": "barometer.svg", "destination": "icon_barometer.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
     {"source": "thermometer.svg", "destination": "icon_thermometer.svg", "width": WEATHER_ICON_SIZE, "height": WEATHER_ICON_SIZE},
     {"source": "clear-day.svg", "destination": "uvi_icon.svg", "width": 16, "height": 16},
@@ -59,7 +67,7 @@ def download_images():
             print(f"Error downloading {source_filename}: {exc}")
 
 
-def generate_c_from_svg(filepath: Path, filename: str, target_width: int, target_height: int):
+def generate_c_from_svg(filepath: Path, filename: str, target_width: int, target_height: int, background=None):
     try:
         svg_bytes = filepath.read_bytes()
 
@@ -117,6 +125,14 @@ def generate_c_from_svg(filepath: Path, filename: str, target_width: int, target
     OUTPUT_C_FOLDER.mkdir(parents=True, exist_ok=True)
     (OUTPUT_C_FOLDER / f"{var_name}.c").write_text(c_content)
 
+    if background:
+        opaque_name = f"{var_name}_opaque"
+        opaque_data = blend_to_rgb565(data, parse_color(background), OPAQUE_SWAP_BYTES)
+        (OUTPUT_C_FOLDER / f"{opaque_name}.c").write_text(
+            render_opaque_c(opaque_name, width, height, opaque_data, filename, parse_color(background), OPAQUE_SWAP_BYTES)
+        )
+        print(f"[OK] {opaque_name}")
+
     print(f"[OK] {var_name}")
     return var_name
 
@@ -144,6 +160,7 @@ def main():
             filename,
             item["width"],
             item["height"],
+            item.get("background"),
         )
         if var_name:
             generated_vars.append(var_name)
@@ -0,0 +1,104 @@
+"""Bake ARGB8888 icons onto a fixed background colour and emit opaque RGB565.
+
+The weather icon sits on a solid tile (see WEATHER_ICON_BG_COLOR in
+main/ui/weather_utils.h). Pre-blending the icon against that colour at build
+time lets LVGL draw it as a plain RGB565 copy instead of alpha-blending every
+pixel at runtime.
+
+Usage (regenerate from the checked-in LVGL C arrays):
+    python opaque_icons.py --background 0x00008B ../../main/ui/images/weather_*.c
+
+The output files are written next to the inputs as <name>_opaque.c unless
+--output is given. Use --swap-bytes only when the display path expects
+pre-swapped (big-endian) RGB565 data, i.e. when LVGL's software swap is off.
+"""
+
+import argparse
+import re
+from pathlib import Path
+
+HEX_BYTE = re.compile(r"0x([0-9a-fA-F]{2})")
+MAP_RE = re.compile(r"_map\[\][^=]*=\s*\{(.*?)\};", re.S)
+SIZE_W_RE = re.compile(r"\.header\.w\s*=\s*(\d+)")
+SIZE_H_RE = re.compile(r"\.header\.h\s*=\s*(\d+)")
+
+
+def parse_color(value: str) -> tuple:
+    value = int(value, 16) if isinstance(value, str) else value
+    return (value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF
+
+
+def blend_to_rgb565(pixels, background, swap_bytes=False) -> bytes:
+    """Blend an iterable of (r, g, b, a) tuples onto background and pack as RGB565."""
+    bg_r, bg_g, bg_b = background
+    out = bytearray()
+    for r, g, b, a in pixels:
+        inv = 255 - a
+        r = (r * a + bg_r * inv + 127) // 255
+        g = (g * a + bg_g * inv + 127) // 255
+        b = (b * a + bg_b * inv + 127) // 255
+        value = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        if swap_bytes:
+            out += bytes(((value >> 8) & 0xFF, value & 0xFF))
+        else:
+            out += bytes((value & 0xFF, (value >> 8) & 0xFF))
+    return bytes(out)
+
+
+def render_opaque_c(var_name, width, height, data, source, background, swap_bytes=False) -> str:
+    stride = width * 2
+    bg_hex = "0x{:02X}{:02X}{:02X}".format(*background)
+    order = "big-endian (pre-swapped)" if swap_bytes else "little-endian"
+
+    c_content = f"""#include \"lvgl.h\"\n#include \"esp_attr.h\"\n\n#ifndef LV_ATTRIBUTE_MEM_ALIGN\n#define LV_ATTRIBUTE_MEM_ALIGN\n#endif\n\n/* Source: {source} | Size: {width}x{height} | Stride: {stride} */\n/* Pre-blended on background {bg_hex} | RGB565 {order} */\n\nconst uint8_t {var_name}_map[] __attribute__((aligned(4))) = {{\n"""
+
+    for i in range(0, len(data), 16):
+        chunk = data[i : i + 16]
+        c_content += "    " + ", ".join(f"0x{byte:02x}" for byte in chunk) + ",\n"
+
+    c_content += "};\n\n"
+
+    c_content += f"""const lv_image_dsc_t {var_name} = {{\n    .header.w = {width},\n    .header.h = {height},\n    .header.cf = LV_COLOR_FORMAT_RGB565,\n    .header.stride = {stride},\n    .data_size = {len(data)},\n    .data = {var_name}_map,\n}};\n"""
+    return c_content
+
+
+def read_argb8888_c(path: Path):
+    """Read an LVGL ARGB8888 C array (BGRA byte order) back into (r, g, b, a) tuples."""
+    text = path.read_text()
+    body = MAP_RE.search(text)
+    width = SIZE_W_RE.search(text)
+    height = SIZE_H_RE.search(text)
+    if not (body and width and height) or "ARGB8888" not in text:
+        raise ValueError(f"{path} is not an ARGB8888 LVGL image")
+
+    raw = [int(h, 16) for h in HEX_BYTE.findall(body.group(1))]
+    pixels = [(raw[i + 2], raw[i + 1], raw[i], raw[i + 3]) for i in range(0, len(raw), 4)]
+    return int(width.group(1)), int(height.group(1)), pixels
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("inputs", nargs="+", type=Path, help="ARGB8888 LVGL image C files")
+    parser.add_argument("--background", required=True, help="background colour, e.g. 0x00008B")
+    parser.add_argument("--swap-bytes", action="store_true", help="emit big-endian RGB565")
+    parser.add_argument("--output", type=Path, help="output folder (defaults to the input folder)")
+    args = parser.parse_args()
+
+    background = parse_color(args.background)
+
+    for path in args.inputs:
+        if path.stem.endswith("_opaque"):
+            continue
+        width, height, pixels = read_argb8888_c(path)
+        var_name = f"{path.stem}_opaque"
+        data = blend_to_rgb565(pixels, background, args.swap_bytes)
+        out_dir = args.output or path.parent
+        out_dir.mkdir(parents=True, exist_ok=True)
+        (out_dir / f"{var_name}.c").write_text(
+            render_opaque_c(var_name, width, height, data, path.name, background, args.swap_bytes)
+        )
+        print(f"[OK] {var_name} ({len(pixels) * 4} -> {len(data)} bytes)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,288 @@
+#define _GNU_SOURCE // strcasestr
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/time.h>
+#include "http_conn.h"
+
+void http_conn_init(http_conn_t *c, const struct sockaddr_storage *addr, socklen_t addr_len,
+                    const char *host, int timeout_ms)
+{
+    memset(c, 0, sizeof(*c));
+    c->addr = *addr;
+    c->addr_len = addr_len;
+    c->host = host;
+    c->timeout_ms = timeout_ms;
+    c->fd = -1;
+}
+
+void http_conn_close(http_conn_t *c)
+{
+    if (c->fd >= 0)
+    {
+        close(c->fd);
+    }
+    c->fd = -1;
+    c->received = 0;
+    c->pos = 0;
+    c->len = 0;
+}
+
+static bool connect_socket(http_conn_t *c)
+{
+    c->fd = socket(c->addr.ss_family, SOCK_STREAM, 0);
+    if (c->fd < 0)
+    {
+        return false;
+    }
+
+    // The send timeout also bounds connect()
+    struct timeval tv = {.tv_sec = c->timeout_ms / 1000, .tv_usec = (c->timeout_ms % 1000) * 1000};
+    setsockopt(c->fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(c->fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    int one = 1;
+    setsockopt(c->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    if (connect(c->fd, (const struct sockaddr *)&c->addr, c->addr_len) != 0)
+    {
+        http_conn_close(c);
+        return false;
+    }
+    return true;
+}
+
+static bool send_all(http_conn_t *c, const char *data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = send(c->fd, data, len, MSG_NOSIGNAL);
+        if (n <= 0)
+        {
+            return false;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+// Receive more data after the unread part. Returns false on close, error or timeout.
+static bool fill(http_conn_t *c)
+{
+    if (c->pos > 0)
+    {
+        memmove(c->buf, c->buf + c->pos, c->len - c->pos);
+        c->len -= c->pos;
+        c->pos = 0;
+    }
+    if (c->len == sizeof(c->buf))
+    {
+        return false; // Line longer than the buffer
+    }
+    ssize_t n = recv(c->fd, c->buf + c->len, sizeof(c->buf) - c->len, 0);
+    if (n <= 0)
+    {
+        return false;
+    }
+    c->len += (size_t)n;
+    c->received += (size_t)n;
+    return true;
+}
+
+// Next CRLF-terminated line, NUL-terminated in place (valid until the next read)
+static char *read_line(http_conn_t *c)
+{
+    while (1)
+    {
+        char *start = c->buf + c->pos;
+        char *end = memchr(start, '\n', c->len - c->pos);
+        if (end)
+        {
+            c->pos = (size_t)(end - c->buf) + 1;
+            if (end > start && end[-1] == '\r')
+            {
+                end--;
+            }
+            *end = '\0';
+            return start;
+        }
+        if (!fill(c))
+        {
+            return NULL;
+        }
+    }
+}
+
+// Consume n body bytes. Returns the bytes consumed.
+static size_t skip(http_conn_t *c, size_t n)
+{
+    size_t done = 0;
+    while (done < n)
+    {
+        if (c->pos == c->len && !fill(c))
+        {
+            break;
+        }
+        size_t take = c->len - c->pos;
+        take = take < n - done ? take : n - done;
+        c->pos += take;
+        done += take;
+    }
+    return done;
+}
+
+static bool read_chunked(http_conn_t *c, size_t *body_bytes)
+{
+    while (1)
+    {
+        char *line = read_line(c);
+        if (line == NULL)
+        {
+            return false;
+        }
+        size_t size = strtoul(line, NULL, 16);
+        if (size == 0)
+        {
+            break;
+        }
+        if (skip(c, size) != size)
+        {
+            return false;
+        }
+        *body_bytes += size;
+        line = read_line(c);
+        if (line == NULL || *line != '\0')
+        {
+            return false;
+        }
+    }
+
+    // Trailers, up to the empty line
+    char *line;
+    while ((line = read_line(c)) != NULL && *line != '\0')
+    {
+    }
+    return line != NULL;
+}
+
+static bool read_response(http_conn_t *c, http_response_t *resp, bool *keep_alive)
+{
+    char *line = read_line(c);
+    if (line == NULL || strncmp(line, "HTTP/1.", 7) != 0 || strlen(line) < 12)
+    {
+        return false;
+    }
+    resp->status = atoi(line + 9);
+
+    long content_length = -1;
+    bool chunked = false;
+    *keep_alive = line[7] == '1';
+    while ((line = read_line(c)) != NULL && *line != '\0')
+    {
+        char *value = strchr(line, ':');
+        if (value == NULL)
+        {
+            continue;
+        }
+        *value++ = '\0';
+        value += strspn(value, " \t");
+
+        if (strcasecmp(line, "Content-Length") == 0)
+            content_length = atol(value);
+        else if (strcasecmp(line, "Transfer-Encoding") == 0)
+            chunked = strcasestr(value, "chunked") != NULL;
+        else if (strcasecmp(line, "Connection") == 0)
+            *keep_alive = strcasestr(value, "close") == NULL && *keep_alive;
+        else if (strcasecmp(line, "ETag") == 0)
+            snprintf(resp->etag, sizeof(resp->etag), "%s", value);
+    }
+    if (line == NULL)
+    {
+        return false;
+    }
+
+    if (resp->status == 304 || resp->status == 204 || resp->status < 200)
+    {
+        return true;
+    }
+    if (chunked)
+    {
+        return read_chunked(c, &resp->body_bytes);
+    }
+    if (content_length >= 0)
+    {
+        resp->body_bytes = skip(c, (size_t)content_length);
+        return resp->body_bytes == (size_t)content_length;
+    }
+
+    // Body delimited by the end of the connection
+    *keep_alive = false;
+    while (c->pos < c->len || fill(c))
+    {
+        resp->body_bytes += c->len - c->pos;
+        c->pos = c->len;
+    }
+    return true;
+}
+
+bool http_conn_get(http_conn_t *c, const char *path, const char *if_none_match, http_response_t *resp)
+{
+    char request[1024];
+    int len;
+    if (if_none_match && *if_none_match)
+    {
+        len = snprintf(request, sizeof(request),
+                       "GET %s HTTP/1.1\r\nHost: %s\r\nAccept: */*\r\nAccept-Encoding: gzip, deflate\r\n"
+                       "If-None-Match: %s\r\nConnection: keep-alive\r\n\r\n",
+                       path, c->host, if_none_match);
+    }
+    else
+    {
+        len = snprintf(request, sizeof(request),
+                       "GET %s HTTP/1.1\r\nHost: %s\r\nAccept: */*\r\nAccept-Encoding: gzip, deflate\r\n"
+                       "Connection: keep-alive\r\n\r\n",
+                       path, c->host);
+    }
+    if (len < 0 || (size_t)len >= sizeof(request))
+    {
+        return false;
+    }
+
+    memset(resp, 0, sizeof(*resp));
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        bool reused = c->fd >= 0;
+        if (!reused && !connect_socket(c))
+        {
+            return false;
+        }
+
+        bool keep_alive = false;
+        size_t before = c->received;
+        bool sent = send_all(c, request, (size_t)len);
+        if (sent && read_response(c, resp, &keep_alive))
+        {
+            if (!keep_alive)
+            {
+                http_conn_close(c);
+            }
+            return true;
+        }
+        bool nothing_received = c->received == before;
+        http_conn_close(c);
+
+        // Like a browser: a kept-alive connection the server closed in the meantime
+        // (idle timeout, LRU purge) is retried once on a new one
+        if (!reused || !nothing_received)
+        {
+            break;
+        }
+        resp->reconnected = true;
+    }
+    resp->status = 0;
+    return false;
+}
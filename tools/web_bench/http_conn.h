@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/socket.h>
+
+// Minimal blocking HTTP/1.1 client connection with keep-alive, enough to replay
+// browser requests: Content-Length, chunked and read-until-close bodies.
+
+#define HTTP_CONN_BUFFER_SIZE 8192
+#define HTTP_ETAG_MAX 64
+
+typedef struct
+{
+    struct sockaddr_storage addr;
+    socklen_t addr_len;
+    const char *host; // Host header
+    int timeout_ms;   // Per send/receive call
+    int fd;           // -1 when not connected
+    size_t received;  // Bytes received on the current connection
+    size_t pos;       // Unread data is buf[pos, len)
+    size_t len;
+    char buf[HTTP_CONN_BUFFER_SIZE];
+} http_conn_t;
+
+typedef struct
+{
+    int status;        // 0 on connection errors
+    size_t body_bytes; // As received (compressed when Content-Encoding is set)
+    bool reconnected;  // A kept-alive connection had been closed by the server; sent again
+    char etag[HTTP_ETAG_MAX];
+} http_response_t;
+
+void http_conn_init(http_conn_t *c, const struct sockaddr_storage *addr, socklen_t addr_len,
+                    const char *host, int timeout_ms);
+
+/**
+ * @brief GET path and read the whole response. if_none_match, when not NULL or empty,
+ *        is sent as If-None-Match. Connects (again) as needed.
+ * @return true when a complete response was received
+ */
+bool http_conn_get(http_conn_t *c, const char *path, const char *if_none_match, http_response_t *resp);
+
+void http_conn_close(http_conn_t *c);
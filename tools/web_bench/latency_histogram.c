@@ -0,0 +1,71 @@
+#include "latency_histogram.h"
+
+// Bucket index: values below 2*SUB map to themselves; above, the value is shifted
+// down until it fits in [SUB, 2*SUB) and the shift picks the group of SUB buckets
+static unsigned bucket_index(uint64_t us)
+{
+    unsigned shift = 0;
+    while ((us >> shift) >= 2 * LATENCY_SUB_BUCKETS)
+    {
+        shift++;
+    }
+    unsigned index = shift * LATENCY_SUB_BUCKETS + (unsigned)(us >> shift);
+    return index < LATENCY_BUCKETS ? index : LATENCY_BUCKETS - 1;
+}
+
+// Middle of the values that land in a bucket
+static uint64_t bucket_value(unsigned index)
+{
+    if (index < 2 * LATENCY_SUB_BUCKETS)
+    {
+        return index;
+    }
+    unsigned shift = index / LATENCY_SUB_BUCKETS - 1;
+    uint64_t low = (uint64_t)(index - shift * LATENCY_SUB_BUCKETS) << shift;
+    return low + ((1ull << shift) >> 1);
+}
+
+void latency_histogram_record(latency_histogram_t *h, uint64_t us)
+{
+    h->buckets[bucket_index(us)]++;
+    h->count++;
+    if (us > h->max_us)
+    {
+        h->max_us = us;
+    }
+}
+
+void latency_histogram_merge(latency_histogram_t *dst, const latency_histogram_t *src)
+{
+    for (unsigned i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        dst->buckets[i] += src->buckets[i];
+    }
+    dst->count += src->count;
+    if (src->max_us > dst->max_us)
+    {
+        dst->max_us = src->max_us;
+    }
+}
+
+uint64_t latency_histogram_percentile(const latency_histogram_t *h, double fraction)
+{
+    if (h->count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t)(fraction * (double)h->count + 0.5);
+    rank = rank < 1 ? 1 : rank;
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        seen += h->buckets[i];
+        if (seen >= rank)
+        {
+            uint64_t value = bucket_value(i);
+            return value < h->max_us ? value : h->max_us;
+        }
+    }
+    return h->max_us;
+}
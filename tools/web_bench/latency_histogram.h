@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdint.h>
+
+// Log-linear latency histogram in microseconds: exact below 64 us, then 32
+// buckets per power of two (about 3% resolution) up to ~35 minutes.
+
+#define LATENCY_SUB_BUCKETS 32
+#define LATENCY_BUCKETS (LATENCY_SUB_BUCKETS * 28)
+
+typedef struct
+{
+    uint64_t count;
+    uint64_t max_us;
+    uint32_t buckets[LATENCY_BUCKETS];
+} latency_histogram_t;
+
+void latency_histogram_record(latency_histogram_t *h, uint64_t us);
+
+/**
+ * @brief Add the samples of src to dst.
+ */
+void latency_histogram_merge(latency_histogram_t *dst, const latency_histogram_t *src);
+
+/**
+ * @brief Latency below which the given fraction of samples fall (0.5 for p50).
+ * @return Microseconds, 0 without samples
+ */
+uint64_t latency_histogram_percentile(const latency_histogram_t *h, double fraction);
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "nvs_storage.h"
+#include "wifi_scan.h"
+#include "frame_profiler.h"
+#include "web_server.h"
+#include "web_events.h"
+#include "ui.h"
+#include "openweather_service.h"
+#include "fixtures.h"
+
+static const char *TAG = "WEB_BENCH_SERVER";
+
+// A new fixture is published this often, like a weather refresh on the device,
+// so /api/weather ETags change and /api/events subscribers get deltas
+#define REFRESH_S 30
+
+// Networks returned by the /api/scan stand-in (a busy apartment block)
+#define FAKE_NETWORKS 24
+
+static time_t s_scan_time = 0;
+static SemaphoreHandle_t s_weather_mutex = NULL;
+
+// --- wifi_scan.h: fixed results, no radio ---
+
+bool wifi_scan_start(void)
+{
+    s_scan_time = time(NULL);
+    return false;
+}
+
+bool wifi_scan_in_progress(void)
+{
+    return false;
+}
+
+int32_t wifi_scan_age_s(void)
+{
+    return (int32_t)(time(NULL) - s_scan_time);
+}
+
+void wifi_scan_write_json(json_writer_t *w)
+{
+    json_writer_begin_array(w, NULL);
+    for (int i = 0; i < FAKE_NETWORKS; i++)
+    {
+        char ssid[33];
+        // A few names that need escaping, as real neighbours pick them
+        if (i % 8 == 3)
+            snprintf(ssid, sizeof(ssid), "Caf\xc3\xa9 \"Guest\" %d", i);
+        else
+            snprintf(ssid, sizeof(ssid), "Network-%02d", i);
+
+        json_writer_begin_object(w, NULL);
+        json_writer_string(w, "ssid", ssid);
+        json_writer_int(w, "rssi", -40 - 2 * i);
+        json_writer_int(w, "auth", i % 4 == 0 ? 0 : 3);
+        json_writer_end_object(w);
+    }
+    json_writer_end_array(w);
+}
+
+// --- openweather_service.h: the fixtures change under HTTP tasks ---
+
+bool openweather_lock(int timeout)
+{
+    if (s_weather_mutex)
+    {
+        return xSemaphoreTake(s_weather_mutex, pdMS_TO_TICKS(timeout));
+    }
+    return false;
+}
+
+void openweather_unlock()
+{
+    if (s_weather_mutex != NULL)
+    {
+        xSemaphoreGive(s_weather_mutex);
+    }
+}
+
+// --- ui.h / frame_profiler.h: no display ---
+
+void ui_set_rotation(uint16_t degrees)
+{
+    ESP_LOGI(TAG, "Display rotation %u ignored", (unsigned)degrees);
+}
+
+void frame_profiler_write_json(json_writer_t *w)
+{
+    json_writer_begin_object(w, NULL);
+    json_writer_int(w, "frames", 0);
+    json_writer_end_object(w);
+}
+
+// Settings a configured device has, so /api/config returns a full document
+static void seed_config(void)
+{
+    char value[64];
+    if (nvs_get_weather_city(value, sizeof(value)))
+    {
+        return;
+    }
+    nvs_set_softap_ssid("WeatherTicker-3F2A");
+    nvs_set_softap_psk("x7Kq9mTz2pLw");
+    nvs_set_wifi_ssid("Home Network");
+    nvs_set_wifi_psk("correct horse battery staple");
+    nvs_set_weather_city("Amsterdam");
+    nvs_set_time_zone("CET-1CEST,M3.5.0,M10.5.0/3");
+    nvs_set_ntp_server("pool.ntp.org");
+    nvs_set_openweather_api_key("0123456789abcdef0123456789abcdef");
+}
+
+void app_main(void)
+{
+    if (!nvs_storage_init())
+    {
+        ESP_LOGE(TAG, "Failed to initialize NVS storage");
+        return;
+    }
+    seed_config();
+
+    s_weather_mutex = xSemaphoreCreateMutex();
+    fixture_set_time(time(NULL));
+    fixture_select(FIXTURE_CLEAR_DAY);
+    wifi_scan_start();
+
+    web_server_init();
+    printf("Serving %s on http://localhost:%d/\n", MOUNT_POINT, HTTP_PORT);
+
+    fixture_id_t fixture = FIXTURE_CLEAR_DAY;
+    while (1)
+    {
+        vTaskDelay(pdMS_TO_TICKS(REFRESH_S * 1000));
+
+        // Switched under the lock, as openweather_client.c publishes a refresh
+        fixture = (fixture + 1) % FIXTURE_COUNT;
+        if (openweather_lock(5000))
+        {
+            fixture_set_time(time(NULL));
+            fixture_select(fixture);
+            openweather_unlock();
+        }
+#if CONFIG_WEATHER_WEB_EVENTS
+        web_events_weather_updated();
+#endif
+    }
+}
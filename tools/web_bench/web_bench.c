@@ -0,0 +1,702 @@
+#define _GNU_SOURCE // rand_r, strtok_r, usleep
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "http_conn.h"
+#include "latency_histogram.h"
+
+#define MAX_ROUTES 128
+#define MAX_PAGES 32
+#define MAX_CONNECTIONS 64
+#define PATH_MAX_LEN 256
+#define PAGE_NAME_LEN 32
+
+// One distinct request path
+typedef struct
+{
+    char path[PATH_MAX_LEN];
+} route_t;
+
+// One page load: the requests a browser makes for it, in order
+typedef struct
+{
+    char name[PAGE_NAME_LEN];
+    unsigned weight; // Relative share of the page loads
+    int routes[MAX_ROUTES];
+    int route_count;
+} page_t;
+
+typedef struct
+{
+    uint64_t ok;        // 2xx and 3xx
+    uint64_t client_errors;
+    uint64_t server_errors;
+    uint64_t io_errors; // Connect, send, receive or parse failures and timeouts
+    uint64_t bytes;
+    latency_histogram_t latency; // Complete responses only
+} route_stats_t;
+
+// One virtual browser on one keep-alive connection
+typedef struct
+{
+    pthread_t thread;
+    unsigned seed;
+    http_conn_t conn;
+    route_stats_t stats[MAX_ROUTES];
+    char etags[MAX_ROUTES][HTTP_ETAG_MAX]; // Last ETag seen per route, for revisits
+    uint64_t page_loads;
+    uint64_t reconnects;
+} client_t;
+
+typedef struct
+{
+    int streams;
+    int open;
+    uint64_t events;
+    uint64_t bytes;
+} events_stats_t;
+
+static route_t s_routes[MAX_ROUTES];
+static int s_route_count = 0;
+static page_t s_pages[MAX_PAGES];
+static int s_page_count = 0;
+static unsigned s_total_weight = 0;
+
+static struct sockaddr_storage s_addr;
+static socklen_t s_addr_len;
+static char s_host[128] = "127.0.0.1:8080";
+static int s_timeout_ms = 5000;
+static int s_revisit_pct = 50;
+static atomic_bool s_stop;
+
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// --- PAGES ---
+
+static int route_index(const char *path)
+{
+    for (int i = 0; i < s_route_count; i++)
+    {
+        if (strcmp(s_routes[i].path, path) == 0)
+        {
+            return i;
+        }
+    }
+    if (s_route_count == MAX_ROUTES || strlen(path) >= PATH_MAX_LEN)
+    {
+        fprintf(stderr, "Skipping %s: too many or too long paths\n", path);
+        return -1;
+    }
+    snprintf(s_routes[s_route_count].path, PATH_MAX_LEN, "%s", path);
+    return s_route_count++;
+}
+
+static page_t *add_page(const char *name, unsigned weight)
+{
+    if (s_page_count == MAX_PAGES)
+    {
+        fprintf(stderr, "Too many pages, ignoring %s\n", name);
+        return NULL;
+    }
+    page_t *page = &s_pages[s_page_count++];
+    memset(page, 0, sizeof(*page));
+    snprintf(page->name, sizeof(page->name), "%s", name);
+    page->weight = weight;
+    return page;
+}
+
+static void add_request(page_t *page, const char *path)
+{
+    int route = route_index(path);
+    if (page && route >= 0 && page->route_count < MAX_ROUTES)
+    {
+        page->routes[page->route_count++] = route;
+    }
+}
+
+// Every file of one web app listed in assets.manifest (tools/webassets), as the
+// URLs the firmware maps to it: "weather/app.js" -> "/app.js", "config/x" -> "/c/x"
+static void add_manifest_assets(page_t *page, const char *manifest, const char *dir, const char *prefix)
+{
+    FILE *f = manifest ? fopen(manifest, "r") : NULL;
+    if (f == NULL)
+    {
+        return;
+    }
+
+    char line[512];
+    size_t dir_len = strlen(dir);
+    while (fgets(line, sizeof(line), f))
+    {
+        line[strcspn(line, "\t\r\n")] = '\0';
+        if (strncmp(line, dir, dir_len) != 0 || line[dir_len] != '/')
+        {
+            continue;
+        }
+        const char *file = line + dir_len + 1;
+        // index.html is the page itself; api/ holds the front-end's development mocks
+        if (strcmp(file, "index.html") == 0 || strcmp(file, "robots.txt") == 0 || strncmp(file, "api/", 4) == 0)
+        {
+            continue;
+        }
+        char path[PATH_MAX_LEN];
+        snprintf(path, sizeof(path), "%s/%s", prefix, file);
+        add_request(page, path);
+    }
+    fclose(f);
+}
+
+static void add_builtin_pages(const char *manifest)
+{
+    // The weather app, shown on phones in the house
+    page_t *page = add_page("weather", 3);
+    add_request(page, "/");
+    add_manifest_assets(page, manifest, "weather", "");
+    add_request(page, "/api/weather");
+
+    // The configuration app
+    page = add_page("config", 1);
+    add_request(page, "/c/");
+    add_manifest_assets(page, manifest, "config", "/c");
+    add_request(page, "/api/config");
+    add_request(page, "/api/scan");
+
+    // An open weather tab refreshing its data
+    page = add_page("poll", 6);
+    add_request(page, "/api/weather");
+}
+
+// One page per line: "<name> <path> <path>...", # starts a comment
+static bool load_pages(const char *file)
+{
+    FILE *f = fopen(file, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "Cannot open %s\n", file);
+        return false;
+    }
+
+    char line[4096];
+    while (fgets(line, sizeof(line), f))
+    {
+        line[strcspn(line, "#\r\n")] = '\0';
+        char *save = NULL;
+        char *name = strtok_r(line, " \t", &save);
+        if (name == NULL)
+        {
+            continue;
+        }
+        page_t *page = add_page(name, 1);
+        for (char *path = strtok_r(NULL, " \t", &save); path; path = strtok_r(NULL, " \t", &save))
+        {
+            add_request(page, path);
+        }
+    }
+    fclose(f);
+    return s_page_count > 0;
+}
+
+// "weather=3,config=1": weights by page name; pages not listed are not loaded
+static bool apply_mix(const char *mix)
+{
+    for (int i = 0; i < s_page_count; i++)
+    {
+        s_pages[i].weight = 0;
+    }
+
+    char spec[256];
+    snprintf(spec, sizeof(spec), "%s", mix);
+    char *save = NULL;
+    for (char *item = strtok_r(spec, ",", &save); item; item = strtok_r(NULL, ",", &save))
+    {
+        char *eq = strchr(item, '=');
+        unsigned weight = eq ? (unsigned)atoi(eq + 1) : 1;
+        if (eq)
+        {
+            *eq = '\0';
+        }
+
+        int i = 0;
+        while (i < s_page_count && strcmp(s_pages[i].name, item) != 0)
+        {
+            i++;
+        }
+        if (i == s_page_count)
+        {
+            fprintf(stderr, "Unknown page %s in --mix\n", item);
+            return false;
+        }
+        s_pages[i].weight = weight;
+    }
+    return true;
+}
+
+// --- CLIENTS ---
+
+static const page_t *pick_page(client_t *client)
+{
+    unsigned pick = (unsigned)rand_r(&client->seed) % s_total_weight;
+    for (int i = 0; i < s_page_count; i++)
+    {
+        if (pick < s_pages[i].weight)
+        {
+            return &s_pages[i];
+        }
+        pick -= s_pages[i].weight;
+    }
+    return &s_pages[0];
+}
+
+static void record(client_t *client, int route, const http_response_t *resp, bool complete, uint64_t us)
+{
+    route_stats_t *stats = &client->stats[route];
+    if (!complete)
+    {
+        stats->io_errors++;
+        return;
+    }
+
+    if (resp->status >= 500)
+        stats->server_errors++;
+    else if (resp->status >= 400)
+        stats->client_errors++;
+    else
+        stats->ok++;
+    stats->bytes += resp->body_bytes;
+    latency_histogram_record(&stats->latency, us);
+
+    if (resp->etag[0])
+    {
+        snprintf(client->etags[route], HTTP_ETAG_MAX, "%s", resp->etag);
+    }
+}
+
+static void *client_task(void *arg)
+{
+    client_t *client = (client_t *)arg;
+    while (!atomic_load(&s_stop))
+    {
+        const page_t *page = pick_page(client);
+
+        // A revisit revalidates what the browser kept, as it does without max-age
+        bool revisit = (int)(rand_r(&client->seed) % 100) < s_revisit_pct;
+
+        // Counted as a page load when every request got a response
+        int done = 0;
+        bool failed = false;
+        for (; done < page->route_count && !atomic_load(&s_stop); done++)
+        {
+            int route = page->routes[done];
+            http_response_t resp;
+            uint64_t start = now_us();
+            bool complete = http_conn_get(&client->conn, s_routes[route].path,
+                                          revisit ? client->etags[route] : NULL, &resp);
+            record(client, route, &resp, complete, now_us() - start);
+            failed |= !complete;
+            if (resp.reconnected)
+            {
+                client->reconnects++;
+            }
+        }
+        if (done == page->route_count && !failed)
+        {
+            client->page_loads++;
+        }
+    }
+    http_conn_close(&client->conn);
+    return NULL;
+}
+
+// --- EVENT STREAMS ---
+
+// Hold event streams open for the whole run, like weather tabs left open,
+// and count the events pushed to them
+static void *events_task(void *arg)
+{
+    events_stats_t *stats = (events_stats_t *)arg;
+    struct pollfd fds[MAX_CONNECTIONS];
+    char tail[MAX_CONNECTIONS][8] = {{0}}; // End of the previous read, for events split across reads
+    int count = 0;
+
+    for (int i = 0; i < stats->streams; i++)
+    {
+        int fd = socket(s_addr.ss_family, SOCK_STREAM, 0);
+        if (fd < 0 || connect(fd, (const struct sockaddr *)&s_addr, s_addr_len) != 0)
+        {
+            if (fd >= 0)
+                close(fd);
+            continue;
+        }
+        char request[256];
+        int len = snprintf(request, sizeof(request),
+                           "GET /api/events HTTP/1.1\r\nHost: %s\r\nAccept: text/event-stream\r\n\r\n", s_host);
+        if (send(fd, request, len, MSG_NOSIGNAL) != len)
+        {
+            close(fd);
+            continue;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fds[count].fd = fd;
+        fds[count].events = POLLIN;
+        count++;
+    }
+
+    // A stream counts as open once its 200 status line arrived
+    bool open[MAX_CONNECTIONS] = {false};
+    while (!atomic_load(&s_stop) && count > 0)
+    {
+        if (poll(fds, count, 200) <= 0)
+        {
+            continue;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            if (fds[i].fd < 0 || !(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+            {
+                continue;
+            }
+            char buf[4096 + sizeof(tail[0])];
+            size_t keep = strlen(tail[i]);
+            memcpy(buf, tail[i], keep);
+            ssize_t n = recv(fds[i].fd, buf + keep, 4096, 0);
+            if (n <= 0)
+            {
+                close(fds[i].fd);
+                fds[i].fd = -1;
+                if (open[i])
+                {
+                    open[i] = false;
+                    stats->open--;
+                }
+                continue;
+            }
+            buf[keep + n] = '\0';
+            stats->bytes += (uint64_t)n;
+
+            if (!open[i] && strstr(buf, "HTTP/1.1 200"))
+            {
+                open[i] = true;
+                stats->open++;
+            }
+            for (char *p = buf; (p = strstr(p, "event: ")) != NULL; p += 7)
+            {
+                stats->events++;
+            }
+
+            size_t total = keep + (size_t)n;
+            size_t tail_len = total < sizeof(tail[i]) - 1 ? total : sizeof(tail[i]) - 1;
+            memcpy(tail[i], buf + total - tail_len, tail_len);
+            tail[i][tail_len] = '\0';
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (fds[i].fd >= 0)
+            close(fds[i].fd);
+    }
+    return NULL;
+}
+
+// --- REPORT ---
+
+static void print_row(FILE *out, bool csv, const char *name, const route_stats_t *s, double seconds)
+{
+    uint64_t total = s->ok + s->client_errors + s->server_errors + s->io_errors;
+    double errors = total ? 100.0 * (double)(s->client_errors + s->server_errors + s->io_errors) / (double)total : 0.0;
+    double p50 = latency_histogram_percentile(&s->latency, 0.50) / 1000.0;
+    double p99 = latency_histogram_percentile(&s->latency, 0.99) / 1000.0;
+    double max = s->latency.max_us / 1000.0;
+
+    if (csv)
+    {
+        fprintf(out, "%s,%llu,%.2f,%llu,%llu,%llu,%llu,%.3f,%.3f,%.3f,%llu\n", name,
+                (unsigned long long)total, total / seconds, (unsigned long long)s->ok,
+                (unsigned long long)s->client_errors, (unsigned long long)s->server_errors,
+                (unsigned long long)s->io_errors, p50, p99, max, (unsigned long long)s->bytes);
+        return;
+    }
+
+    // Long asset paths keep their end, which names the file
+    size_t len = strlen(name);
+    const char *shown = len > 40 ? name + len - 40 : name;
+    fprintf(out, "%-40s %8llu %8.1f %6llu %6llu %6llu %6.2f %8.2f %8.2f %8.2f %9.1f\n", shown,
+            (unsigned long long)total, total / seconds, (unsigned long long)s->client_errors,
+            (unsigned long long)s->server_errors, (unsigned long long)s->io_errors, errors,
+            p50, p99, max, s->bytes / 1024.0);
+}
+
+static void report(client_t *clients, int connections, double seconds, const events_stats_t *events, const char *csv_file)
+{
+    route_stats_t *totals = calloc(s_route_count + 1, sizeof(route_stats_t));
+    route_stats_t *all = &totals[s_route_count];
+    uint64_t page_loads = 0;
+    uint64_t reconnects = 0;
+
+    for (int c = 0; c < connections; c++)
+    {
+        for (int r = 0; r < s_route_count; r++)
+        {
+            const route_stats_t *s = &clients[c].stats[r];
+            route_stats_t *dst[2] = {&totals[r], all};
+            for (int d = 0; d < 2; d++)
+            {
+                dst[d]->ok += s->ok;
+                dst[d]->client_errors += s->client_errors;
+                dst[d]->server_errors += s->server_errors;
+                dst[d]->io_errors += s->io_errors;
+                dst[d]->bytes += s->bytes;
+                latency_histogram_merge(&dst[d]->latency, &s->latency);
+            }
+        }
+        page_loads += clients[c].page_loads;
+        reconnects += clients[c].reconnects;
+    }
+
+    printf("%-40s %8s %8s %6s %6s %6s %6s %8s %8s %8s %9s\n",
+           "route", "requests", "req/s", "4xx", "5xx", "io", "err%", "p50 ms", "p99 ms", "max ms", "KB");
+    for (int r = 0; r < s_route_count; r++)
+    {
+        if (totals[r].ok + totals[r].client_errors + totals[r].server_errors + totals[r].io_errors > 0)
+        {
+            print_row(stdout, false, s_routes[r].path, &totals[r], seconds);
+        }
+    }
+    print_row(stdout, false, "total", all, seconds);
+    printf("\npage loads: %llu (%.1f/s), kept-alive connections found closed: %llu\n",
+           (unsigned long long)page_loads, page_loads / seconds, (unsigned long long)reconnects);
+    if (events->streams > 0)
+    {
+        printf("event streams: %d of %d open at the end, %llu events, %.1f KB\n", events->open,
+               events->streams, (unsigned long long)events->events, events->bytes / 1024.0);
+    }
+
+    if (csv_file)
+    {
+        FILE *f = fopen(csv_file, "w");
+        if (f == NULL)
+        {
+            fprintf(stderr, "Cannot write %s\n", csv_file);
+        }
+        else
+        {
+            fprintf(f, "route,requests,req_per_s,ok,4xx,5xx,io_errors,p50_ms,p99_ms,max_ms,bytes\n");
+            for (int r = 0; r < s_route_count; r++)
+            {
+                print_row(f, true, s_routes[r].path, &totals[r], seconds);
+            }
+            print_row(f, true, "total", all, seconds);
+            fclose(f);
+        }
+    }
+    free(totals);
+}
+
+// --- MAIN ---
+
+static bool resolve(const char *target)
+{
+    char host[128];
+    snprintf(host, sizeof(host), "%s", target);
+    const char *port = "80";
+    char *colon = strrchr(host, ':');
+    if (colon && strchr(host, ':') == colon)
+    {
+        *colon = '\0';
+        port = colon + 1;
+    }
+
+    struct addrinfo hints = {.ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM};
+    struct addrinfo *res = NULL;
+    int err = getaddrinfo(host, port, &hints, &res);
+    if (err != 0)
+    {
+        fprintf(stderr, "Cannot resolve %s: %s\n", target, gai_strerror(err));
+        return false;
+    }
+    memcpy(&s_addr, res->ai_addr, res->ai_addrlen);
+    s_addr_len = res->ai_addrlen;
+    freeaddrinfo(res);
+    snprintf(s_host, sizeof(s_host), "%s", target);
+    return true;
+}
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    atomic_store(&s_stop, true);
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [options] [host[:port]]   (default: 127.0.0.1:8080)\n", prog);
+    printf("  -c, --connections N  concurrent browsers, one keep-alive connection each (default: 4)\n");
+    printf("  -d, --duration S     run time in seconds (default: 10)\n");
+    printf("  --manifest FILE      assets.manifest of the served directory; its files join the page loads\n");
+    printf("  --pages FILE         page loads to replay instead of the built-in ones, one per line:\n");
+    printf("                       <name> <path> <path>...\n");
+    printf("  --mix SPEC           page weights, e.g. weather=3,config=1,poll=6 (the default)\n");
+    printf("  --revisit PCT        share of page loads sending If-None-Match (default: 50)\n");
+    printf("  --events N           event streams (/api/events) held open during the run (default: 0)\n");
+    printf("  --timeout MS         per send/receive (default: 5000)\n");
+    printf("  --seed N             page selection seed, for repeatable mixes (default: 1)\n");
+    printf("  --csv FILE           also write the per-route results as CSV\n");
+}
+
+int main(int argc, char **argv)
+{
+    int connections = 4;
+    int duration_s = 10;
+    int event_streams = 0;
+    unsigned seed = 1;
+    const char *manifest = NULL;
+    const char *pages_file = NULL;
+    const char *mix = NULL;
+    const char *csv_file = NULL;
+    const char *target = "127.0.0.1:8080";
+
+    for (int arg = 1; arg < argc; arg++)
+    {
+        const char *opt = argv[arg];
+        bool has_value = arg + 1 < argc;
+        if ((strcmp(opt, "-c") == 0 || strcmp(opt, "--connections") == 0) && has_value)
+            connections = atoi(argv[++arg]);
+        else if ((strcmp(opt, "-d") == 0 || strcmp(opt, "--duration") == 0) && has_value)
+            duration_s = atoi(argv[++arg]);
+        else if (strcmp(opt, "--manifest") == 0 && has_value)
+            manifest = argv[++arg];
+        else if (strcmp(opt, "--pages") == 0 && has_value)
+            pages_file = argv[++arg];
+        else if (strcmp(opt, "--mix") == 0 && has_value)
+            mix = argv[++arg];
+        else if (strcmp(opt, "--revisit") == 0 && has_value)
+            s_revisit_pct = atoi(argv[++arg]);
+        else if (strcmp(opt, "--events") == 0 && has_value)
+            event_streams = atoi(argv[++arg]);
+        else if (strcmp(opt, "--timeout") == 0 && has_value)
+            s_timeout_ms = atoi(argv[++arg]);
+        else if (strcmp(opt, "--seed") == 0 && has_value)
+            seed = (unsigned)atoi(argv[++arg]);
+        else if (strcmp(opt, "--csv") == 0 && has_value)
+            csv_file = argv[++arg];
+        else if (opt[0] != '-')
+            target = opt;
+        else
+        {
+            usage(argv[0]);
+            return strcmp(opt, "--help") == 0 || strcmp(opt, "-h") == 0 ? 0 : 2;
+        }
+    }
+    if (connections < 1 || connections > MAX_CONNECTIONS || duration_s < 1 ||
+        event_streams < 0 || event_streams > MAX_CONNECTIONS)
+    {
+        fprintf(stderr, "Connections and event streams: 1..%d, duration: at least 1 s\n", MAX_CONNECTIONS);
+        return 2;
+    }
+
+    if (pages_file == NULL)
+    {
+        add_builtin_pages(manifest);
+    }
+    else if (!load_pages(pages_file))
+    {
+        return 2;
+    }
+    if (mix && !apply_mix(mix))
+    {
+        return 2;
+    }
+    for (int i = 0; i < s_page_count; i++)
+    {
+        if (s_pages[i].route_count == 0)
+        {
+            s_pages[i].weight = 0;
+        }
+        s_total_weight += s_pages[i].weight;
+    }
+    if (s_total_weight == 0)
+    {
+        fprintf(stderr, "No page to load\n");
+        return 2;
+    }
+    if (!resolve(target))
+    {
+        return 2;
+    }
+
+    printf("%s: %d connections, %d s, revisit %d%%, pages:", target, connections, duration_s, s_revisit_pct);
+    for (int i = 0; i < s_page_count; i++)
+    {
+        if (s_pages[i].weight)
+            printf(" %s=%u (%d requests)", s_pages[i].name, s_pages[i].weight, s_pages[i].route_count);
+    }
+    printf("\n\n");
+
+    signal(SIGINT, on_signal);
+    signal(SIGPIPE, SIG_IGN);
+
+    client_t *clients = calloc(connections, sizeof(client_t));
+    if (clients == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 2;
+    }
+
+    events_stats_t events = {.streams = event_streams};
+    pthread_t events_thread;
+    if (event_streams > 0)
+    {
+        pthread_create(&events_thread, NULL, events_task, &events);
+    }
+
+    uint64_t start = now_us();
+    for (int i = 0; i < connections; i++)
+    {
+        clients[i].seed = seed * 7919u + (unsigned)i;
+        http_conn_init(&clients[i].conn, &s_addr, s_addr_len, s_host, s_timeout_ms);
+        pthread_create(&clients[i].thread, NULL, client_task, &clients[i]);
+    }
+
+    // Sleep in short steps so Ctrl-C ends the run early with a report
+    while (!atomic_load(&s_stop) && now_us() - start < (uint64_t)duration_s * 1000000)
+    {
+        usleep(50000);
+    }
+    atomic_store(&s_stop, true);
+
+    for (int i = 0; i < connections; i++)
+    {
+        pthread_join(clients[i].thread, NULL);
+    }
+    double seconds = (now_us() - start) / 1e6;
+    if (event_streams > 0)
+    {
+        pthread_join(events_thread, NULL);
+    }
+
+    report(clients, connections, seconds, &events, csv_file);
+
+    uint64_t ok = 0;
+    for (int i = 0; i < connections; i++)
+    {
+        for (int r = 0; r < s_route_count; r++)
+            ok += clients[i].stats[r].ok;
+    }
+    free(clients);
+    return ok > 0 ? 0 : 1;
+}
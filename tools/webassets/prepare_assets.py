@@ -0,0 +1,240 @@
+"""Prepare the web assets in front/ before they are packed into LittleFS.
+
+Writes a gzip sibling (and a brotli one with --brotli) next to every text
+asset, for example config/_app/immutable/entry/app.js.gz. The web server sends
+the compressed variant to clients whose Accept-Encoding allows it, so the
+config app crosses the SoftAP link several times smaller.
+
+Siblings are only rewritten when their source changed, so the firmware build
+runs this script every time. Siblings whose source is gone, or that would not
+be meaningfully smaller, are removed.
+
+It then writes assets.manifest at the top of the directory: one line per file
+with its MIME type, size, content hash and sibling sizes. The firmware loads it
+at boot, so a request needs no stat() and gets a strong ETag for 304 replies.
+
+With --bundle it also packs everything into a flat read-only image for the
+"assets" partition, which the firmware memory-maps and serves without LittleFS.
+
+Usage (from anywhere in the repository):
+    python tools/webassets/prepare_assets.py            # gzip siblings in front/
+    python tools/webassets/prepare_assets.py --brotli   # also brotli siblings
+    python tools/webassets/prepare_assets.py --bundle build/web_assets.bin
+"""
+
+import argparse
+import gzip
+import hashlib
+import struct
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parents[2]
+FRONT_DIR = ROOT / "front"
+
+# Extensions whose MIME type is_compressible_type() accepts (main/webserver/web_server.c)
+COMPRESSIBLE = {".html", ".htm", ".css", ".js", ".mjs", ".json", ".svg", ".ico", ".txt", ".xml", ".webmanifest"}
+ENCODINGS = {".gz": "gzip", ".br": "brotli"}
+
+# Read by web_assets_load() in main/webserver/web_assets.c
+MANIFEST = "assets.manifest"
+HASH_HEX_LEN = 16
+
+# Flat image for the assets partition, see write_bundle() and web_assets_map_bundle()
+BUNDLE_MAGIC = b"WTAB"
+BUNDLE_VERSION = 1
+BUNDLE_HEADER = struct.Struct("<4sHHI")
+BUNDLE_ENTRY = struct.Struct("<2I3I3I16s")
+
+# Same table as content_type_from_file() in main/webserver/web_server.c
+MIME_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+    ".svg": "image/svg+xml",
+}
+DEFAULT_MIME = "text/plain"
+
+# Below this the response headers dominate; above the ratio the saving is not worth the flash
+MIN_SIZE = 256
+MAX_RATIO = 0.9
+
+
+def compress(data, suffix):
+    if suffix == ".gz":
+        # mtime=0 keeps the output identical for identical input
+        return gzip.compress(data, compresslevel=9, mtime=0)
+    import brotli
+
+    return brotli.compress(data, quality=11)
+
+
+def is_sibling(path):
+    """A file this script wrote: <name>.<compressible ext>.<gz|br>."""
+    return path.suffix in ENCODINGS and Path(path.stem).suffix.lower() in COMPRESSIBLE
+
+
+def prepare(front, suffixes):
+    totals = {suffix: [0, 0, 0] for suffix in suffixes}  # files, source bytes, compressed bytes
+    removed = 0
+
+    for path in sorted(p for p in front.rglob("*") if p.is_file()):
+        if is_sibling(path):
+            source = path.with_suffix("")
+            if path.suffix not in suffixes or not source.is_file():
+                path.unlink()
+                removed += 1
+            continue
+        if path.suffix.lower() not in COMPRESSIBLE:
+            continue
+
+        data = path.read_bytes()
+        for suffix in suffixes:
+            sibling = path.with_name(path.name + suffix)
+            fresh = sibling.is_file() and sibling.stat().st_mtime >= path.stat().st_mtime
+            packed = sibling.read_bytes() if fresh else compress(data, suffix)
+
+            if len(data) < MIN_SIZE or len(packed) > len(data) * MAX_RATIO:
+                if sibling.exists():
+                    sibling.unlink()
+                    removed += 1
+                continue
+            if not fresh:
+                sibling.write_bytes(packed)
+
+            totals[suffix][0] += 1
+            totals[suffix][1] += len(data)
+            totals[suffix][2] += len(packed)
+
+    for suffix, (files, before, after) in totals.items():
+        print("%-6s %3d files  %8d B -> %8d B" % (ENCODINGS[suffix], files, before, after))
+    if removed:
+        print("Removed %d stale siblings" % removed)
+
+
+def collect_assets(front):
+    """(relative path, MIME type, data, hash, {suffix: sibling data}) for every served file."""
+    assets = []
+    for path in sorted(p for p in front.rglob("*") if p.is_file()):
+        rel = path.relative_to(front).as_posix()
+        if rel == MANIFEST or is_sibling(path):
+            continue
+        if any(c in rel for c in "\t\r\n"):
+            print("Skipping %s: tab or newline in the name" % rel)
+            continue
+        data = path.read_bytes()
+        siblings = {}
+        for suffix in ENCODINGS:
+            sibling = path.with_name(path.name + suffix)
+            if sibling.is_file():
+                siblings[suffix] = sibling.read_bytes()
+        assets.append((rel, MIME_TYPES.get(path.suffix, DEFAULT_MIME), data,
+                       hashlib.sha256(data).hexdigest()[:HASH_HEX_LEN], siblings))
+    return assets
+
+
+def write_if_changed(path, content):
+    if not path.is_file() or path.read_bytes() != content:
+        path.write_bytes(content)
+
+
+def write_manifest(front, assets):
+    """path, MIME type, size, hash, .gz size, .br size (0 = no sibling), tab separated."""
+    lines = ["# path\ttype\tsize\thash\tgzip\tbrotli"]
+    for rel, mime, data, digest, siblings in assets:
+        sizes = [str(len(siblings[suffix])) if suffix in siblings else "0" for suffix in ENCODINGS]
+        lines.append("\t".join([rel, mime, str(len(data)), digest] + sizes))
+
+    write_if_changed(front / MANIFEST, ("\n".join(lines) + "\n").encode("utf-8"))
+    print("Manifest: %d assets" % len(assets))
+
+
+def write_bundle(path, assets, max_size):
+    """Flat image for the "assets" partition, read through esp_partition_mmap().
+
+    Layout (little endian), parsed by web_assets_map_bundle():
+        header   magic "WTAB", u16 version, u16 entry count, u32 total size
+        entries  u32 path, u32 type, u32 offset[3], u32 size[3], char hash[16]
+        strings  NUL-terminated paths and MIME types
+        data     file, .gz and .br contents, 4-byte aligned
+    Offsets count from the start of the image; offset 0 means no such variant.
+    """
+    variants = [None] + list(ENCODINGS)  # identity, .gz, .br: WEB_ASSET_VARIANT_COUNT order
+    entries_at = BUNDLE_HEADER.size
+    strings_at = entries_at + len(assets) * BUNDLE_ENTRY.size
+
+    strings = bytearray()
+    string_offsets = {}
+
+    def intern(text):
+        if text not in string_offsets:
+            string_offsets[text] = strings_at + len(strings)
+            strings.extend(text.encode("utf-8") + b"\0")
+        return string_offsets[text]
+
+    names = [(intern(rel), intern(mime)) for rel, mime, _, _, _ in assets]
+
+    data = bytearray()
+    data_at = align4(strings_at + len(strings))
+    entries = bytearray()
+    for (rel, mime, content, digest, siblings), (path_off, type_off) in zip(assets, names):
+        offsets, sizes = [], []
+        for suffix in variants:
+            blob = content if suffix is None else siblings.get(suffix)
+            if blob is None:
+                offsets.append(0)
+                sizes.append(0)
+                continue
+            offsets.append(data_at + len(data))
+            sizes.append(len(blob))
+            data.extend(blob)
+            data.extend(b"\0" * (align4(len(data)) - len(data)))
+        entries.extend(BUNDLE_ENTRY.pack(path_off, type_off, *offsets, *sizes, digest.encode("ascii")))
+
+    body = entries + strings + b"\0" * (data_at - strings_at - len(strings)) + data
+    total = BUNDLE_HEADER.size + len(body)
+    image = BUNDLE_HEADER.pack(BUNDLE_MAGIC, BUNDLE_VERSION, len(assets), total) + body
+    if max_size is not None and total > max_size:
+        sys.exit("Asset bundle is %d B but the partition holds %d B" % (total, max_size))
+
+    write_if_changed(path, bytes(image))
+    print("Bundle: %d assets, %d B%s" % (len(assets), total, "" if max_size is None else " of %d B" % max_size))
+
+
+def align4(n):
+    return (n + 3) & ~3
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("front", nargs="?", type=Path, default=FRONT_DIR, help="web asset directory (default: front/)")
+    parser.add_argument("--brotli", action="store_true", help="also write .br siblings (needs the brotli module)")
+    parser.add_argument("--bundle", type=Path, help="also write a flat image for the assets partition")
+    parser.add_argument("--max-size", type=lambda v: int(v, 0), help="fail if the bundle is larger (partition size)")
+    args = parser.parse_args()
+
+    suffixes = [".gz"]
+    if args.brotli:
+        try:
+            import brotli  # noqa: F401
+        except ImportError:
+            sys.exit("--brotli needs the brotli module: pip install brotli")
+        suffixes.append(".br")
+
+    assets = []
+    if args.front.is_dir():
+        prepare(args.front, suffixes)
+        assets = collect_assets(args.front)
+        write_manifest(args.front, assets)
+    else:
+        print("%s does not exist yet; nothing to compress" % args.front)
+
+    if args.bundle:
+        write_bundle(args.bundle, assets, args.max_size)
+
+
+if __name__ == "__main__":
+    main()